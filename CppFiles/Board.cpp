@@ -10,8 +10,14 @@
 #include <algorithm>
 
 #include "../HeaderFiles/InputFunctions.h"
+#include "../HeaderFiles/StandardBoard.h"
+#include "../HeaderFiles/ProductionTable.h"
+#include "../HeaderFiles/GameRandom.h"
+#include "../HeaderFiles/Instrumentation.h"
+#include "../HeaderFiles/BoardRenderer.h"
+#include "../HeaderFiles/BoardBalancer.h"
+#include "../HeaderFiles/OutputSink.h"
 
-using std::cout, std::endl;
 using std::vector, std::shared_ptr, std::string, std::map, std::set, std::make_shared;
 using std::pair, std::rotate;
 
@@ -55,15 +61,115 @@ using std::pair, std::rotate;
 
  */
 
-Board::Board() : board_tiles({{'a', {}},{'b', {}},{'c', {}}}){
-	create_board(available_tile_types, available_production_numbers);
+Board::Board(GameRandom &random) : robber_tile(INVALID_ID) {
+	create_board(get_random_layout(available_tile_types, available_production_numbers, random));
+}
+
+Board::Board(GameRandom &random, const BalanceOptions &balance) : robber_tile(INVALID_ID) {
+	create_board(BoardBalancer::generate(available_tile_types, available_production_numbers, balance, random).layout);
+}
+
+Board::Board(const BoardLayout &layout) : robber_tile(INVALID_ID) {
+	create_board(layout);
 }
 
 // parameters passed by value, so I can make a copy and modify them in the function
-void Board::create_board(
-	map<tile_type, int> _available_tile_types, vector<int> _available_production_numbers){
+// The ports are rotated first and then each tile gets its type and number in id order, which is the order
+// the random numbers have always been used in, so a seed keeps making the same board
+BoardLayout Board::get_random_layout(
+	map<tile_type, int> _available_tile_types, vector<int> _available_production_numbers, GameRandom &random) {
+
+	BoardLayout layout;
+	vector<tile_type> port_types = {
+		TILE_EMPTY, GRAIN, ORE, TILE_EMPTY, WOOL, TILE_EMPTY, TILE_EMPTY, BRICK, LUMBER};
+	int rotation_value = random.next_int(port_types.size());
+	rotate(port_types.begin(), port_types.begin() + rotation_value, port_types.end());
+	for (int i = 0; i < StandardBoard::PORT_COUNT; i++) {
+		layout.port_types[i] = port_types[i];
+	}
+
+	for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+		layout.tile_types[tile] = get_random_tile_type(_available_tile_types, random);
+		layout.tile_numbers[tile] = -1;
+		if (layout.tile_types[tile] != DESERT) {
+			layout.tile_numbers[tile] = get_random_production_number(_available_production_numbers, random);
+		}
+	}
+	return layout;
+}
 
-	populate_port_pairs();
+// The layout itself comes from the constexpr tables in StandardBoard.h, so all that is left to do here is
+// place the tiles, numbers and ports and create the objects
+void Board::create_board(const BoardLayout &layout) {
+
+	const StandardBoard::Topology &topology = StandardBoard::TOPOLOGY;
+
+	populate_port_pairs(layout);
+
+	// Create every plot, giving the ones on a port their port type
+	for (int i = 0; i < StandardBoard::PLOT_COUNT; i++) {
+		OrderedPair position_coordinates =
+			OrderedPair(topology.plot_coordinates[i].x, topology.plot_coordinates[i].y);
+
+		PortPair port_pair;
+		if (topology.plot_port[i] != StandardBoard::NO_PORT) {
+			port_pair = ports[topology.plot_port[i]];
+		}
+
+		auto new_plot = make_shared<Plot>(position_coordinates, port_pair.port_type, port_pair.universal_port);
+		new_plot->set_id(graph.add_plot());
+		board_plots.insert(new_plot);
+		plot_list.push_back(new_plot);
+		plot_grid.set(position_coordinates, new_plot->get_id());
+	}
+
+	// Now that all plots exist, give them a reference to the plots adjacent to them
+	for (shared_ptr<Plot> current_plot : plot_list) {
+		for (int slot = 0; slot < BoardGraph::PLOT_DEGREE; slot++) {
+			PlotId adjacent_id = topology.plot_plots[current_plot->get_id()][slot];
+			if (adjacent_id != INVALID_ID) {
+				current_plot->add_to_adjacent_plots(slot, plot_list[adjacent_id]);
+				graph.set_adjacent_plot(current_plot->get_id(), slot, adjacent_id);
+			}
+		}
+	}
+
+	// Create every path. The direction is already known, so it doesn't need to be calculated from the endpoints
+	for (int i = 0; i < StandardBoard::PATH_COUNT; i++) {
+		PlotId plot_a = topology.path_plots[i][0];
+		PlotId plot_b = topology.path_plots[i][1];
+
+		auto new_path = make_shared<Path>(
+			EndpointPair(plot_list[plot_a], plot_list[plot_b]), topology.path_direction[i]);
+		new_path->set_id(graph.add_path(plot_a, plot_b));
+		board_paths.insert(new_path);
+		path_list.push_back(new_path);
+		path_grid.set(CoordinateGrid::edge_key(
+			plot_list[plot_a]->get_position_coordinates(),
+			plot_list[plot_b]->get_position_coordinates()), new_path->get_id());
+	}
+
+	// Make sure all paths have reference to those that are adjacent to them.
+	// Two paths are adjacent if they share an endpoint, which the board graph already knows from its plot -> path table
+	graph.build_path_adjacency();
+	for (shared_ptr<Path> current_path : path_list) {
+		for (PathId adjacent_id : graph.get_adjacent_paths(current_path->get_id())) {
+			if (adjacent_id == INVALID_ID) {
+				continue;
+			}
+			current_path->add_to_adjacent_paths(path_list[adjacent_id]);
+		}
+	}
+
+	// The graph is complete, so the neighbour masks can be built. Every plot and path keeps the masks up to date from here on
+	bitboards = make_shared<BoardBitboards>(graph);
+	for (shared_ptr<Plot> &plot : plot_list) {
+		plot->set_bitboards(bitboards);
+		bitboards->set_plot_port(plot->get_id(), plot->get_port_type(), plot->is_universal_port());
+	}
+	for (shared_ptr<Path> &path : path_list) {
+		path->set_bitboards(bitboards);
+	}
 
 	// Map stores info for the three rings of the map, labeled 'a', 'b', and 'c'
 
@@ -76,535 +182,128 @@ void Board::create_board(
 	for (auto& m : ring_layers) {
 		// This inner loop loops through the current ring's string, each character being provided to a tile as part of its position_id
 		for (char ch : m.second) {
-			// Chooses the type and number of the tile being created. Both are required for the Tile constructor
-			tile_type chosen_type = get_random_tile_type(_available_tile_types);
-			int chosen_number = -1;
-			if (chosen_type != DESERT) {
-				chosen_number =
-					get_random_production_number(_available_production_numbers);
-			}
-
 			// The position_id is created and the map key, a comma, and the current string char are appended to it
 			string tile_position_id;
 			tile_position_id.push_back(m.first);
 			tile_position_id.push_back(',');
 			tile_position_id.push_back(ch);
 
+			// Tiles are numbered in the order they are created, which is also their order in the topology tables
+			TileId tile_id = graph.add_tile();
+			tile_type chosen_type = layout.tile_types[tile_id];
+			int chosen_number = layout.tile_numbers[tile_id];
 			OrderedPair position_coordinates =
-				get_tile_position_coordinates(tile_position_id);
-			// create a set of shared pointers to the adjacent plots to the tile being created. This is required for the Tile constructor
-			map<int, shared_ptr<Plot>> adjacent_plots;
-			fill_adjacent_plots(adjacent_plots, position_coordinates);
+				OrderedPair(StandardBoard::TILE_COORDINATES[tile_id].x, StandardBoard::TILE_COORDINATES[tile_id].y);
 
-			// create a set of shared pointers to the adjacent paths to the tile being created. This is required for the Tile constructor
+			// Gather the plots and paths around the tile. These are required for the Tile constructor
+			map<int, shared_ptr<Plot>> adjacent_plots;
 			map<int, shared_ptr<Path>> adjacent_paths;
-			fill_adjacent_paths(adjacent_paths, adjacent_plots, position_coordinates);
+			for (int i = 0; i < BoardGraph::TILE_DEGREE; i++) {
+				shared_ptr<Plot> plot = plot_list[topology.tile_plots[tile_id][i]];
+				plot->add_to_adjacent_tiles(position_coordinates);
+				adjacent_plots.insert({i, plot});
+				graph.link_tile_plot(tile_id, i, plot->get_id());
+
+				shared_ptr<Path> path = path_list[topology.tile_paths[tile_id][i]];
+				adjacent_paths.insert({i, path});
+				graph.link_tile_path(tile_id, i, path->get_id());
+			}
 
 			// Create the Tile
 			Tile new_tile =
 				Tile(chosen_type, chosen_number,
 					tile_position_id, position_coordinates,
 					adjacent_plots, adjacent_paths);
-
-			// Add the tile to the proper set in the set of all board tiles.
-			board_tiles[m.first].insert({ch, new_tile});
-
-		}
-	}
-
-	// Now that all plots, tiles, and paths have been created and stored away,
-	// we need to make sure all plots have a reference to plots adjacent to them
-
-	// Loop through all plots
-	for (shared_ptr<Plot> current_plot : board_plots) {
-		// Here is a vector of the two offset relations between a plot and the plots adjacent to it which is always the same
-		vector<OrderedPair> adjacency_offsets = {OrderedPair(0, 1), OrderedPair(0, -1)};
-
-		// The final pair is one which may be positive or negative depending on position in the hex grid
-		OrderedPair current_pos = current_plot->get_position_coordinates();
-		OrderedPair final_pair = OrderedPair(-2, 0);
-		OrderedPair start = OrderedPair(-1, 0);
-
-		// Here, I am just taking a known valid offset and final pair, and walking it to the current position.
-		// The final pair mirrors every time we take a step. Looking at a hex grid, you may find this to be a valid assessment.
-		// X pos walk
-		while (start.x != current_pos.x) {
-			if (start.x < current_pos.x) {
-				start.x += 2;
-				final_pair = final_pair * -1;
-			} else if (start.x > current_pos.x) {
-				start.x -= 2;
-				final_pair = final_pair * -1;
-			}
-		}
-		// Y pos walk
-		while (start.y != current_pos.y) {
-			if (start.y < current_pos.y) {
-				start.y += 1;
-				final_pair = final_pair * -1;
-			} else if (start.y > current_pos.y) {
-				start.y -= 1;
-				final_pair = final_pair * -1;
+			new_tile.set_id(tile_id);
+			bitboards->get_production_table().set_tile(tile_id, chosen_type, chosen_number, graph.get_tile_plots(tile_id));
+			if (new_tile.has_robber()) {
+				robber_tile = tile_id;
+				bitboards->move_robber(tile_id);
 			}
-		}
-
-		adjacency_offsets.push_back(final_pair);
 
-		// For each offset, if there is a plot there, it is adjacent so add it to the current plot's adjacent plots
-		for (int i = 0; i < adjacency_offsets.size(); i++) {
-			OrderedPair new_pos = current_plot->get_position_coordinates() + adjacency_offsets[i];
-			if (has_plot(new_pos)) {
-				shared_ptr<Plot> new_plot = get_plot(new_pos);
-				current_plot->add_to_adjacent_plots(i, get_plot(new_pos));
-			}
-		}
-	}
-
-	// Now make sure all paths have reference to those that are adjacent to them
-
-	// Loop through all paths
-	for (shared_ptr<Path> current_path : board_paths) {
-		// Get the paths endpoints in a vector to iterate over
-		vector<shared_ptr<Plot>> iterable_endpoints =
-			{current_path->get_endpoints().plot_a, current_path->get_endpoints().plot_b};
-		// For each endpoint (there are 2 of them) look at all adjacent plots and the paths they form with it
-		for (shared_ptr<Plot> plot : iterable_endpoints) {
-			for (auto &it : plot->get_adjacent_plots()) {
-				shared_ptr<Plot> adjacent_plot = it.second;
-				if (!has_path(plot->get_position_coordinates(),
-					adjacent_plot->get_position_coordinates())) {
-					continue;
-				}
-				shared_ptr<Path> adjacent_path_candidate =
-					get_path(plot->get_position_coordinates(),
-						adjacent_plot->get_position_coordinates());
-				if (current_path == adjacent_path_candidate) {
-					continue;
-				}
-				current_path->add_to_adjacent_paths(adjacent_path_candidate);
-			}
+			// Add the tile to the list of all board tiles, where its index is its id
+			board_tiles.push_back(new_tile);
+			tile_grid.set(position_coordinates, tile_id);
 		}
 	}
 }
 
-// Helper function for create_board fills out the adjacent plots
-void Board::fill_adjacent_plots(
-	map<int, shared_ptr<Plot>> &adjacent_plots,
-	const OrderedPair &position_coordinates) {
-	// These x, y values make up all offset coordinates for plot positions.
-	// I am iterating over a vector to guarantee they are added in the order I want
-	vector<OrderedPair> pairs =
-		{OrderedPair(-1, 1), OrderedPair(1, 1),
-		OrderedPair(1, 0), OrderedPair(1, -1),
-		OrderedPair(-1, -1), OrderedPair(-1, 0)};
-	for (int i = 0; i < pairs.size(); i++) {
-
-		// Creates the coordinate for the plot, which is the offset from the current tile + the current tile's coordinate
-		OrderedPair new_position_coordinate = pairs[i] + position_coordinates;
-		if (has_plot(new_position_coordinate)) {
-			// If there is already a plot with this coordinate, get it and add it to adjacent plots set
-			adjacent_plots.insert({i, get_plot(new_position_coordinate)});
-			// Adds the tile position to the plot's adjacent tile set
-			get_plot(new_position_coordinate)->add_to_adjacent_tiles(position_coordinates);
-		} else {
-
-			// Get a port_pair for the plot. if it is the default, it will not make a change
-			PortPair port_pair = get_corresponding_portpair(new_position_coordinate);
-
-			// If there is not already a plot with this coordinate, create it
-			auto new_plot = make_shared<Plot>(new_position_coordinate, port_pair.port_type, port_pair.universal_port);
-			// Adds the tile position to the plot's adjacent tile set
-			new_plot->add_to_adjacent_tiles(position_coordinates);
-			// Add it to adjacent plots set
-			adjacent_plots.insert({i, new_plot});
-			// Add it to all plots set
-			board_plots.insert(new_plot);
-		}
-
-	}
-}
-
-Board::PortPair Board::get_corresponding_portpair(const OrderedPair coord) const {
-	for (const PortPair &p : ports) {
-		if (p.plots.first == coord || p.plots.second == coord) {
-			return p;
-		}
-	}
-	return {};
-}
-
-void Board::populate_port_pairs() {
-	srand(time(nullptr));
-	vector<pair<OrderedPair, OrderedPair>> port_positions = {
-		pair(OrderedPair(-1, 5), OrderedPair(1, 5)),
-		pair(OrderedPair(3, 3), OrderedPair(3, 4)),
-		pair(OrderedPair(5, 1), OrderedPair(5, 0)),
-		pair(OrderedPair(5, -2), OrderedPair(5, -3)),
-		pair(OrderedPair(1, -4), OrderedPair(3, -4)),
-		pair(OrderedPair(-1, -4), OrderedPair(-3, -4)),
-		pair(OrderedPair(-5, -2), OrderedPair(-5, -3)),
-		pair(OrderedPair(-5, 0), OrderedPair(-5, 1)),
-		pair(OrderedPair(-3, 3), OrderedPair(-3, 4)),};
-
-	vector<pair<tile_type, bool>> port_types = {
-		pair(TILE_EMPTY, true), pair(GRAIN, false), pair(ORE, false),
-		pair(TILE_EMPTY, true), pair(WOOL, false), pair(TILE_EMPTY, true),
-		pair(TILE_EMPTY, true), pair(BRICK, false), pair(LUMBER, false)};
-	int rotation_value = rand() % port_types.size();
-	rotate(port_types.begin(), port_types.begin() + rotation_value, port_types.end());
-
-	for (int i = 0; i < port_positions.size(); i++) {
+// The port positions are fixed, only which port type goes where changes from board to board
+void Board::populate_port_pairs(const BoardLayout &layout) {
+	for (int i = 0; i < StandardBoard::PORT_COUNT; i++) {
+		const auto &port_plots = StandardBoard::PORT_PLOT_COORDINATES[i];
 		ports.emplace_back(
 			PortPair(
-			port_positions.at(i).first,
-			port_positions.at(i).second,
-			port_types.at(i).first,
-			port_types.at(i).second));
-	}
-}
-
-// Helper function for create_board fills out adjacent paths
-void Board::fill_adjacent_paths(
-	map<int, shared_ptr<Path>> &adjacent_paths,
-	const map<int, shared_ptr<Plot>> &adjacent_plots,
-	const OrderedPair &position_coordinates) {
-
-	vector<OrderedPair> pairs =
-		{OrderedPair(-1, 1), OrderedPair(1, 1),
-		OrderedPair(1, 0), OrderedPair(1, -1),
-		OrderedPair(-1, -1), OrderedPair(-1, 0)};
-	for (int a = 0, b = 1; a < pairs.size(); a++, b = (b + 1) % pairs.size()) {
-		OrderedPair global_coords_a = pairs[a] + position_coordinates;
-		OrderedPair global_coords_b = pairs[b] + position_coordinates;
-
-		if (has_path(global_coords_a, global_coords_b)) {
-			adjacent_paths.insert(
-				{a, get_path(global_coords_a, global_coords_b)});
-		} else {
-			EndpointPair new_endpoints =
-				EndpointPair(get_plot(global_coords_a), get_plot(global_coords_b));
-
-			auto new_path = make_shared<Path>(new_endpoints, position_coordinates);
-
-			adjacent_paths.insert({a, new_path});
-			board_paths.insert(new_path);
-		}
+			OrderedPair(port_plots[0].x, port_plots[0].y),
+			OrderedPair(port_plots[1].x, port_plots[1].y),
+			layout.port_types[i],
+			layout.port_types[i] == TILE_EMPTY));
 	}
 }
 
 // Returns an ordered pair depicted the position coordinates of a tile given its position_id
-// Does so using mostly brute force unless I can come up with a clever way otherwise
+// The position_id is turned into the tile's index in the standard layout, whose coordinates are a table lookup
 OrderedPair Board::get_tile_position_coordinates(const string &position_id) const {
 	if (position_id.length() != 3) {
 		// The position ID is supposed to be in form #,# where # are both letters a-l
 		return {};
 	}
 
-	if (position_id[0] == 'a') {
-		// The only tile in ring 'a' is at position (0, 0)
+	int tile_index = StandardBoard::tile_index(position_id[0], position_id[2]);
+	if (tile_index == -1) {
 		return {};
 	}
-
-	// Go through all 12 outer ring positions. Every other one is double an inner ring position, so if we
-	// are in ring 'b', just take only every other one and take halve it.
-	for (int i = 0; i < 12; i++) {
-		// These are the outer ring positions in order clockwise starting at position_id c,a (c,a -> c,l)
-		vector<OrderedPair> pairs = {OrderedPair(0, 4),
-			OrderedPair(2, 3), OrderedPair(4, 2),
-			OrderedPair(4, 0), OrderedPair(4, -2),
-			OrderedPair(2, -3), OrderedPair(0, -4),
-			OrderedPair(-2, -3), OrderedPair(-4, -2),
-			OrderedPair(-4, 0), OrderedPair(-4, 2),
-			OrderedPair(-2, 3)};
-		string chars;
-
-		switch (position_id[0]) {
-			case 'b':
-				// If we are in ring 'b', only look at every other value, as there are 6 instead of 12 tiles, and helve the
-				// ordered pairs because they are half as fair from the origin (ring 'a')
-				chars = "a_b_c_d_e_f_";
-				if (chars[i] == '_') {
-					continue;
-				}
-				if (position_id[2] == chars[i]) {
-					return pairs[i] / 2.0;
-				}
-				break;
-			case 'c':
-				// If we are in ring 'c', look at all 12 letters and ordered pairs
-				chars = "abcdefghijkl";
-				if (position_id[2] == chars[i]) {
-					return pairs[i];
-				}
-				break;
-		}
-	}
-
-	return {};
+	return {StandardBoard::TILE_COORDINATES[tile_index].x, StandardBoard::TILE_COORDINATES[tile_index].y};
 }
 
-// Displays the board to the console
+// Displays the board to the console. The renderer lays the board out the first time, after that only what
+// changed is repainted
 void Board::display_board(
 	const bool show_tile_position_ids,
 	const vector<string> highlighted_tiles) const {
+	INSTRUMENT_SCOPE("Board::display_board");
 
-	// map of layers to print to the console labeled 0-20 because there are 21 layers to the board
-	map<int, string> print_layers;
-
-	// Populate map with all 21 layers of input.
-	// A layer is one line, which on one tile might include two plots and a path, for example. See example drawing above for visual
-	for (int i = 0; i < 21; i++) {
-		vector<string> default_values = {"    ", "    ", "  ", "    "};
-		// Default values represent the inherent zig zag of the sides of a hexagon.
-		// All other spacing is handled within the tile printing
-		print_layers.insert({i, default_values[i % default_values.size()]});
-	}
-	// Insert invalid index dump.
-	// This layer will not be printed
-	print_layers.insert({-1, ""});
-
-	// Add initial spacing to parts of map that need it
-	append_string_to_print_layer("  ", print_layers, 0, false);
-	append_string_to_print_layer(" ", print_layers, 2, false);
-	append_string_to_print_layer(" ", print_layers, 18, false);
-	append_string_to_print_layer("          ", print_layers, 19, false);
-	append_string_to_print_layer("             ", print_layers, 20, false);
-
-	// Keep track of which paths have already been added to the print layers
-	set<shared_ptr<Plot>> added_plots;
-	set<shared_ptr<Path>> added_paths;
-
-	// x is x-position, shift index holds the index of the shift vectors below. These values allow index to alternate to fit the hex grid
-	for (int x = -4, shift_index = 0; x <= 4; x += 2, shift_index++) {
-		// The value base y is the y position if looking at a square grid, but needs to be shifted to fit the alternating style of a hex grid.
-		// Tile layer delta allows it to shift to account for all 21 print layers.
-		for (int base_y = 4, tile_layer_delta = 0; base_y >= -4; base_y -= 2, tile_layer_delta += 4) {
-			// local layer index 0-4 corresponds to the 5 layers of a tile's icons.
-			for (int local_layer_index = 0; local_layer_index < 5; local_layer_index++) {
-
-				vector<int> index_shifts = {0, 2}, y_val_shifts = {0, 1};
-				int layer_index =
-					local_layer_index + tile_layer_delta - index_shifts[shift_index % index_shifts.size()];
-				if (layer_index < 0 || layer_index > 20) {
-					// If the index is invalid, set it to go to the invalid index dump in the print_layers map
-					layer_index = -1;
-				}
-				int y = base_y + y_val_shifts[shift_index % index_shifts.size()];
-
-				// If the tile at the current position exists, we can begin to add it's qualities to the print layers
-				if (has_tile(OrderedPair(x, y))) {
-
-					// Current tile and its coordinates
-					Tile current_tile = get_tile(OrderedPair(x, y));
-					OrderedPair current_coords = current_tile.get_position_coordinate();
-
-					bool lowlight_tile =
-						!vector_has_value(
-							highlighted_tiles,
-							current_tile.get_position_id()) && highlighted_tiles.size() != 0;
-
-					// Here, we go through the 5 layers of display for a tile, and add its paths, plots, or info bars in the correct order accordingly
-					switch (local_layer_index) {
-						case 0:
-							// Adds the plot on the left to the layer
-							append_plot_to_print_layer(
-								current_coords + OrderedPair(-1, 1),
-								print_layers, layer_index,
-								added_plots, false);
-							// Adds the path of direction 0 (-----) connected to previous point to the layer
-							append_path_to_print_layer(
-								get_plot(current_coords + OrderedPair(-1, 1)), 0,
-								print_layers, layer_index, added_paths, false);
-							// Adds the plot on the right to the layer
-							append_plot_to_print_layer(
-								current_coords + OrderedPair(1, 1),
-								print_layers, layer_index,
-								added_plots, false);
-							break;
-							// Resulting drawing: . ----- .
-						case 1:
-							// Adds the path on the left of the top info bar of the tile to the layer
-							append_path_to_print_layer(
-								get_plot(current_coords + OrderedPair(-1, 1)), 1,
-								print_layers, layer_index, added_paths, false);
-							// Adds the top layer info to layer
-							append_string_to_print_layer(current_tile.get_top_display_row(
-								show_tile_position_ids), print_layers,
-								layer_index, false);
-							// Adds the path on the right of the top info bar of the tile to the layer
-							append_path_to_print_layer(
-								get_plot(current_coords + OrderedPair(1, 1)), -1,
-								print_layers, layer_index,
-								added_paths, false);
-							// resulting drawing example: /   b,c   \         .
-							break;
-						case 2:
-							// Adds the plot on the left to the layer
-							append_plot_to_print_layer(
-								current_coords + OrderedPair(-1, 0),
-								print_layers, layer_index,
-								added_plots, false);
-							// Adds the middle layer info to the layer
-							append_string_to_print_layer(
-								current_tile.get_main_display_row(lowlight_tile),
-								print_layers, layer_index, false);
-							// Adds the plot on the right to the layer
-							append_plot_to_print_layer(
-								current_coords + OrderedPair(1, 0),
-								print_layers, layer_index,
-								added_plots, false);
-							break;
-							// resulting drawing example: .   6 (L)   .
-						case 3:
-							// Adds the path on the left of the bottom info bar of the tile to the layer
-							append_path_to_print_layer(
-								get_plot(current_coords + OrderedPair(-1, 0)), -1,
-								print_layers, layer_index,
-								added_paths, false);
-							// Adds the bottom layer info to the layer
-							append_string_to_print_layer(
-								current_tile.get_robber_display_row(),
-								print_layers, layer_index, false);
-							// Adds the path on the right of the bottom info bar of the tile to the layer
-							append_path_to_print_layer(
-								get_plot(current_coords + OrderedPair(1, 0)), 1,
-								print_layers, layer_index, added_paths, false);
-							break;
-							// resulting drawing example: \  {!R!}  /
-						case 4:
-							// Adds the plot on the left to the layer
-							append_plot_to_print_layer(
-								current_coords + OrderedPair(-1, -1),
-								print_layers, layer_index, added_plots, false);
-							// Adds the path of direction 0 connected to previous point to the layer
-							append_path_to_print_layer(
-								get_plot(current_coords + OrderedPair(-1, -1)), 0,
-								print_layers, layer_index, added_paths, false);
-							// Adds the plot on the right to the layer
-							append_plot_to_print_layer(
-								current_coords + OrderedPair(1, -1),
-								print_layers, layer_index,
-								added_plots, false);
-							break;
-							// resulting drawing: . ----- .
-					}
-				} else {
-					// This runs if there exists no tile at the given coordinates
-					// The cases are for each lay of printing, which require different amounts of spacing
-					switch (local_layer_index) {
-						case 0:
-							// If there is a tile above, we don't want to add spaces where that tile's icons would be
-							if (has_tile(OrderedPair(x, y + 2))) { continue; }
-							// Add appropriate number of spaces to layer
-							append_string_to_print_layer(
-								"       ", print_layers, layer_index, false);
-							break;
-						case 1:
-							// Add appropriate number of spaces to layer
-							append_string_to_print_layer(
-								"          ", print_layers, layer_index, false);
-							break;
-						case 2:
-							// Add appropriate number of spaces to layer
-							append_string_to_print_layer(
-								"           ", print_layers, layer_index, false);
-							break;
-						case 3:
-							// Add appropriate number of spaces to layer
-							append_string_to_print_layer(
-								"          ", print_layers, layer_index, false);
-							break;
-						case 4:
-							// If there is a tile bellow, we don't want to add spaces where that tile's icons would be
-							if (has_tile(OrderedPair(x, y - 2))) { continue;}
-							// Add appropriate number of spaces to layer
-							append_string_to_print_layer(
-								"       ", print_layers, layer_index, false);
-							break;
-					}
-				}
-
-			}
-		}
-	}
-
-	// Prints all layers, first added a new line to avoid any conflicts with prints which didn't end in a newline
-	cout << endl;
-	for (auto &layer : print_layers) {
-		if (layer.first != -1){ cout << layer.second << endl; }
+	if (renderer == nullptr) {
+		renderer = make_shared<BoardRenderer>(*this);
 	}
-	cout << endl;
-}
-
-// Given an ordered pair, adds the plot at that location and data associated with it to the layer to be printed
-void Board::append_plot_to_print_layer(
-	const OrderedPair &global_plot_coords,
-	map<int, string> &print_layers,
-	const int layer_index,
-	set<shared_ptr<Plot>> &added_plots,
-	const bool space_after) const {
+	renderer->update(*this, show_tile_position_ids, highlighted_tiles);
 
-	// If the added plots already added this plot, don't try to add it again. Just return
-	for (shared_ptr<Plot> plot : added_plots) {
-		if (plot == get_plot(global_plot_coords)) { return; }
+	if (display_pinned) {
+		// The board sits under the first line of the screen, so only the cells that changed are sent
+		renderer->draw_changes(game_output(), 2);
+		flush_game_output();
+		return;
 	}
 
-	if (has_plot(global_plot_coords)) {
-		shared_ptr<Plot> current_plot = get_plot(global_plot_coords);
-		print_layers[layer_index] += current_plot->get_icon();
-		if (space_after) {
-			print_layers[layer_index] += " "; }
-		added_plots.insert(current_plot);
-	}
+	// Prints a new line first to avoid any conflicts with prints which didn't end in a newline
+	game_output() << '\n';
+	renderer->draw(game_output());
+	game_output() << '\n';
+	flush_game_output();
 }
 
-// Given an endpoint and direction, adds the corresponding path and its information to the layer to be printed
-void Board::append_path_to_print_layer(
-	const shared_ptr<Plot> &endpoint,
-	const int &direction,
-	map<int, string> &print_layers,
-	const int layer_index,
-	set<shared_ptr<Path>> &added_paths,
-	const bool space_after) const {
-
-	// If the added plots already added this plot, don't try to add it again. Just return
-	for (shared_ptr<Path> path : added_paths) {
-		if (path == get_path(endpoint, direction)) {
-			return;
-		}
+void Board::set_display_pinned(const bool pinned) {
+	if (pinned == display_pinned) {
+		return;
 	}
+	display_pinned = pinned;
 
-	if (has_path(endpoint, direction)) {
-		shared_ptr<Path> current_path = get_path(endpoint, direction);
-		print_layers[layer_index] += current_path->get_icon();
-		if (space_after) {
-			print_layers[layer_index] += " "; }
-		added_paths.insert(current_path);
+	if (pinned) {
+		if (renderer == nullptr) {
+			renderer = make_shared<BoardRenderer>(*this);
+		}
+		renderer->forget_shown();
+		// Clear the screen and keep everything else scrolling in the lines under the board
+		int first_free_row = BoardRenderer::ROWS + 3;
+		game_output() << "\033[2J\033[" << first_free_row << "r\033[" << first_free_row << ";1H";
 	} else {
-		cout << endpoint->get_position_coordinates().x << "," <<
-			endpoint->get_position_coordinates().y << " : " << direction << endl;
+		game_output() << "\033[r";
 	}
-}
-
-// Adds plain string to layer to be printed
-void Board::append_string_to_print_layer(
-	const string &to_add,
-	map<int, string> &print_layers,
-	const int layer_index,
-	const bool space_after) const {
-
-	if (to_add.empty()) {
-		// If the string is empty, don't bother doing anything else
-		return; }
-	print_layers[layer_index] += to_add;
-	if (space_after) {
-		print_layers[layer_index] += " "; }
+	flush_game_output();
 }
 
 // Returns a random tile type given a map of remaining tile types and how many of each kind are remaining
-tile_type Board::get_random_tile_type(map<tile_type, int> &tile_types_remaining) {
-
-	srand(time(nullptr));
+tile_type Board::get_random_tile_type(map<tile_type, int> &tile_types_remaining, GameRandom &random) {
 
 	// Converts map of tile types and quantities into vector with the correct # of instances of each type in it for easier random picking
 	vector<tile_type> tile_types_as_vector;
@@ -618,7 +317,7 @@ tile_type Board::get_random_tile_type(map<tile_type, int> &tile_types_remaining)
 		return DESERT;
 	}
 
-	int chosen_index = rand() % tile_types_as_vector.size();
+	int chosen_index = random.next_int(tile_types_as_vector.size());
 	tile_type chosen_type = tile_types_as_vector[chosen_index];
 	tile_types_remaining[chosen_type] -= 1;
 
@@ -626,15 +325,13 @@ tile_type Board::get_random_tile_type(map<tile_type, int> &tile_types_remaining)
 }
 
 // Returns a random production number given a vector of remaining production numbers
-int Board::get_random_production_number(vector<int> &production_numbers_remaining) {
-
-	srand(time(nullptr));
+int Board::get_random_production_number(vector<int> &production_numbers_remaining, GameRandom &random) {
 
 	if (production_numbers_remaining.size() == 0) {
 		return -1;
 	}
 
-	int chosen_index = rand() % production_numbers_remaining.size();
+	int chosen_index = random.next_int(production_numbers_remaining.size());
 	int chosen_number = production_numbers_remaining[chosen_index];
 	production_numbers_remaining.erase(
 		production_numbers_remaining.begin() + chosen_index);
@@ -642,30 +339,92 @@ int Board::get_random_production_number(vector<int> &production_numbers_remainin
 	return chosen_number;
 }
 
+// Rebuilds the ring maps from the tile list. Ring labels come from the first letter of the position id
 map<char, map<char, Tile>> Board::get_board_tiles() const {
-	return board_tiles;
+	map<char, map<char, Tile>> rings = {{'a', {}}, {'b', {}}, {'c', {}}};
+	for (const Tile &tile : board_tiles) {
+		string position_id = tile.get_position_id();
+		rings[position_id[0]].insert({position_id[2], tile});
+	}
+	return rings;
 }
 
-set<shared_ptr<Plot>> Board::get_board_plots() const {
+const set<shared_ptr<Plot>>& Board::get_board_plots() const {
 	return board_plots;
 }
 
-set<shared_ptr<Path>> Board::get_board_paths() const {
+const set<shared_ptr<Path>>& Board::get_board_paths() const {
 	return board_paths;
 }
 
+const BoardGraph& Board::get_graph() const {
+	return graph;
+}
+
+const BoardBitboards& Board::get_bitboards() const {
+	return *bitboards;
+}
+
+BoardLayout Board::get_layout() const {
+	BoardLayout layout;
+	for (const Tile &tile : board_tiles) {
+		layout.tile_types[tile.get_id()] = tile.get_type();
+		layout.tile_numbers[tile.get_id()] = tile.get_production_number();
+	}
+	// 3:1 ports are kept with TILE_EMPTY as their type, like in the layout
+	for (int i = 0; i < StandardBoard::PORT_COUNT; i++) {
+		layout.port_types[i] = ports[i].port_type;
+	}
+	return layout;
+}
+
+shared_ptr<Plot> Board::get_plot_by_id(const PlotId id) const {
+	if (!graph.is_plot(id)) {
+		return nullptr;
+	}
+	return plot_list[id];
+}
+
+shared_ptr<Path> Board::get_path_by_id(const PathId id) const {
+	if (!graph.is_path(id)) {
+		return nullptr;
+	}
+	return path_list[id];
+}
+
+Tile& Board::get_tile_by_id(const TileId id) {
+	if (!graph.is_tile(id)) {
+		return invalid_tile;
+	}
+	return board_tiles[id];
+}
+
+const Tile& Board::get_tile_by_id(const TileId id) const {
+	if (!graph.is_tile(id)) {
+		return invalid_tile;
+	}
+	return board_tiles[id];
+}
+
+// Tiles are created ring by ring in alphabetical order, so a tile's id is its index in the standard layout
+TileId Board::get_tile_id(const string &position_id) const {
+	if (position_id.length() != 3 || position_id[1] != ',') {
+		return INVALID_ID;
+	}
+	TileId id = StandardBoard::tile_index(position_id[0], position_id[2]);
+	if (!graph.is_tile(id) || board_tiles[id].get_position_id() != position_id) {
+		return INVALID_ID;
+	}
+	return id;
+}
+
 bool Board::has_plot(const OrderedPair &position_coordinates) const {
-	return get_plot(position_coordinates) != nullptr;
+	return plot_grid.contains(position_coordinates);
 }
 
-// Loops through the plots, and if it finds one with the given coords it returns it
 shared_ptr<Plot> Board::get_plot(const OrderedPair &position_coordinates) const {
-	for (shared_ptr<Plot> plot : board_plots) {
-		if (plot->get_position_coordinates() == position_coordinates) {
-			return plot;
-		}
-	}
-	return nullptr;
+	INSTRUMENT_COUNT("Board::get_plot");
+	return get_plot_by_id(plot_grid.get(position_coordinates));
 }
 
 bool Board::has_path(const EndpointPair &endpoints) const {
@@ -673,130 +432,157 @@ bool Board::has_path(const EndpointPair &endpoints) const {
 }
 
 bool Board::has_path(const OrderedPair &endpointa, const OrderedPair &endpointb) const {
-	EndpointPair plots = EndpointPair(get_plot(endpointa), get_plot(endpointb));
-	return has_path(plots);
+	return get_path(endpointa, endpointb) != nullptr;
 }
 
 bool Board::has_path(const shared_ptr<Plot> &plot, const int direction) const {
 	return get_path(plot, direction) != nullptr;
 }
 
+// Only the (up to 3) paths touching plot_a need to be checked
 shared_ptr<Path> Board::get_path(const EndpointPair &endpoints) const {
-	for (shared_ptr<Path> path : board_paths) {
-		if (path->get_endpoints() == endpoints) {
-			return path;
-		}
+	INSTRUMENT_COUNT("Board::get_path");
+	if (endpoints.plot_a == nullptr || endpoints.plot_b == nullptr) {
+		return nullptr;
 	}
-	return nullptr;
+	// The plots must belong to this board for their ids to mean anything
+	if (get_plot_by_id(endpoints.plot_a->get_id()) != endpoints.plot_a ||
+		get_plot_by_id(endpoints.plot_b->get_id()) != endpoints.plot_b) {
+		return nullptr;
+	}
+	return get_path_by_id(graph.find_path(endpoints.plot_a->get_id(), endpoints.plot_b->get_id()));
 }
 
 shared_ptr<Path> Board::get_path(const OrderedPair &endpointa, const OrderedPair &endpointb) const {
-	EndpointPair plots = EndpointPair(get_plot(endpointa), get_plot(endpointb));
-	return get_path(plots);
+	INSTRUMENT_COUNT("Board::get_path");
+	shared_ptr<Path> path = get_path_by_id(path_grid.get(CoordinateGrid::edge_key(endpointa, endpointb)));
+	if (path == nullptr) {
+		return nullptr;
+	}
+	// Non-adjacent coordinates can share a key with a real path, so make sure the endpoints match
+	const EndpointPair &endpoints = path->get_endpoints();
+	OrderedPair a = endpoints.plot_a->get_position_coordinates();
+	OrderedPair b = endpoints.plot_b->get_position_coordinates();
+	if ((a == endpointa && b == endpointb) || (a == endpointb && b == endpointa)) {
+		return path;
+	}
+	return nullptr;
 }
 
-// Loops through paths, returning if it finds the path with the given direction that is connected to the given plot
+// Looks through the paths touching the plot, returning the one with the given direction
 shared_ptr<Path> Board::get_path(const shared_ptr<Plot> &plot, const int direction) const {
-	for (shared_ptr<Path> path : board_paths) {
-		if (path->get_direction() == direction && path->get_endpoints().has(plot)) {
-			return path;
+	INSTRUMENT_COUNT("Board::get_path");
+	if (plot == nullptr || get_plot_by_id(plot->get_id()) != plot) {
+		return nullptr;
+	}
+	for (PathId path_id : graph.get_plot_paths(plot->get_id())) {
+		if (path_id == INVALID_ID) {
+			continue;
+		}
+		if (path_list[path_id]->get_direction() == direction) {
+			return path_list[path_id];
 		}
 	}
 	return nullptr;
 }
 
+const Tile* Board::find_tile(const OrderedPair &position_coordinates) const {
+	TileId id = tile_grid.get(position_coordinates);
+	if (id == INVALID_ID) {
+		return nullptr;
+	}
+	return &board_tiles[id];
+}
+
 bool Board::has_tile(const OrderedPair &position_coordinates) const {
-	return get_tile(position_coordinates).is_valid();
+	return find_tile(position_coordinates) != nullptr;
 }
 
 bool Board::has_tile(const string position_id) const {
-	for (auto &ring : board_tiles) {
-		for (auto &code_tile_pair : ring.second) {
-			if (code_tile_pair.second.get_position_id() == position_id) {
-				return true;
-			}
-		}
-	}
-	return false;
+	return get_tile_id(position_id) != INVALID_ID;
 }
 
 Tile Board::get_tile(const OrderedPair &position_coordinates) const {
-	for (auto &ring : board_tiles) {
-		for (auto &code_tile_pair : ring.second) {
-			if (code_tile_pair.second.get_position_coordinate() == position_coordinates) {
-				return code_tile_pair.second;
-			}
-		}
+	INSTRUMENT_COUNT("Board::get_tile");
+	const Tile *tile = find_tile(position_coordinates);
+	if (tile == nullptr) {
+		return {};
 	}
-	return {};
+	return *tile;
 }
 
-// Loops through board tiles to find tile with the given position coordinates
 Tile& Board::get_tile(const OrderedPair &position_coordinates) {
-	for (auto &ring : board_tiles) {
-		for (auto &code_tile_pair : ring.second) {
-			if (code_tile_pair.second.get_position_coordinate() == position_coordinates) {
-				return code_tile_pair.second;
-			}
-		}
-	}
-	return invalid_tile;
+	INSTRUMENT_COUNT("Board::get_tile");
+	return get_tile_by_id(tile_grid.get(position_coordinates));
 }
 
-// Loops through board tiles to find the tile with the given position coordinates
 Tile& Board::get_tile(const string &position_id) {
-	for (auto &ring : board_tiles) {
-		for (auto &code_tile_pair : ring.second) {
-			if (code_tile_pair.second.get_position_id() == position_id) {
-				return code_tile_pair.second;
-			}
-		}
-	}
-	return invalid_tile;
+	INSTRUMENT_COUNT("Board::get_tile");
+	return get_tile_by_id(get_tile_id(position_id));
 }
 
+// A road can be placed if any path next to one of the player's roads is still empty
 bool Board::can_place_road(const shared_ptr<Player> player) const {
-	player_color color = player->get_color();
-	for (shared_ptr<Path> path : board_paths) {
-		if (!path->is_occupied()) {
-			// If the path is empty, we don't care.
-			continue; }
-		if (!path->get_inhabitant()->get_color() == color) {
-			// If the path is not the right color, we don't care
-			continue;}
-		// At this point, we look at each path next to those that have a road owned by the player
-		for (shared_ptr<Path> adj : path->get_adjacent_paths()) {
-			if (!adj->is_occupied()) {
-				// If there is an empty path adjacent to one with a road owned by the player, that is a legal placement. Return true
-				return true;
-			}
+	return bitboards->can_place_road(player->get_color());
+}
+
+void Board::report_road_lengths(const bool print_on_longest) const {
+	INSTRUMENT_SCOPE("Board::report_road_lengths");
+	// The bitboards only know colors, so the players are found through the roads they own
+	map<player_color, shared_ptr<Player>> owners;
+	for (const shared_ptr<Path> &path : path_list) {
+		if (path->is_occupied() && path->get_inhabitant()->get_owner() != nullptr) {
+			owners[path->get_inhabitant()->get_color()] = path->get_inhabitant()->get_owner();
+		}
+	}
+	for (const auto &[color, owner] : owners) {
+		int length = bitboards->get_road_length(color);
+		if (length != owner->get_length_of_road()) {
+			owner->set_length_of_road(length, print_on_longest);
 		}
 	}
-	// If we got here, we never returned true, so we have not found a spot for a road for this player.
-	return false;
 }
 
-void Board::generate_resources(const int die_result) const {
+// The production table already knows what every player gets from the roll, so only the owners need to be found
+void Board::generate_resources(const int die_result, const bool print) const {
+	INSTRUMENT_SCOPE("Board::generate_resources");
+	const ProductionTable &production = bitboards->get_production_table();
+	const vector<ProductionEntry> &entries = production.get_production(die_result);
+
+	// Entries are ordered by color, so each player's gains can be given (and printed) all at once
+	for (std::size_t i = 0; i < entries.size(); ) {
+		player_color color = entries[i].color;
+		ResourceVector resource_gains;
+		for (; i < entries.size() && entries[i].color == color; i++) {
+			resource_gains.add(entries[i].resource, entries[i].amount);
+		}
+		PlotMask buildings = bitboards->get_buildings(color);
+		if (buildings != 0) {
+			plot_list[lowest_bit(buildings)]->get_inhabitant()->get_owner()->gain_many_resources(resource_gains, true, print);
+		}
+	}
+
+	if (!print) {
+		return;
+	}
 	vector<string> highlighted_tiles;
-	for (auto &ring_pair : board_tiles) {
-		for (auto &tile_pair : ring_pair.second) {
-			if (tile_pair.second.get_production_number() == die_result) {
-				tile_pair.second.produce_resource();
-				if (!tile_pair.second.has_robber()) {
-					highlighted_tiles.push_back(tile_pair.second.get_position_id());
-				}
-			}
+	for (TileId tile : production.get_tiles(die_result)) {
+		if (tile != production.get_robber_tile()) {
+			highlighted_tiles.push_back(board_tiles[tile].get_position_id());
 		}
 	}
 	display_board(false, highlighted_tiles);
 }
 
 Tile& Board::get_tile_with_robber() {
-	for (auto &ring : board_tiles) {
-		for (auto &tile_pair : ring.second) {
-			if (tile_pair.second.has_robber()) {
-				return tile_pair.second;
-			}
+	if (graph.is_tile(robber_tile) && board_tiles[robber_tile].has_robber()) {
+		return board_tiles[robber_tile];
+	}
+	// The robber was moved without going through set_robber_position, so look for it
+	for (Tile &tile : board_tiles) {
+		if (tile.has_robber()) {
+			robber_tile = tile.get_id();
+			return tile;
 		}
 	}
 	return invalid_tile;
@@ -804,5 +590,10 @@ Tile& Board::get_tile_with_robber() {
 
 void Board::set_robber_position(const string tile_id) {
 	get_tile_with_robber().set_robber(false);
-	get_tile(tile_id).set_robber(true);
-}
\ No newline at end of file
+	TileId new_robber_tile = get_tile_id(tile_id);
+	get_tile_by_id(new_robber_tile).set_robber(true);
+	if (new_robber_tile != INVALID_ID) {
+		robber_tile = new_robber_tile;
+		bitboards->move_robber(new_robber_tile);
+	}
+}
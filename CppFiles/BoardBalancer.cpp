@@ -0,0 +1,231 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/BoardBalancer.h"
+#include "../HeaderFiles/GameRandom.h"
+#include "../HeaderFiles/Instrumentation.h"
+#include "../HeaderFiles/StandardBoard.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+using namespace std;
+
+// Which tiles touch each other, each plot and each port, from the standard board's topology
+struct BalanceTables {
+    vector<pair<int, int>> neighbouring_tiles;
+    array<vector<int>, StandardBoard::PLOT_COUNT> plot_tiles;
+    array<vector<int>, StandardBoard::PORT_COUNT> port_tiles;
+};
+
+/**
+* Requires: nothing
+* Modifies: nothing
+* Effects: builds the tables. Tiles are neighbours if they share a plot
+*/
+static BalanceTables build_tables() {
+    const StandardBoard::Topology &topology = StandardBoard::TOPOLOGY;
+    BalanceTables tables;
+    for (int tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        for (int plot : topology.tile_plots[tile]) {
+            tables.plot_tiles[plot].push_back(tile);
+        }
+    }
+    for (int plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        const vector<int> &tiles = tables.plot_tiles[plot];
+        for (size_t a = 0; a < tiles.size(); a++) {
+            for (size_t b = a + 1; b < tiles.size(); b++) {
+                pair<int, int> neighbours = {min(tiles[a], tiles[b]), max(tiles[a], tiles[b])};
+                if (find(tables.neighbouring_tiles.begin(), tables.neighbouring_tiles.end(), neighbours) ==
+                    tables.neighbouring_tiles.end()) {
+                    tables.neighbouring_tiles.push_back(neighbours);
+                }
+            }
+        }
+        int port = topology.plot_port[plot];
+        if (port != StandardBoard::NO_PORT) {
+            for (int tile : tiles) {
+                if (find(tables.port_tiles[port].begin(), tables.port_tiles[port].end(), tile) == tables.port_tiles[port].end()) {
+                    tables.port_tiles[port].push_back(tile);
+                }
+            }
+        }
+    }
+    return tables;
+}
+
+static const BalanceTables TABLES = build_tables();
+
+// A scored candidate, and where it was dealt
+struct BalanceCandidate {
+    BalanceResult result;
+    int index = -1;
+};
+
+// What one thread has found
+struct BalanceThread {
+    BalanceCandidate best;
+    int candidates = 0;
+};
+
+/**
+* Requires: candidate, the best so far
+* Modifies: nothing
+* Effects: returns if the candidate beats the best, on score and then on being dealt first
+*/
+static bool is_better(const BalanceCandidate &candidate, const BalanceCandidate &best) {
+    if (best.index < 0) {
+        return true;
+    }
+    if (candidate.result.score.total != best.result.score.total) {
+        return candidate.result.score.total < best.result.score.total;
+    }
+    return candidate.index < best.index;
+}
+
+/**
+* Requires: tile types, production numbers, options, seed of the candidates, deadline, shared candidate
+* counter, this thread's findings
+* Modifies: next_candidate, found
+* Effects: deals and scores candidates until the deadline or the candidate limit
+*/
+static void run_balance_thread(const map<tile_type, int> &tile_types, const vector<int> &production_numbers,
+    const BalanceOptions &options, const uint64_t seed, const chrono::steady_clock::time_point deadline,
+    atomic<int> &next_candidate, BalanceThread &found) {
+
+    while (true) {
+        int index = next_candidate.fetch_add(1, memory_order_relaxed);
+        if (options.max_candidates > 0 && index >= options.max_candidates) {
+            return;
+        }
+        // The first candidate is always dealt, so there is a board even with no time to look for one
+        if (index > 0 && options.time_ms > 0 && chrono::steady_clock::now() >= deadline) {
+            return;
+        }
+
+        GameRandom random(seed + index);
+        BalanceCandidate candidate;
+        candidate.index = index;
+        candidate.result.layout = Board::get_random_layout(tile_types, production_numbers, random);
+        candidate.result.score = BoardBalancer::score(candidate.result.layout, options.weights);
+        found.candidates++;
+        if (is_better(candidate, found.best)) {
+            found.best = candidate;
+        }
+    }
+}
+
+int BoardBalancer::get_pips(const int number) {
+    if (number < 2 || number > 12) {
+        return 0;
+    }
+    return 6 - abs(7 - number);
+}
+
+BalanceScore BoardBalancer::score(const BoardLayout &layout, const BalanceWeights &weights) {
+    BalanceScore score;
+    array<int, StandardBoard::TILE_COUNT> tile_pips{};
+    array<int, TILE_EMPTY> resource_pips{};
+    array<int, TILE_EMPTY> resource_tiles{};
+    int total_pips = 0;
+    int producing_tiles = 0;
+    for (int tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        tile_pips[tile] = get_pips(layout.tile_numbers[tile]);
+        if (layout.tile_types[tile] != DESERT && layout.tile_types[tile] < TILE_EMPTY) {
+            resource_pips[layout.tile_types[tile]] += tile_pips[tile];
+            resource_tiles[layout.tile_types[tile]]++;
+            total_pips += tile_pips[tile];
+            producing_tiles++;
+        }
+    }
+
+    // Squared distance of each resource's pips from what its number of tiles would get on average, per tile
+    double mean_tile_pips = producing_tiles > 0 ? static_cast<double>(total_pips) / producing_tiles : 0;
+    for (int resource = GRAIN; resource <= LUMBER; resource++) {
+        if (resource_tiles[resource] > 0) {
+            double difference = resource_pips[resource] - mean_tile_pips * resource_tiles[resource];
+            score.resource_pips += difference * difference / resource_tiles[resource];
+        }
+    }
+
+    for (const pair<int, int> &neighbours : TABLES.neighbouring_tiles) {
+        if (tile_pips[neighbours.first] == 5 && tile_pips[neighbours.second] == 5) {
+            score.red_adjacency++;
+        }
+    }
+
+    double plot_pip_sum = 0;
+    double plot_pip_square_sum = 0;
+    for (const vector<int> &tiles : TABLES.plot_tiles) {
+        int pips = 0;
+        for (int tile : tiles) {
+            pips += tile_pips[tile];
+        }
+        plot_pip_sum += pips;
+        plot_pip_square_sum += pips * pips;
+    }
+    double mean_plot_pips = plot_pip_sum / StandardBoard::PLOT_COUNT;
+    score.plot_pip_variance = plot_pip_square_sum / StandardBoard::PLOT_COUNT - mean_plot_pips * mean_plot_pips;
+
+    for (int port = 0; port < StandardBoard::PORT_COUNT; port++) {
+        tile_type port_type = layout.port_types[port];
+        if (port_type == TILE_EMPTY) {
+            continue;
+        }
+        for (int tile : TABLES.port_tiles[port]) {
+            if (layout.tile_types[tile] == port_type) {
+                score.port_coupling += tile_pips[tile];
+            }
+        }
+    }
+
+    score.total = weights.resource_pips * score.resource_pips + weights.red_adjacency * score.red_adjacency +
+        weights.plot_pip_variance * score.plot_pip_variance + weights.port_coupling * score.port_coupling;
+    return score;
+}
+
+BalanceResult BoardBalancer::generate(const map<tile_type, int> &tile_types, const vector<int> &production_numbers,
+    const BalanceOptions &_options, GameRandom &random) {
+    INSTRUMENT_SCOPE("BoardBalancer::generate");
+
+    BalanceOptions options = _options;
+    if (options.time_ms <= 0 && options.max_candidates <= 0) {
+        options.max_candidates = 1;
+    }
+
+    chrono::steady_clock::time_point deadline = chrono::steady_clock::now() + chrono::milliseconds(options.time_ms);
+    // Candidate i is dealt from seed + i, which GameRandom turns into unrelated numbers
+    uint64_t seed = random.next();
+    int thread_count = options.threads > 0 ? options.threads : max(1u, thread::hardware_concurrency());
+    if (options.max_candidates > 0) {
+        thread_count = min(thread_count, options.max_candidates);
+    }
+
+    atomic<int> next_candidate{0};
+    vector<BalanceThread> found(thread_count);
+    vector<thread> helpers;
+    for (int t = 1; t < thread_count; t++) {
+        helpers.emplace_back(run_balance_thread, cref(tile_types), cref(production_numbers), cref(options), seed,
+            deadline, ref(next_candidate), ref(found[t]));
+    }
+    run_balance_thread(tile_types, production_numbers, options, seed, deadline, next_candidate, found[0]);
+    for (thread &helper : helpers) {
+        helper.join();
+    }
+
+    BalanceCandidate best;
+    int candidates = 0;
+    for (const BalanceThread &thread_found : found) {
+        candidates += thread_found.candidates;
+        if (thread_found.best.index >= 0 && is_better(thread_found.best, best)) {
+            best = thread_found.best;
+        }
+    }
+    best.result.candidates = candidates;
+    return best.result;
+}
@@ -0,0 +1,220 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/BoardBitboards.h"
+#include "../HeaderFiles/LongestRoadEngine.h"
+#include "../HeaderFiles/ProductionTable.h"
+#include "../HeaderFiles/Zobrist.h"
+
+BoardBitboards::BoardBitboards(const BoardGraph &graph) :
+    road_engine(std::make_shared<LongestRoadEngine>()),
+    production(std::make_shared<ProductionTable>(graph.get_plot_count())) {
+    int plot_count = graph.get_plot_count();
+    int path_count = graph.get_path_count();
+
+    plot_neighbour_plots.assign(plot_count, 0);
+    plot_incident_paths.assign(plot_count, PathMask());
+    path_endpoint_plots.assign(path_count, 0);
+    path_neighbour_paths.assign(path_count, PathMask());
+    plot_ports.assign(plot_count, 0);
+
+    for (PlotId plot = 0; plot < plot_count && plot < MAX_PLOTS; plot++) {
+        all_plots |= PlotMask(1) << plot;
+        for (PlotId adjacent : graph.get_adjacent_plots(plot)) {
+            if (adjacent != INVALID_ID) {
+                plot_neighbour_plots[plot] |= PlotMask(1) << adjacent;
+            }
+        }
+        for (PathId path : graph.get_plot_paths(plot)) {
+            if (path != INVALID_ID && path < MAX_PATHS) {
+                plot_incident_paths[plot] |= PathMask::bit(path);
+            }
+        }
+    }
+
+    for (PathId path = 0; path < path_count && path < MAX_PATHS; path++) {
+        all_paths |= PathMask::bit(path);
+        for (PlotId endpoint : graph.get_path_plots(path)) {
+            path_endpoint_plots[path] |= PlotMask(1) << endpoint;
+        }
+        for (PathId adjacent : graph.get_adjacent_paths(path)) {
+            if (adjacent != INVALID_ID) {
+                path_neighbour_paths[path] |= PathMask::bit(adjacent);
+            }
+        }
+    }
+}
+
+bool BoardBitboards::is_player_color(const player_color color) {
+    return color >= 0 && color < COLOR_COUNT;
+}
+
+void BoardBitboards::set_plot_port(const PlotId plot, const tile_type port_type, const bool universal_port) {
+    plot_ports[plot] = 0;
+    if (universal_port) {
+        plot_ports[plot] |= UNIVERSAL_PORT;
+    } else if (port_type != TILE_EMPTY) {
+        plot_ports[plot] |= port_bit(port_type);
+    }
+}
+
+void BoardBitboards::place_building(const PlotId plot, const player_color color, const building_type type) {
+    const ZobristKeys &keys = ZobristKeys::get();
+    PlotMask bit = PlotMask(1) << plot;
+    for (int c = 0; c < COLOR_COUNT; c++) {
+        if ((settlements[c] & bit) != 0) {
+            hash ^= keys.plot_key(plot, static_cast<player_color>(c), SETTLEMENT);
+        }
+        if ((cities[c] & bit) != 0) {
+            hash ^= keys.plot_key(plot, static_cast<player_color>(c), CITY);
+        }
+        settlements[c] &= ~bit;
+        cities[c] &= ~bit;
+    }
+    if (is_player_color(color)) {
+        hash ^= keys.plot_key(plot, color, type);
+        if (type == CITY) {
+            cities[color] |= bit;
+        } else {
+            settlements[color] |= bit;
+        }
+        port_access[color] |= plot_ports[plot];
+    }
+    occupied_plots |= bit;
+    blocked_plots |= bit | plot_neighbour_plots[plot];
+    road_engine->building_placed(*this, plot);
+    production->building_placed(plot, color, type);
+}
+
+void BoardBitboards::place_road(const PathId path, const player_color color) {
+    occupied_paths |= PathMask::bit(path);
+    if (!is_player_color(color)) {
+        return;
+    }
+    if (!roads[color].test(path)) {
+        hash ^= ZobristKeys::get().path_key(path, color);
+    }
+    roads[color] |= PathMask::bit(path);
+    road_plots[color] |= path_endpoint_plots[path];
+    road_frontier[color] |= path_neighbour_paths[path] | PathMask::bit(path);
+    road_engine->road_placed(*this, path, color);
+}
+
+void BoardBitboards::move_robber(const TileId tile) {
+    const ZobristKeys &keys = ZobristKeys::get();
+    TileId robber_tile = production->get_robber_tile();
+    if (robber_tile != INVALID_ID) {
+        hash ^= keys.robber_key(robber_tile);
+    }
+    if (tile != INVALID_ID) {
+        hash ^= keys.robber_key(tile);
+    }
+    production->robber_moved(tile);
+}
+
+PlotMask BoardBitboards::get_settlements(const player_color color) const {
+    return is_player_color(color) ? settlements[color] : 0;
+}
+
+PlotMask BoardBitboards::get_cities(const player_color color) const {
+    return is_player_color(color) ? cities[color] : 0;
+}
+
+PlotMask BoardBitboards::get_buildings(const player_color color) const {
+    return get_settlements(color) | get_cities(color);
+}
+
+PathMask BoardBitboards::get_roads(const player_color color) const {
+    return is_player_color(color) ? roads[color] : PathMask();
+}
+
+PortMask BoardBitboards::get_port_access(const player_color color) const {
+    return is_player_color(color) ? port_access[color] : 0;
+}
+
+PortMask BoardBitboards::get_plot_port(const PlotId plot) const {
+    return plot_ports[plot];
+}
+
+std::uint64_t BoardBitboards::get_hash() const {
+    return hash;
+}
+
+int BoardBitboards::get_trade_rate(const player_color color, const tile_type resource) const {
+    PortMask ports = get_port_access(color);
+    if (resource != TILE_EMPTY && (ports & port_bit(resource)) != 0) {
+        return 2;
+    }
+    return (ports & UNIVERSAL_PORT) != 0 ? 3 : 4;
+}
+
+int BoardBitboards::get_road_length(const player_color color) const {
+    return road_engine->get_length(color);
+}
+
+const LongestRoadEngine& BoardBitboards::get_road_engine() const {
+    return *road_engine;
+}
+
+ProductionTable& BoardBitboards::get_production_table() {
+    return *production;
+}
+
+const ProductionTable& BoardBitboards::get_production_table() const {
+    return *production;
+}
+
+PlotMask BoardBitboards::get_occupied_plots() const {
+    return occupied_plots;
+}
+
+PathMask BoardBitboards::get_occupied_paths() const {
+    return occupied_paths;
+}
+
+PlotMask BoardBitboards::get_plot_neighbours(const PlotId plot) const {
+    return plot_neighbour_plots[plot];
+}
+
+PathMask BoardBitboards::get_plot_paths(const PlotId plot) const {
+    return plot_incident_paths[plot];
+}
+
+PlotMask BoardBitboards::get_path_plots(const PathId path) const {
+    return path_endpoint_plots[path];
+}
+
+PathMask BoardBitboards::get_path_neighbours(const PathId path) const {
+    return path_neighbour_paths[path];
+}
+
+bool BoardBitboards::next_to_building(const PlotId plot) const {
+    return (plot_neighbour_plots[plot] & occupied_plots) != 0;
+}
+
+bool BoardBitboards::has_adjacent_road(const PathId path, const player_color color) const {
+    return is_player_color(color) && (path_neighbour_paths[path] & roads[color]).any();
+}
+
+// A settlement can't go on or next to another building, and most of the game it has to be at the end of one
+// of the player's roads
+PlotMask BoardBitboards::get_buildable_plots(const player_color color, const bool require_adjacent_road) const {
+    PlotMask buildable = all_plots & ~blocked_plots;
+    if (require_adjacent_road) {
+        buildable &= is_player_color(color) ? road_plots[color] : 0;
+    }
+    return buildable;
+}
+
+PathMask BoardBitboards::get_buildable_paths(const player_color color, const bool require_adjacent_road) const {
+    PathMask buildable = all_paths & ~occupied_paths;
+    if (require_adjacent_road) {
+        buildable &= is_player_color(color) ? road_frontier[color] : PathMask();
+    }
+    return buildable;
+}
+
+bool BoardBitboards::can_place_road(const player_color color) const {
+    return get_buildable_paths(color, true).any();
+}
@@ -0,0 +1,150 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/BoardGraph.h"
+
+using std::array;
+
+BoardGraph::BoardGraph() = default;
+
+template <std::size_t N>
+void BoardGraph::add_to_row(array<int, N> &row, const int id) {
+    for (int &slot : row) {
+        if (slot == id) {
+            return;
+        }
+        if (slot == INVALID_ID) {
+            slot = id;
+            return;
+        }
+    }
+}
+
+PlotId BoardGraph::add_plot() {
+    array<int, PLOT_DEGREE> empty_row;
+    empty_row.fill(INVALID_ID);
+    plot_plots.push_back(empty_row);
+    plot_paths.push_back(empty_row);
+    plot_tiles.push_back(empty_row);
+    return plot_plots.size() - 1;
+}
+
+PathId BoardGraph::add_path(const PlotId plot_a, const PlotId plot_b) {
+    PathId id = path_plots.size();
+    path_plots.push_back({plot_a, plot_b});
+
+    array<int, PATH_DEGREE> empty_row;
+    empty_row.fill(INVALID_ID);
+    path_paths.push_back(empty_row);
+
+    add_to_row(plot_paths[plot_a], id);
+    add_to_row(plot_paths[plot_b], id);
+    return id;
+}
+
+TileId BoardGraph::add_tile() {
+    array<int, TILE_DEGREE> empty_row;
+    empty_row.fill(INVALID_ID);
+    tile_plots.push_back(empty_row);
+    tile_paths.push_back(empty_row);
+    return tile_plots.size() - 1;
+}
+
+void BoardGraph::set_adjacent_plot(const PlotId plot, const int slot, const PlotId adjacent) {
+    plot_plots[plot][slot] = adjacent;
+}
+
+void BoardGraph::link_tile_plot(const TileId tile, const int slot, const PlotId plot) {
+    tile_plots[tile][slot] = plot;
+    add_to_row(plot_tiles[plot], tile);
+}
+
+void BoardGraph::link_tile_path(const TileId tile, const int slot, const PathId path) {
+    tile_paths[tile][slot] = path;
+}
+
+// Two paths are adjacent when they share an endpoint, so every path incident to either endpoint
+// (other than the path itself) is an adjacent path
+void BoardGraph::build_path_adjacency() {
+    for (PathId path = 0; path < get_path_count(); path++) {
+        for (PlotId endpoint : path_plots[path]) {
+            for (PathId other : plot_paths[endpoint]) {
+                if (other == INVALID_ID || other == path) {
+                    continue;
+                }
+                add_to_row(path_paths[path], other);
+            }
+        }
+    }
+}
+
+int BoardGraph::get_plot_count() const {
+    return plot_plots.size();
+}
+
+int BoardGraph::get_path_count() const {
+    return path_plots.size();
+}
+
+int BoardGraph::get_tile_count() const {
+    return tile_plots.size();
+}
+
+const array<PlotId, BoardGraph::PLOT_DEGREE>& BoardGraph::get_adjacent_plots(const PlotId plot) const {
+    return plot_plots[plot];
+}
+
+const array<PathId, BoardGraph::PLOT_DEGREE>& BoardGraph::get_plot_paths(const PlotId plot) const {
+    return plot_paths[plot];
+}
+
+const array<TileId, BoardGraph::PLOT_DEGREE>& BoardGraph::get_plot_tiles(const PlotId plot) const {
+    return plot_tiles[plot];
+}
+
+const array<PlotId, 2>& BoardGraph::get_path_plots(const PathId path) const {
+    return path_plots[path];
+}
+
+const array<PathId, BoardGraph::PATH_DEGREE>& BoardGraph::get_adjacent_paths(const PathId path) const {
+    return path_paths[path];
+}
+
+const array<PlotId, BoardGraph::TILE_DEGREE>& BoardGraph::get_tile_plots(const TileId tile) const {
+    return tile_plots[tile];
+}
+
+const array<PathId, BoardGraph::TILE_DEGREE>& BoardGraph::get_tile_paths(const TileId tile) const {
+    return tile_paths[tile];
+}
+
+// A plot only has up to 3 paths, so this is a constant time check no matter how large the board is
+PathId BoardGraph::find_path(const PlotId plot_a, const PlotId plot_b) const {
+    if (!is_plot(plot_a) || !is_plot(plot_b)) {
+        return INVALID_ID;
+    }
+    for (PathId path : plot_paths[plot_a]) {
+        if (path == INVALID_ID) {
+            continue;
+        }
+        const array<PlotId, 2> &endpoints = path_plots[path];
+        if ((endpoints[0] == plot_a && endpoints[1] == plot_b) ||
+            (endpoints[0] == plot_b && endpoints[1] == plot_a)) {
+            return path;
+        }
+    }
+    return INVALID_ID;
+}
+
+bool BoardGraph::is_plot(const PlotId plot) const {
+    return plot >= 0 && plot < get_plot_count();
+}
+
+bool BoardGraph::is_path(const PathId path) const {
+    return path >= 0 && path < get_path_count();
+}
+
+bool BoardGraph::is_tile(const TileId tile) const {
+    return tile >= 0 && tile < get_tile_count();
+}
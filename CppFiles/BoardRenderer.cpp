@@ -0,0 +1,385 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/BoardRenderer.h"
+
+#include "../HeaderFiles/Board.h"
+
+using std::string, std::vector, std::array, std::shared_ptr, std::ostream;
+
+namespace {
+    // How many characters each icon has on the board
+    const int PLOT_WIDTH = 3;
+    const int SIDE_PATH_WIDTH = 1;
+    const int FLAT_PATH_WIDTH = 5;
+    const int TILE_ROW_WIDTH = 9;
+
+    // Changed cells closer together than this are sent as one run, as moving the cursor costs about as much
+    const int RUN_GAP = 8;
+
+    // Marks a cell the terminal hasn't been sent, so it never matches the grid
+    const RenderCell UNSENT = {'\0', 0};
+
+    const std::uint32_t ALL_TILES = (std::uint32_t(1) << StandardBoard::TILE_COUNT) - 1;
+}
+
+BoardRenderer::BoardRenderer(const Board &board) {
+    styles.push_back("");
+    lay_out(board);
+}
+
+// Walks the board the way it has always been printed: 5 rows for each tile, going down each column of tiles,
+// from the left column to the right. Every plot and path is placed where it first comes up
+void BoardRenderer::lay_out(const Board &board) {
+
+    // The characters written so far on each row, starting with the zig zag of the sides of the hexagon
+    array<int, ROWS> widths{};
+    const array<int, 4> row_indents = {4, 4, 2, 4};
+    for (int row = 0; row < ROWS; row++) {
+        widths[row] = row_indents[row % row_indents.size()];
+    }
+    widths[0] += 2;
+    widths[2] += 1;
+    widths[18] += 1;
+    widths[19] += 10;
+    widths[20] += 13;
+
+    array<bool, StandardBoard::PLOT_COUNT> plot_placed{};
+    array<bool, StandardBoard::PATH_COUNT> path_placed{};
+
+    // Places the item with the given width on the row. Rows off the board (-1) still count the item as placed
+    auto place = [&widths](Slot &slot, const int row, const int width) {
+        if (row == -1) {
+            return;
+        }
+        slot = {row, widths[row], width};
+        widths[row] += width;
+    };
+    auto place_plot = [&](const OrderedPair &coordinates, const int row) {
+        shared_ptr<Plot> plot = board.get_plot(coordinates);
+        if (plot == nullptr || plot_placed[plot->get_id()]) {
+            return;
+        }
+        plot_placed[plot->get_id()] = true;
+        place(plot_slots[plot->get_id()], row, PLOT_WIDTH);
+    };
+    auto place_path = [&](const OrderedPair &endpoint, const int direction, const int row) {
+        shared_ptr<Plot> plot = board.get_plot(endpoint);
+        shared_ptr<Path> path = plot == nullptr ? nullptr : board.get_path(plot, direction);
+        if (path == nullptr || path_placed[path->get_id()]) {
+            return;
+        }
+        path_placed[path->get_id()] = true;
+        place(path_slots[path->get_id()], row, direction == 0 ? FLAT_PATH_WIDTH : SIDE_PATH_WIDTH);
+    };
+    auto place_spaces = [&widths](const int row, const int count) {
+        if (row != -1) {
+            widths[row] += count;
+        }
+    };
+
+    // Every other column of tiles is shifted half a tile down, which is 2 rows
+    const array<int, 2> row_shifts = {0, 2}, y_shifts = {0, 1};
+    for (int x = -4, column_index = 0; x <= 4; x += 2, column_index++) {
+        for (int base_y = 4, tile_row = 0; base_y >= -4; base_y -= 2, tile_row += 4) {
+            int y = base_y + y_shifts[column_index % 2];
+            OrderedPair coordinates(x, y);
+            bool has_tile = board.has_tile(coordinates);
+            TileId tile_id = has_tile ? board.get_tile(coordinates).get_id() : INVALID_ID;
+
+            for (int local_row = 0; local_row < 5; local_row++) {
+                int row = local_row + tile_row - row_shifts[column_index % 2];
+                if (row < 0 || row >= ROWS) {
+                    row = -1;
+                }
+
+                if (!has_tile) {
+                    // Spacing where there is no tile, leaving out the rows shared with a tile above or below
+                    switch (local_row) {
+                        case 0:
+                            if (!board.has_tile(OrderedPair(x, y + 2))) { place_spaces(row, 7); }
+                            break;
+                        case 1: place_spaces(row, 10); break;
+                        case 2: place_spaces(row, 11); break;
+                        case 3: place_spaces(row, 10); break;
+                        case 4:
+                            if (!board.has_tile(OrderedPair(x, y - 2))) { place_spaces(row, 7); }
+                            break;
+                    }
+                    continue;
+                }
+
+                switch (local_row) {
+                    case 0:
+                        // . ----- .
+                        place_plot(coordinates + OrderedPair(-1, 1), row);
+                        place_path(coordinates + OrderedPair(-1, 1), 0, row);
+                        place_plot(coordinates + OrderedPair(1, 1), row);
+                        break;
+                    case 1:
+                        // /   b,c   \      .
+                        place_path(coordinates + OrderedPair(-1, 1), 1, row);
+                        place(tile_top_slots[tile_id], row, TILE_ROW_WIDTH);
+                        place_path(coordinates + OrderedPair(1, 1), -1, row);
+                        break;
+                    case 2:
+                        // .   6 (L)   .
+                        place_plot(coordinates + OrderedPair(-1, 0), row);
+                        place(tile_main_slots[tile_id], row, TILE_ROW_WIDTH);
+                        place_plot(coordinates + OrderedPair(1, 0), row);
+                        break;
+                    case 3:
+                        // \  {!R!}  /
+                        place_path(coordinates + OrderedPair(-1, 0), -1, row);
+                        place(tile_robber_slots[tile_id], row, TILE_ROW_WIDTH);
+                        place_path(coordinates + OrderedPair(1, 0), 1, row);
+                        break;
+                    case 4:
+                        // . ----- .
+                        place_plot(coordinates + OrderedPair(-1, -1), row);
+                        place_path(coordinates + OrderedPair(-1, -1), 0, row);
+                        place_plot(coordinates + OrderedPair(1, -1), row);
+                        break;
+                }
+            }
+        }
+    }
+
+    grid.assign(ROWS, {});
+    shown.assign(ROWS, {});
+    for (int row = 0; row < ROWS; row++) {
+        grid[row].assign(widths[row], RenderCell());
+        shown[row].assign(widths[row], UNSENT);
+    }
+    dirty_rows = (std::uint32_t(1) << ROWS) - 1;
+}
+
+void BoardRenderer::update(
+    const Board &board,
+    const bool show_tile_position_ids,
+    const vector<string> &highlighted_tiles) {
+
+    // Plots and paths whose owner changed
+    const BoardBitboards &bitboards = board.get_bitboards();
+    PlotMask changed_plots = updated ? 0 : ~PlotMask(0);
+    PathMask changed_paths = updated ? PathMask() : ~PathMask();
+    for (int color = 0; color < BoardBitboards::COLOR_COUNT; color++) {
+        player_color player = static_cast<player_color>(color);
+        changed_plots |= (bitboards.get_settlements(player) ^ settlements[color]) |
+            (bitboards.get_cities(player) ^ cities[color]);
+        changed_paths |= bitboards.get_roads(player) ^ roads[color];
+        settlements[color] = bitboards.get_settlements(player);
+        cities[color] = bitboards.get_cities(player);
+        roads[color] = bitboards.get_roads(player);
+    }
+
+    // and whose icon override changed
+    for (PlotId plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        string icon_override = board.get_plot_by_id(plot)->get_icon_override();
+        if (icon_override != plot_overrides[plot]) {
+            changed_plots |= PlotMask(1) << plot;
+            plot_overrides[plot] = icon_override;
+        }
+    }
+    for (PathId path = 0; path < StandardBoard::PATH_COUNT; path++) {
+        string icon_override = board.get_path_by_id(path)->get_icon_override();
+        if (icon_override != path_overrides[path]) {
+            changed_paths |= PathMask::bit(path);
+            path_overrides[path] = icon_override;
+        }
+    }
+
+    changed_plots &= (PlotMask(1) << StandardBoard::PLOT_COUNT) - 1;
+    while (changed_plots != 0) {
+        PlotId plot = lowest_bit(changed_plots);
+        changed_plots &= changed_plots - 1;
+        paint(plot_slots[plot], board.get_plot_by_id(plot)->get_icon());
+    }
+    while (changed_paths.any()) {
+        PathId path = changed_paths.first();
+        changed_paths ^= PathMask::bit(path);
+        if (path < StandardBoard::PATH_COUNT) {
+            paint(path_slots[path], board.get_path_by_id(path)->get_icon());
+        }
+    }
+
+    // Tiles with the robber, and tiles greyed out because others are highlighted
+    std::uint32_t robbed = 0, lowlit = 0;
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        if (board.get_tile_by_id(tile).has_robber()) {
+            robbed |= std::uint32_t(1) << tile;
+        }
+    }
+    if (!highlighted_tiles.empty()) {
+        lowlit = ALL_TILES;
+        for (const string &position_id : highlighted_tiles) {
+            TileId tile = board.get_tile_id(position_id);
+            if (tile != INVALID_ID) {
+                lowlit &= ~(std::uint32_t(1) << tile);
+            }
+        }
+    }
+
+    std::uint32_t changed_tops = !updated || show_tile_position_ids != tile_ids_shown ? ALL_TILES : 0;
+    std::uint32_t changed_mains = updated ? lowlit ^ lowlit_tiles : ALL_TILES;
+    std::uint32_t changed_robbers = updated ? robbed ^ robber_tiles : ALL_TILES;
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        std::uint32_t bit = std::uint32_t(1) << tile;
+        const Tile &current_tile = board.get_tile_by_id(tile);
+        if (changed_tops & bit) {
+            paint(tile_top_slots[tile], current_tile.get_top_display_row(show_tile_position_ids));
+        }
+        if (changed_mains & bit) {
+            paint(tile_main_slots[tile], current_tile.get_main_display_row((lowlit & bit) != 0));
+        }
+        if (changed_robbers & bit) {
+            paint(tile_robber_slots[tile], current_tile.get_robber_display_row());
+        }
+    }
+
+    robber_tiles = robbed;
+    lowlit_tiles = lowlit;
+    tile_ids_shown = show_tile_position_ids;
+    updated = true;
+}
+
+// Only SGR codes (ending in m) change a cell's style. Any other ANSI code in the text is dropped
+void BoardRenderer::paint(const Slot &slot, const string &text) {
+    if (slot.row == -1) {
+        return;
+    }
+
+    vector<RenderCell> &row = grid[slot.row];
+    string codes;
+    int column = 0;
+    for (std::size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '\033' && i + 1 < text.size() && text[i + 1] == '[') {
+            std::size_t end = i + 2;
+            while (end < text.size() && (text[end] < '@' || text[end] > '~')) {
+                end++;
+            }
+            if (end < text.size() && text[end] == 'm') {
+                string parameters = text.substr(i + 2, end - i - 2);
+                if (parameters.empty() || parameters == "0") {
+                    codes.clear();
+                } else {
+                    codes += text.substr(i, end - i + 1);
+                }
+            }
+            i = end;
+            continue;
+        }
+        if (column == slot.width) {
+            break;
+        }
+        RenderCell cell = {text[i], get_style(codes)};
+        if (row[slot.column + column] != cell) {
+            row[slot.column + column] = cell;
+            dirty_rows |= std::uint32_t(1) << slot.row;
+        }
+        column++;
+    }
+    for (; column < slot.width; column++) {
+        if (row[slot.column + column] != RenderCell()) {
+            row[slot.column + column] = RenderCell();
+            dirty_rows |= std::uint32_t(1) << slot.row;
+        }
+    }
+}
+
+// There are only a handful of styles on a board (the player colors, bold and grey), so a list is enough
+std::uint8_t BoardRenderer::get_style(const string &codes) {
+    for (std::size_t i = 0; i < styles.size(); i++) {
+        if (styles[i] == codes) {
+            return i;
+        }
+    }
+    if (styles.size() > UINT8_MAX) {
+        return 0;
+    }
+    styles.push_back(codes);
+    return styles.size() - 1;
+}
+
+void BoardRenderer::write_cells(const int row, const int first, const int last, ostream &out) const {
+    std::uint8_t style = 0;
+    for (int column = first; column <= last; column++) {
+        const RenderCell &cell = grid[row][column];
+        if (cell.style != style) {
+            if (style != 0) {
+                out << "\033[0m";
+            }
+            out << styles[cell.style];
+            style = cell.style;
+        }
+        out << cell.glyph;
+    }
+    if (style != 0) {
+        out << "\033[0m";
+    }
+}
+
+void BoardRenderer::draw(ostream &out) {
+    for (int row = 0; row < ROWS; row++) {
+        write_cells(row, 0, grid[row].size() - 1, out);
+        out << '\n';
+        shown[row] = grid[row];
+    }
+    dirty_rows = 0;
+}
+
+void BoardRenderer::draw_changes(ostream &out, const int first_row) {
+    if (dirty_rows == 0) {
+        return;
+    }
+
+    out << "\0337";
+    for (int row = 0; row < ROWS; row++) {
+        if ((dirty_rows & (std::uint32_t(1) << row)) == 0) {
+            continue;
+        }
+        const vector<RenderCell> &cells = grid[row];
+        const vector<RenderCell> &sent = shown[row];
+        int size = cells.size();
+        for (int column = 0; column < size; column++) {
+            if (cells[column] == sent[column]) {
+                continue;
+            }
+            int last = column;
+            for (int next = column + 1; next < size && next - last <= RUN_GAP; next++) {
+                if (cells[next] != sent[next]) {
+                    last = next;
+                }
+            }
+            out << "\033[" << first_row + row << ';' << column + 1 << 'H';
+            write_cells(row, column, last, out);
+            column = last;
+        }
+        shown[row] = cells;
+    }
+    out << "\0338";
+    dirty_rows = 0;
+}
+
+void BoardRenderer::forget_shown() {
+    for (vector<RenderCell> &row : shown) {
+        row.assign(row.size(), UNSENT);
+    }
+    dirty_rows = (std::uint32_t(1) << ROWS) - 1;
+}
+
+string BoardRenderer::get_row_text(const int row) const {
+    string text;
+    if (row < 0 || row >= ROWS) {
+        return text;
+    }
+    for (const RenderCell &cell : grid[row]) {
+        text += cell.glyph;
+    }
+    return text;
+}
+
+bool BoardRenderer::has_changes() const {
+    return dirty_rows != 0;
+}
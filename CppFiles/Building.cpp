@@ -5,15 +5,15 @@
 #include "../HeaderFiles/Building.h"
 #include "../HeaderFiles/Player.h"
 
-using std::map, std::shared_ptr, std::string;
+using std::shared_ptr, std::string;
 
-map<tile_type, int> Building::get_recipe() const {
+ResourceVector Building::get_recipe() const {
     if (type == SETTLEMENT) {
         return {{GRAIN, 1}, {WOOL, 1}, {ORE, 1}};
     } if (type == CITY) {
         return {{GRAIN, 1}, {WOOL, 1}, {ORE, 1}};
     }
-    return {{}};
+    return {};
 }
 
 Building::Building(
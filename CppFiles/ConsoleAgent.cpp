@@ -0,0 +1,93 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/ConsoleAgent.h"
+#include "../HeaderFiles/Board.h"
+#include "../HeaderFiles/Player.h"
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/InputFunctions.h"
+#include "../HeaderFiles/OutputSink.h"
+
+#include <iostream>
+
+using namespace std;
+
+PlotId ConsoleAgent::choose_initial_settlement(Board &board, const shared_ptr<Player> &player) {
+    // Can't quit, so a plot always comes back
+    return settlement_location_prompt(board, player, false, false)->get_id();
+}
+
+PathId ConsoleAgent::choose_initial_road(Board &board, const shared_ptr<Player> &, const PlotId settlement) {
+    game_output() << '\n';
+    board.display_board(false);
+    return placement_path_prompt(board, board.get_plot_by_id(settlement)->get_position_coordinates(), false)->get_id();
+}
+
+Action ConsoleAgent::choose_action(Board &board, const shared_ptr<Player> &player, const ActionList &) {
+    Action action;
+    string input;
+    while (true) {
+        game_output() << player->get_name() << ", what would you like to do?" << '\n';
+        game_output() << " [Pass]  [Trade]  [Craft]  [Devcard]  [Info]" << '\n';
+        getline(cin, input);
+        if (input.empty()) {
+            game_output() << "It seems you didn't enter anything" << '\n';
+            continue;
+        }
+        input = get_lowercase(input);
+        if (input == "quit") {
+            game_output() << "You cannot quit from this game state. Did you mean [Pass]?" << '\n';
+            continue;
+        }
+        if (input == "pass") {
+            action.type = PASS_TURN;
+            return action;
+        }
+        if (input == "trade" && trade_prompt(board, player, player->get_context().get_players(), action)) {
+            return action;
+        }
+        if (input == "craft" && craft_something_prompt(board, player, action)) {
+            return action;
+        }
+        if (input == "devcard") {
+            devcard_type type = devcard_choice_prompt(board, player, true);
+            if (type != CARD_EMPTY) {
+                action.type = PLAY_DEVCARD;
+                action.target = type;
+                return action;
+            }
+        }
+        if (input == "info") {
+            request_info_prompt(board, player, player->get_context().get_players());
+        }
+    }
+}
+
+PathId ConsoleAgent::choose_free_road(Board &board, const shared_ptr<Player> &player) {
+    shared_ptr<Path> path = road_location_prompt(board, player, true, false);
+    return path == nullptr ? INVALID_ID : path->get_id();
+}
+
+ResourceVector ConsoleAgent::choose_discard(Board &, const shared_ptr<Player> &player, const int number_of_resources) {
+    return discard_resources_prompt(player, number_of_resources);
+}
+
+TileId ConsoleAgent::choose_robber_tile(Board &board, const shared_ptr<Player> &player) {
+    return robber_tile_prompt(board, player);
+}
+
+player_color ConsoleAgent::choose_steal_target(Board &, const shared_ptr<Player> &player, const vector<player_color> &targets) {
+    return steal_target_prompt(player, targets);
+}
+
+tile_type ConsoleAgent::choose_resource(Board &, const shared_ptr<Player> &player, const devcard_type reason) {
+    // Year of Plenty takes from the bank, so only resources the bank still has can be chosen
+    return resource_choice_prompt(player, reason == YEAR_OF_PLENTY, false, false, {}, "");
+}
+
+bool ConsoleAgent::respond_to_trade(
+    Board &, const shared_ptr<Player> &player, const shared_ptr<Player> &proposer,
+    const ResourceVector &payment, const ResourceVector &gain) {
+    return trade_response_prompt(proposer, player, payment, gain);
+}
@@ -4,9 +4,9 @@
 
 #include "../HeaderFiles/Construct.h"
 
-using std::map, std::string, std::shared_ptr;
+using std::string, std::shared_ptr;
 
-Construct::Construct(shared_ptr<Player> _owner, map<tile_type, int> _recipe) : Craftable(_recipe){
+Construct::Construct(shared_ptr<Player> _owner, ResourceVector _recipe) : Craftable(_recipe){
     owner = _owner;
     color = owner->get_color();
 }
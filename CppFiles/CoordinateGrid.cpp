@@ -0,0 +1,61 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/CoordinateGrid.h"
+
+#include <algorithm>
+
+using std::vector, std::min, std::max;
+
+CoordinateGrid::CoordinateGrid() = default;
+
+void CoordinateGrid::expand_to(const OrderedPair &position) {
+    int new_min_x = width == 0 ? position.x : min(min_x, position.x);
+    int new_min_y = height == 0 ? position.y : min(min_y, position.y);
+    int new_max_x = width == 0 ? position.x : max(min_x + width - 1, position.x);
+    int new_max_y = height == 0 ? position.y : max(min_y + height - 1, position.y);
+    int new_width = new_max_x - new_min_x + 1;
+    int new_height = new_max_y - new_min_y + 1;
+
+    // Copy the old cells over to where they land in the bigger box
+    vector<int> new_cells(new_width * new_height, INVALID_ID);
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            int new_row = row + min_y - new_min_y;
+            int new_col = col + min_x - new_min_x;
+            new_cells[new_row * new_width + new_col] = cells[row * width + col];
+        }
+    }
+
+    min_x = new_min_x;
+    min_y = new_min_y;
+    width = new_width;
+    height = new_height;
+    cells.swap(new_cells);
+}
+
+void CoordinateGrid::set(const OrderedPair &position, const int id) {
+    if (position.x < min_x || position.x >= min_x + width ||
+        position.y < min_y || position.y >= min_y + height) {
+        expand_to(position);
+    }
+    cells[(position.y - min_y) * width + (position.x - min_x)] = id;
+}
+
+int CoordinateGrid::get(const OrderedPair &position) const {
+    int col = position.x - min_x;
+    int row = position.y - min_y;
+    if (col < 0 || col >= width || row < 0 || row >= height) {
+        return INVALID_ID;
+    }
+    return cells[row * width + col];
+}
+
+bool CoordinateGrid::contains(const OrderedPair &position) const {
+    return get(position) != INVALID_ID;
+}
+
+OrderedPair CoordinateGrid::edge_key(const OrderedPair &endpoint_a, const OrderedPair &endpoint_b) {
+    return endpoint_a + endpoint_b;
+}
@@ -6,15 +6,14 @@
 #include "../HeaderFiles/Player.h"
 #include "../HeaderFiles/Board.h"
 #include "../HeaderFiles/InputFunctions.h"
-#include "../HeaderFiles/GameBank.h"
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/OutputSink.h"
 
-#include <iostream>
 
-using std::cout, std::endl;
 using std::map, std::shared_ptr, std::string, std::vector;
 
-map<tile_type, int> DevCard::get_recipe() const {
-    return {{GRAIN, 1}, {WOOL, 1}, {ORE, 1}};
+ResourceVector DevCard::get_recipe() const {
+    return DEVCARD_RECIPE;
 }
 
 DevCard::DevCard(const devcard_type _type) : Craftable(get_recipe()) {
@@ -29,12 +28,12 @@ DevCard::DevCard() : Craftable(get_recipe()) {
 
 bool DevCard::test_playability(Board &board, shared_ptr<Player> player) {
     if (player->has_played_devcard_this_turn()) {
-        cout << player->get_name() << ", you can only play one Development Card per turn. " << endl;
-        false;
+        game_output() << player->get_name() << ", you can only play one Development Card per turn. " << '\n';
+        return false;
     }
 
     if (bought_this_turn) {
-        cout << "You may not play a Development Card on the same turn it was crafted. " << endl;
+        game_output() << "You may not play a Development Card on the same turn it was crafted. " << '\n';
         return false;
     }
     switch (type) {
@@ -42,107 +41,33 @@ bool DevCard::test_playability(Board &board, shared_ptr<Player> player) {
             return true;
         case ROAD_BUILDING:
             if (!board.can_place_road(player)) {
-                cout << player->get_name() << ", there are currently no places for you to place a road." << endl;
+                game_output() << player->get_name() << ", there are currently no places for you to place a road." << '\n';
                 return false;
             }
             return true;
         case YEAR_OF_PLENTY: {
             map<tile_type, string> valid_resources = get_resource_conversion_to_string();
-            for (auto &resource : GameBank::instance().get_available_resources()) {
-                if (resource.second <= 0) {
-                    valid_resources.erase(resource.first);
+            for (tile_type resource : RESOURCE_TYPES) {
+                if (!player->get_context().get_bank().has_resource(resource)) {
+                    valid_resources.erase(resource);
                 }
             }
             // If there are no resources to choose from, return
             if (valid_resources.empty()) {
-                cout << "There are currently no resources remaining to choose from." << endl;
+                game_output() << "There are currently no resources remaining to choose from." << '\n';
                 return false; }
             return true;
         }
         case MONOPOLY:
             return true;
         case VICTORY_POINT:
-            cout << "Victory Point cards are not to be played." << endl;
-            cout << "Their score is automatically added to your total as long as they are in your hand." << endl;
+            game_output() << "Victory Point cards are not to be played." << '\n';
+            game_output() << "Their score is automatically added to your total as long as they are in your hand." << '\n';
             return false;
     }
     return false;
 }
 
-void DevCard::play(Board &board, shared_ptr<Player> player) {
-    switch (type) {
-        case KNIGHT:
-            player->gain_knight();
-            robber_movement_prompt(board, player, true);
-            return;
-        case ROAD_BUILDING:
-            if (player->get_road_pieces() <= 0) {
-                cout << player->get_name() << ", you are out of road pieces. This card has no effect and is discarded." << endl;
-                return;
-            }
-            for (int i = 0; i < 2; i++) {
-                if (player->get_road_pieces() <= 0) {
-                    cout << player->get_name() << ", you are out of road pieces and therefore are unable to place any more roads. " << endl;
-                    return;
-                }
-                if (!board.can_place_road(player)) {
-                    cout << player->get_name() << ", there is currently no place for you to place a road. " << endl;
-                    return;
-                }
-                vector<string> numbers = {"first", "second"};
-                cout << player->get_name() << ", placing " << numbers[i] << " road..." << endl;
-                place_road(board, player, true, false, false);
-            }
-            return;
-        case YEAR_OF_PLENTY: {
-            // Prompt for resource 1
-            tile_type resource_1 = resource_choice_prompt(player, true, false);
-            if (resource_1 == TILE_EMPTY) {
-                // If there are NO resources left at all, return
-                return;
-            }
-            // prompt for resource 2
-            tile_type resource_2 = resource_choice_prompt(player, true, false);
-            if (resource_1 == resource_2) {
-                // If they are the same, give them both to the player all at once
-                player->gain_many_resources({{resource_1, 2}}, true);
-                return;
-            }
-            if (resource_2 == TILE_EMPTY) {
-                // If resource 2 is TILE_EMPTY, meaning there was only one resource left at the time of playing this devcard, just gain resource 1
-                player->gain_many_resources({{resource_1, 1}}, true);
-                return;
-            }
-            // Otherwise, just gain both resources choses as normal
-            player->gain_many_resources({{resource_1, 1}, {resource_2, 1}}, true);
-            return;
-            }
-        case MONOPOLY: {
-            tile_type resource = resource_choice_prompt(player, false, false);
-            int transfer_count = 0;
-            for (auto &player_pair : GameBank::instance().get_players()) {
-                int local_count = 0;
-                if (player_pair.second == player) {
-                    continue;
-                }
-                if (!player_pair.second->has_resource(resource)) {
-                    continue;
-                }
-                local_count += player_pair.second->get_resources().at(resource);
-                transfer_count += local_count;
-                player_pair.second->discard_many_resources({{resource, local_count}}, "lost", false);
-            }
-
-            int previous_count = player->get_number_of_resources();
-            player->gain_many_resources({{resource, transfer_count}}, false);
-            if (previous_count == player->get_number_of_resources()) {
-                cout << "Sorry, nobody had any " << get_resource_conversion_to_string(true).at(resource) << " to steal.\n" << endl;
-            }
-            return;
-        }
-    }
-}
-
 bool DevCard::is_valid() const {
     return type != CARD_EMPTY;
 }
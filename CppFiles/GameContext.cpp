@@ -0,0 +1,146 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/Player.h"
+#include "../HeaderFiles/InputFunctions.h"
+#include "../HeaderFiles/OutputSink.h"
+
+
+using std::shared_ptr, std::make_shared, std::vector, std::map, std::string;
+
+GameContext::GameContext(const int _player_count, const std::uint64_t _seed) : seed(_seed), random(_seed), player_count(_player_count) {
+    board_random = random.split();
+    dice_random = random.split();
+    deck_random = random.split();
+
+    bool print_player_setup = false;
+    if (player_count == 0) {
+        player_count = player_count_prompt();
+        print_player_setup = true;
+    }
+    setup_players(print_player_setup);
+}
+
+GameBank& GameContext::get_bank() {
+    return bank;
+}
+
+const GameBank& GameContext::get_bank() const {
+    return bank;
+}
+
+GameRandom& GameContext::get_random() {
+    return random;
+}
+
+GameRandom& GameContext::get_board_random() {
+    return board_random;
+}
+
+GameRandom& GameContext::get_dice_random() {
+    return dice_random;
+}
+
+GameRandom& GameContext::get_deck_random() {
+    return deck_random;
+}
+
+std::uint64_t GameContext::get_seed() const {
+    return seed;
+}
+
+void GameContext::set_log(GameLogWriter *_log) {
+    log = _log;
+}
+
+GameLogWriter* GameContext::get_log() const {
+    return log;
+}
+
+void GameContext::toggle_hand_hash(const std::uint64_t keys) {
+    hand_hash ^= keys;
+}
+
+std::uint64_t GameContext::get_hash() const {
+    return hand_hash ^ bank.get_hash();
+}
+
+int GameContext::get_player_count() const {
+    return player_count;
+}
+
+const map<int, shared_ptr<Player>>& GameContext::get_players() const {
+    return players;
+}
+
+shared_ptr<Player> GameContext::get_player(string color) const{
+    // Conversion from string to color
+    map<string, player_color> conversion =
+        {{"red", RED}, {"yellow", YELLOW},
+        {"green", GREEN}, {"blue", BLUE}};
+    color = get_lowercase(color);
+    // If the enetered color is valid or not
+    bool valid_color = false;
+    for (string valid : {"red", "yellow", "green", "blue"}) {
+        if (color == valid) {
+            valid_color = true;
+        }
+    }
+    if (!valid_color) {
+        return nullptr;
+    }
+    // Actuall retrieval
+    for (auto &player : players) {
+        if (player.second->get_color() == conversion.at(color)) {
+            return player.second;
+        }
+    }
+    return nullptr;
+}
+
+shared_ptr<Player> GameContext::get_player(const player_color color) const{
+    if (color < 0 || color >= ScoreTracker::COLOR_COUNT) {
+        return nullptr;
+    }
+    return players_by_color[color];
+}
+
+shared_ptr<Player> GameContext::get_player(const int player_index) const {
+    // Manually search incase an invalid index is provided
+    for (auto &player : players) {
+        if (player.first == player_index) {
+            return player.second;
+        }
+    }
+    return nullptr;
+}
+
+shared_ptr<Player> GameContext::get_longest_road_player() const {
+    return get_player(score_tracker.get_longest_road_holder());
+}
+
+shared_ptr<Player> GameContext::get_largest_army_player() const {
+    return get_player(score_tracker.get_largest_army_holder());
+}
+
+ScoreTracker& GameContext::get_score_tracker() {
+    return score_tracker;
+}
+
+const ScoreTracker& GameContext::get_score_tracker() const {
+    return score_tracker;
+}
+
+void GameContext::setup_players(const bool print){
+    for (int i = 0; i < player_count; i++) {
+        vector<player_color> colors = {RED, YELLOW, GREEN, BLUE};
+        shared_ptr<Player> new_player = make_shared<Player>(i + 1, colors[i], *this);
+        players.insert({i + 1, new_player});
+        players_by_color[colors[i]] = new_player;
+        if (print) {
+            game_output() << "Player " << i + 1 << " will be " << Player::get_color_as_text(colors[i]) << "." << '\n';
+        }
+    }
+}
@@ -0,0 +1,466 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/GameEngine.h"
+#include "../HeaderFiles/Board.h"
+#include "../HeaderFiles/Player.h"
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/GameLog.h"
+#include "../HeaderFiles/Building.h"
+#include "../HeaderFiles/Road.h"
+#include "../HeaderFiles/InputFunctions.h"
+#include "../HeaderFiles/ProductionTable.h"
+#include "../HeaderFiles/Zobrist.h"
+#include "../HeaderFiles/OutputSink.h"
+#include "../HeaderFiles/Instrumentation.h"
+
+
+using namespace std;
+
+GameEngine::GameEngine(
+    Board &_board, GameContext &_context,
+    const map<player_color, shared_ptr<Agent>> &_agents, const bool _print)
+    : board(_board), context(_context), agents(_agents), print(_print) {
+
+    for (auto &player : context.get_players()) {
+        turn_order.push_back(player.second);
+    }
+}
+
+Agent& GameEngine::get_agent(const shared_ptr<Player> &player) const {
+    return *agents.at(player->get_color());
+}
+
+void GameEngine::setup() {
+    INSTRUMENT_SCOPE("GameEngine::setup");
+    if (setup_done) {
+        return;
+    }
+    for (size_t i = 0; i < turn_order.size(); i++) {
+        place_initial(turn_order[i], false);
+    }
+    for (int i = turn_order.size() - 1; i >= 0; i--) {
+        place_initial(turn_order[i], true);
+    }
+    setup_done = true;
+    flush_game_output();
+}
+
+void GameEngine::place_initial(const shared_ptr<Player> &player, const bool gain_adjacent_resources) {
+    const BoardBitboards &bitboards = board.get_bitboards();
+
+    PlotMask plots = bitboards.get_buildable_plots(player->get_color(), false);
+    if (plots == 0) {
+        return;
+    }
+    PlotId plot = get_agent(player).choose_initial_settlement(board, player);
+    if (plot < 0 || plot >= 64 || ((plots >> plot) & 1) == 0) {
+        plot = lowest_bit(plots);
+    }
+    record(EVENT_SETUP_SETTLEMENT, player->get_color(), plot);
+    board.get_plot_by_id(plot)->set_inhabitant(Building(player, SETTLEMENT));
+    player->incdec_settlement_pieces(-1);
+    // The settlement may have broken an opponent's road
+    board.report_road_lengths(print);
+
+    if (gain_adjacent_resources) {
+        ResourceVector resources_gained;
+        for (TileId tile : board.get_graph().get_plot_tiles(plot)) {
+            if (tile == INVALID_ID) {
+                continue;
+            }
+            tile_type resource = board.get_tile_by_id(tile).get_type();
+            if (resource != DESERT && resource != TILE_EMPTY) {
+                resources_gained.add(resource, 1);
+            }
+        }
+        player->gain_many_resources(resources_gained, true, print);
+    }
+
+    PathMask paths = bitboards.get_plot_paths(plot) & ~bitboards.get_occupied_paths();
+    if (!paths.any()) {
+        return;
+    }
+    PathId path = get_agent(player).choose_initial_road(board, player, plot);
+    if (path < 0 || path >= 128 || !paths.test(path)) {
+        path = paths.first();
+    }
+    place_road(player, path, true);
+    shared_ptr<Path> road_path = board.get_path_by_id(path);
+    player->add_initial_road_anchor(
+        road_path->get_endpoints().plot_a->get_position_coordinates(),
+        road_path->get_endpoints().plot_b->get_position_coordinates());
+
+    if (print) {
+        game_output() << '\n';
+        board.display_board(false);
+    }
+}
+
+void GameEngine::place_road(const shared_ptr<Player> &player, const PathId path, const bool initial) {
+    record(initial ? EVENT_SETUP_ROAD : EVENT_ROAD, player->get_color(), path);
+    board.get_path_by_id(path)->set_inhabitant(Road(player));
+    player->incdec_road_pieces(-1);
+    board.report_road_lengths(print);
+}
+
+void GameEngine::resume(const GameState &state) {
+    turn_index = 0;
+    for (size_t i = 0; i < turn_order.size(); i++) {
+        if (turn_order[i]->get_color() == state.current_player) {
+            turn_index = i;
+        }
+    }
+    turn_count = state.turn_count;
+    setup_done = !state.in_setup;
+    winner = static_cast<player_color>(state.winner);
+}
+
+void GameEngine::play_turn(const int roll_override) {
+    INSTRUMENT_SCOPE("GameEngine::play_turn");
+    if (turn_order.empty() || winner != COLOR_EMPTY) {
+        return;
+    }
+    shared_ptr<Player> player = turn_order[turn_index];
+    player->start_new_turn();
+    record(EVENT_TURN_START, player->get_color(), 0);
+
+    int roll = roll_override;
+    if (roll < 2 || roll > 12) {
+        GameRandom &dice = context.get_dice_random();
+        roll = (dice.next_int(6) + 1) + (dice.next_int(6) + 1);
+    }
+    record(EVENT_ROLL, player->get_color(), roll);
+    if (print) {
+        game_output() << "--------------------------------------------------------" << '\n';
+        game_output() << "\nThe Dice have rolled a " << roll << "\n" << '\n';
+    }
+    if (roll == 7) {
+        seven_rolled(player);
+    } else {
+        board.generate_resources(roll, print);
+    }
+
+    if (print) {
+        game_output() << "\n" << player->get_name() << ", it is your turn." << '\n';
+    }
+    Agent &agent = get_agent(player);
+    for (int i = 0; i < MAX_ACTIONS_PER_TURN && winner == COLOR_EMPTY; i++) {
+        LegalActionGenerator::generate(board, *player, context.get_bank(), legal_actions);
+        Action action = agent.choose_action(board, player, legal_actions);
+        if (action.type == PASS_TURN) {
+            break;
+        }
+        if (!apply_action(player, action) && print) {
+            game_output() << "That isn't possible right now." << '\n';
+        }
+    }
+    // A player can only win on their own turn
+    check_winner(player);
+
+    turn_count++;
+    turn_index = (turn_index + 1) % turn_order.size();
+    // Everything printed during the turn goes to the terminal in one write
+    flush_game_output();
+}
+
+player_color GameEngine::play_game(const int max_turns) {
+    setup();
+    while (winner == COLOR_EMPTY && turn_count < max_turns) {
+        play_turn();
+    }
+    return winner;
+}
+
+void GameEngine::seven_rolled(const shared_ptr<Player> &player) {
+    for (const shared_ptr<Player> &discarder : turn_order) {
+        int total_resource_cards = discarder->get_number_of_resources();
+        if (total_resource_cards <= 7) {
+            if (print) {
+                game_output() << discarder->get_name() << " has less than or equal to 7 resource cards, so they are safe." << '\n';
+            }
+            continue;
+        }
+        if (print) {
+            game_output() << discarder->get_name() << ", you have more than seven resource cards, and must discard half of them" << '\n';
+        }
+        int number_to_discard = total_resource_cards / 2;
+        ResourceVector discard = get_agent(discarder).choose_discard(board, discarder, number_to_discard);
+
+        // The discard has to add up and come out of the player's hand, otherwise the first cards in hand go
+        if (!discarder->get_resources().covers(discard) || discard.get_total() != number_to_discard) {
+            discard = ResourceVector();
+            int remaining = number_to_discard;
+            for (tile_type resource : RESOURCE_TYPES) {
+                int count = min(remaining, discarder->get_amount_of_resource(resource));
+                discard.set(resource, count);
+                remaining -= count;
+            }
+        }
+        discarder->discard_many_resources(discard, "discarded", true, print);
+    }
+    move_robber(player);
+}
+
+void GameEngine::move_robber(const shared_ptr<Player> &player) {
+    const BoardGraph &graph = board.get_graph();
+    const BoardBitboards &bitboards = board.get_bitboards();
+    TileId robber_tile = bitboards.get_production_table().get_robber_tile();
+
+    TileId tile = get_agent(player).choose_robber_tile(board, player);
+    if (!graph.is_tile(tile) || tile == robber_tile) {
+        tile = robber_tile == 0 ? 1 : 0;
+    }
+    record(EVENT_ROBBER, player->get_color(), tile);
+    board.set_robber_position(board.get_tile_by_id(tile).get_position_id());
+    if (print) {
+        board.display_board(false);
+    }
+
+    PlotMask tile_plots = 0;
+    for (PlotId plot : graph.get_tile_plots(tile)) {
+        if (plot != INVALID_ID) {
+            tile_plots |= PlotMask(1) << plot;
+        }
+    }
+    vector<player_color> targets;
+    for (const shared_ptr<Player> &other : turn_order) {
+        if (other != player && (bitboards.get_buildings(other->get_color()) & tile_plots) != 0) {
+            targets.push_back(other->get_color());
+        }
+    }
+    if (targets.empty()) {
+        if (print) {
+            game_output() << "Sorry " << player->get_name() << ". There are no adjacent players to steal from." << '\n';
+        }
+        return;
+    }
+
+    player_color target_color = get_agent(player).choose_steal_target(board, player, targets);
+    shared_ptr<Player> target = context.get_player(targets.front());
+    for (player_color color : targets) {
+        if (color == target_color) {
+            target = context.get_player(color);
+        }
+    }
+
+    tile_type chosen_resource = target->get_random_resource();
+    if (chosen_resource == TILE_EMPTY) {
+        if (print) {
+            game_output() << "Bummer..." << target->get_name() << " does not have any resources to steal." << '\n';
+        }
+        return;
+    }
+    target->discard_many_resources({{chosen_resource, 1}}, "lost", false, print);
+    player->gain_many_resources({{chosen_resource, 1}}, false, print);
+}
+
+bool GameEngine::is_legal(const Action &action) const {
+    for (const Action &legal : legal_actions) {
+        if (legal.type == action.type && legal.target == action.target && legal.give == action.give &&
+            legal.give_amount == action.give_amount && legal.receive == action.receive) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GameEngine::apply_action(const shared_ptr<Player> &player, const Action &action) {
+    LegalActionGenerator::generate(board, *player, context.get_bank(), legal_actions);
+    if (!is_legal(action)) {
+        return false;
+    }
+
+    switch (action.type) {
+        case PASS_TURN:
+            return true;
+        case BUILD_SETTLEMENT:
+            player->discard_many_resources(Craftable::SETTLEMENT_RECIPE, "spent", true, print);
+            record(EVENT_SETTLEMENT, player->get_color(), action.target);
+            board.get_plot_by_id(action.target)->set_inhabitant(Building(player, SETTLEMENT));
+            player->incdec_settlement_pieces(-1);
+            // The settlement may have broken an opponent's road
+            board.report_road_lengths(print);
+            break;
+        case BUILD_CITY:
+            player->discard_many_resources(Craftable::CITY_RECIPE, "spent", true, print);
+            record(EVENT_CITY, player->get_color(), action.target);
+            board.get_plot_by_id(action.target)->upgrade_inhabitant();
+            player->incdec_city_pieces(-1);
+            player->incdec_settlement_pieces(1);
+            break;
+        case BUILD_ROAD:
+            player->discard_many_resources(Craftable::ROAD_RECIPE, "spent", true, print);
+            place_road(player, action.target);
+            break;
+        case BUY_DEVCARD: {
+            player->discard_many_resources(Craftable::DEVCARD_RECIPE, "spent", true, print);
+            DevCard card = context.get_bank().draw_devcard(context.get_deck_random());
+            if (card.is_valid()) {
+                record(EVENT_BUY_DEVCARD, player->get_color(), card.get_type());
+            }
+            player->gain_devcard(card, print);
+            break;
+        }
+        case PLAY_DEVCARD:
+            play_devcard(player, static_cast<devcard_type>(action.target));
+            break;
+        case MARITIME_TRADE:
+            player->discard_many_resources({{action.give, action.give_amount}}, "traded away", true, print);
+            player->gain_many_resources({{action.receive, 1}}, true, print);
+            break;
+    }
+
+    if (print && (action.type == BUILD_SETTLEMENT || action.type == BUILD_CITY || action.type == BUILD_ROAD)) {
+        game_output() << '\n';
+        board.display_board(false);
+    }
+    check_winner(player);
+    return true;
+}
+
+void GameEngine::play_devcard(const shared_ptr<Player> &player, const devcard_type type) {
+    if (!player->play_devcard(type)) {
+        return;
+    }
+    record(EVENT_PLAY_DEVCARD, player->get_color(), type);
+    Agent &agent = get_agent(player);
+    const BoardBitboards &bitboards = board.get_bitboards();
+
+    switch (type) {
+        case KNIGHT:
+            player->gain_knight(print);
+            move_robber(player);
+            return;
+        case ROAD_BUILDING:
+            for (int i = 0; i < 2; i++) {
+                PathMask paths = bitboards.get_buildable_paths(player->get_color(), true);
+                if (player->get_road_pieces() <= 0 || !paths.any()) {
+                    if (print) {
+                        game_output() << player->get_name() << ", there is no road left for you to place. " << '\n';
+                    }
+                    return;
+                }
+                PathId path = agent.choose_free_road(board, player);
+                if (path < 0 || path >= 128 || !paths.test(path)) {
+                    path = paths.first();
+                }
+                place_road(player, path);
+                if (print) {
+                    game_output() << '\n';
+                    board.display_board(false);
+                }
+            }
+            return;
+        case YEAR_OF_PLENTY:
+            for (int i = 0; i < 2; i++) {
+                tile_type resource = agent.choose_resource(board, player, YEAR_OF_PLENTY);
+                if (resource < GRAIN || resource > LUMBER || !context.get_bank().has_resource(resource)) {
+                    resource = TILE_EMPTY;
+                    for (tile_type option : RESOURCE_TYPES) {
+                        if (resource == TILE_EMPTY && context.get_bank().has_resource(option)) {
+                            resource = option;
+                        }
+                    }
+                }
+                // If there are NO resources left at all, the card does nothing more
+                if (resource == TILE_EMPTY) {
+                    return;
+                }
+                player->gain_many_resources({{resource, 1}}, true, print);
+            }
+            return;
+        case MONOPOLY: {
+            tile_type resource = agent.choose_resource(board, player, MONOPOLY);
+            if (resource < GRAIN || resource > LUMBER) {
+                resource = GRAIN;
+            }
+            int transfer_count = 0;
+            for (const shared_ptr<Player> &other : turn_order) {
+                int local_count = other->get_amount_of_resource(resource);
+                if (other == player || local_count <= 0) {
+                    continue;
+                }
+                transfer_count += local_count;
+                other->discard_many_resources({{resource, local_count}}, "lost", false, print);
+            }
+            if (transfer_count > 0) {
+                player->gain_many_resources({{resource, transfer_count}}, false, print);
+            } else if (print) {
+                game_output() << "Sorry, nobody had any " << get_resource_conversion_to_string(true).at(resource) << " to steal.\n" << '\n';
+            }
+            return;
+        }
+        default:
+            return;
+    }
+}
+
+bool GameEngine::offer_trade(
+    const shared_ptr<Player> &proposer, const shared_ptr<Player> &target,
+    const ResourceVector &payment, const ResourceVector &gain) {
+
+    if (proposer == target || !proposer->can_afford(payment, false) || !target->can_afford(gain, false)) {
+        return false;
+    }
+    if (!get_agent(target).respond_to_trade(board, target, proposer, payment, gain)) {
+        return false;
+    }
+
+    proposer->discard_many_resources(payment, "traded away", false, print);
+    target->gain_many_resources(payment, false, print);
+    target->discard_many_resources(gain, "traded away", false, print);
+    proposer->gain_many_resources(gain, false, print);
+    return true;
+}
+
+void GameEngine::check_winner(const shared_ptr<Player> &player) {
+    if (winner == COLOR_EMPTY && player->get_points(board) >= ScoreTracker::WINNING_POINTS) {
+        winner = player->get_color();
+        record(EVENT_WINNER, winner, 0);
+    }
+}
+
+void GameEngine::record(const game_event_type type, const player_color color, const int target) const {
+    if (context.get_log() != nullptr) {
+        context.get_log()->append(type, color, target);
+    }
+}
+
+GameState GameEngine::get_state() const {
+    GameState state = GameState::capture(board, context);
+    if (!turn_order.empty()) {
+        state.current_player = turn_order[turn_index]->get_color();
+    }
+    state.in_setup = !setup_done;
+    state.winner = winner;
+    state.turn_count = turn_count;
+    return state;
+}
+
+uint64_t GameEngine::get_hash() const {
+    // The board and the context hash themselves as they change, only whose turn it is is hashed here
+    const ZobristKeys &keys = ZobristKeys::get();
+    uint64_t hash = board.get_bitboards().get_hash() ^ context.get_hash();
+    hash ^= keys.turn_key(turn_order.empty() ? RED : turn_order[turn_index]->get_color());
+    if (!setup_done) {
+        hash ^= keys.setup_key();
+    }
+    return hash;
+}
+
+shared_ptr<Player> GameEngine::get_current_player() const {
+    if (turn_order.empty()) {
+        return nullptr;
+    }
+    return turn_order[turn_index];
+}
+
+int GameEngine::get_turn_count() const {
+    return turn_count;
+}
+
+player_color GameEngine::get_winner() const {
+    return winner;
+}
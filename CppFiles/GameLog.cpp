@@ -0,0 +1,408 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/GameLog.h"
+#include "../HeaderFiles/Board.h"
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/Building.h"
+#include "../HeaderFiles/Road.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using std::string, std::map, std::shared_ptr;
+
+static const char MAGIC[4] = {'H', 'X', 'L', 'G'};
+
+// Where each field of the header starts
+static const int VERSION_OFFSET = 4;
+static const int PLAYER_COUNT_OFFSET = 6;
+static const int SEED_OFFSET = 8;
+static const int TILE_TYPES_OFFSET = 16;
+static const int TILE_NUMBERS_OFFSET = TILE_TYPES_OFFSET + StandardBoard::TILE_COUNT;
+static const int PORT_TYPES_OFFSET = TILE_NUMBERS_OFFSET + StandardBoard::TILE_COUNT;
+
+static_assert(PORT_TYPES_OFFSET + StandardBoard::PORT_COUNT <= GameLogHeader::SIZE, "the header fits in SIZE bytes");
+
+GameLogHeader GameLogHeader::describe(const Board &board, const GameContext &context) {
+    GameLogHeader header;
+    header.player_count = static_cast<std::uint8_t>(context.get_player_count());
+    header.seed = context.get_seed();
+    BoardLayout layout = board.get_layout();
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        header.tile_types[tile] = static_cast<std::uint8_t>(layout.tile_types[tile]);
+        header.tile_numbers[tile] = static_cast<std::int8_t>(layout.tile_numbers[tile]);
+    }
+    for (int port = 0; port < StandardBoard::PORT_COUNT; port++) {
+        header.port_types[port] = static_cast<std::uint8_t>(layout.port_types[port]);
+    }
+    return header;
+}
+
+void GameLogHeader::encode(std::uint8_t *bytes) const {
+    std::memset(bytes, 0, SIZE);
+    std::memcpy(bytes, MAGIC, sizeof(MAGIC));
+    bytes[VERSION_OFFSET] = version & 0xFF;
+    bytes[VERSION_OFFSET + 1] = version >> 8;
+    bytes[PLAYER_COUNT_OFFSET] = player_count;
+    for (int i = 0; i < 8; i++) {
+        bytes[SEED_OFFSET + i] = static_cast<std::uint8_t>(seed >> (8 * i));
+    }
+    for (int tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        bytes[TILE_TYPES_OFFSET + tile] = tile_types[tile];
+        bytes[TILE_NUMBERS_OFFSET + tile] = static_cast<std::uint8_t>(tile_numbers[tile]);
+    }
+    for (int port = 0; port < StandardBoard::PORT_COUNT; port++) {
+        bytes[PORT_TYPES_OFFSET + port] = port_types[port];
+    }
+}
+
+bool GameLogHeader::decode(const std::uint8_t *bytes) {
+    if (std::memcmp(bytes, MAGIC, sizeof(MAGIC)) != 0) {
+        return false;
+    }
+    version = bytes[VERSION_OFFSET] | (bytes[VERSION_OFFSET + 1] << 8);
+    if (version != VERSION) {
+        return false;
+    }
+    player_count = bytes[PLAYER_COUNT_OFFSET];
+    seed = 0;
+    for (int i = 0; i < 8; i++) {
+        seed |= static_cast<std::uint64_t>(bytes[SEED_OFFSET + i]) << (8 * i);
+    }
+    // The layout makes a board, so anything which isn't a tile or a port is refused
+    for (int tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        tile_types[tile] = bytes[TILE_TYPES_OFFSET + tile];
+        tile_numbers[tile] = static_cast<std::int8_t>(bytes[TILE_NUMBERS_OFFSET + tile]);
+        if (tile_types[tile] >= TILE_EMPTY) {
+            return false;
+        }
+    }
+    for (int port = 0; port < StandardBoard::PORT_COUNT; port++) {
+        port_types[port] = bytes[PORT_TYPES_OFFSET + port];
+        if (port_types[port] == DESERT || port_types[port] > TILE_EMPTY) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool GameLogHeader::matches(const Board &board) const {
+    BoardLayout layout = board.get_layout();
+    BoardLayout logged = get_layout();
+    return layout.tile_types == logged.tile_types && layout.tile_numbers == logged.tile_numbers &&
+        layout.port_types == logged.port_types;
+}
+
+BoardLayout GameLogHeader::get_layout() const {
+    BoardLayout layout;
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        layout.tile_types[tile] = static_cast<tile_type>(tile_types[tile]);
+        layout.tile_numbers[tile] = tile_numbers[tile];
+    }
+    for (int port = 0; port < StandardBoard::PORT_COUNT; port++) {
+        layout.port_types[port] = static_cast<tile_type>(port_types[port]);
+    }
+    return layout;
+}
+
+GameLogWriter::GameLogWriter() {
+    buffer.reserve(BUFFER_SIZE);
+}
+
+GameLogWriter::~GameLogWriter() {
+    close();
+}
+
+bool GameLogWriter::open(const string &path, const GameLogHeader &header) {
+    close();
+    file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    buffer.clear();
+    event_count = 0;
+    failed = false;
+
+    buffer.resize(GameLogHeader::SIZE);
+    header.encode(buffer.data());
+    return flush();
+}
+
+void GameLogWriter::append(const game_event_type type, const player_color color, const int target, const int amount) {
+    if (file == nullptr) {
+        return;
+    }
+    if (buffer.size() + sizeof(GameEvent) > BUFFER_SIZE) {
+        flush();
+    }
+    buffer.push_back(static_cast<std::uint8_t>(type));
+    buffer.push_back(static_cast<std::uint8_t>(color));
+    buffer.push_back(static_cast<std::uint8_t>(target));
+    // No pile of resources in the game is bigger than a byte
+    buffer.push_back(static_cast<std::uint8_t>(std::min(amount, 255)));
+    event_count++;
+}
+
+bool GameLogWriter::flush() {
+    if (file == nullptr) {
+        return false;
+    }
+    if (!buffer.empty() && std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) {
+        failed = true;
+    }
+    buffer.clear();
+    if (std::fflush(file) != 0) {
+        failed = true;
+    }
+    return !failed;
+}
+
+bool GameLogWriter::close() {
+    if (file == nullptr) {
+        return false;
+    }
+    bool written = flush();
+    written = std::fclose(file) == 0 && written;
+    file = nullptr;
+    return written;
+}
+
+bool GameLogWriter::is_open() const {
+    return file != nullptr;
+}
+
+std::size_t GameLogWriter::get_event_count() const {
+    return event_count;
+}
+
+GameLogReader::~GameLogReader() {
+    close();
+}
+
+bool GameLogReader::open(const string &path) {
+    close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < GameLogHeader::SIZE) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE view = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (view == nullptr) {
+        return false;
+    }
+    void *bytes = MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+    if (bytes == nullptr) {
+        CloseHandle(view);
+        return false;
+    }
+    mapping = view;
+    size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(file, &file_stat) != 0 || file_stat.st_size < GameLogHeader::SIZE) {
+        ::close(file);
+        return false;
+    }
+    void *bytes = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    // The mapping stays valid after the file is closed
+    ::close(file);
+    if (bytes == MAP_FAILED) {
+        return false;
+    }
+    // Replays read the events once, front to back
+    madvise(bytes, file_stat.st_size, MADV_SEQUENTIAL);
+    size = static_cast<std::size_t>(file_stat.st_size);
+#endif
+    data = static_cast<const std::uint8_t*>(bytes);
+
+    if (!header.decode(data)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void GameLogReader::close() {
+    if (data == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(static_cast<HANDLE>(mapping));
+#else
+    munmap(const_cast<std::uint8_t*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+    mapping = nullptr;
+}
+
+const GameLogHeader& GameLogReader::get_header() const {
+    return header;
+}
+
+std::size_t GameLogReader::get_event_count() const {
+    if (data == nullptr) {
+        return 0;
+    }
+    return (size - GameLogHeader::SIZE) / sizeof(GameEvent);
+}
+
+const GameEvent* GameLogReader::begin() const {
+    if (data == nullptr) {
+        return nullptr;
+    }
+    // Every field of an event is a byte, so the events can be read in place
+    return reinterpret_cast<const GameEvent*>(data + GameLogHeader::SIZE);
+}
+
+const GameEvent* GameLogReader::end() const {
+    return begin() + get_event_count();
+}
+
+GameLogReplayer::GameLogReplayer(Board &_board, GameContext &_context) : board(_board), context(_context) {}
+
+bool GameLogReplayer::apply(const GameEvent &event) {
+    shared_ptr<Player> player = context.get_player(static_cast<player_color>(event.color));
+    if (event.type >= EVENT_TYPE_COUNT || event.color >= ScoreTracker::COLOR_COUNT || player == nullptr) {
+        return false;
+    }
+    const BoardGraph &graph = board.get_graph();
+    const BoardBitboards &bitboards = board.get_bitboards();
+    player_color color = player->get_color();
+    tile_type resource = static_cast<tile_type>(event.target);
+    devcard_type devcard = static_cast<devcard_type>(event.target);
+
+    switch (event.type) {
+        case EVENT_TURN_START:
+            player->start_new_turn();
+            return true;
+        case EVENT_ROLL:
+            // What the roll produced is logged as the resources each player gained
+            return event.target >= 2 && event.target <= 12;
+        case EVENT_SETUP_SETTLEMENT:
+        case EVENT_SETTLEMENT:
+            if (!graph.is_plot(event.target) || ((bitboards.get_occupied_plots() >> event.target) & 1) != 0) {
+                return false;
+            }
+            board.get_plot_by_id(event.target)->set_inhabitant(Building(player, SETTLEMENT));
+            player->incdec_settlement_pieces(-1);
+            board.report_road_lengths(false);
+            return true;
+        case EVENT_CITY:
+            if (!graph.is_plot(event.target) || ((bitboards.get_settlements(color) >> event.target) & 1) == 0) {
+                return false;
+            }
+            board.get_plot_by_id(event.target)->upgrade_inhabitant();
+            player->incdec_city_pieces(-1);
+            player->incdec_settlement_pieces(1);
+            return true;
+        case EVENT_SETUP_ROAD:
+        case EVENT_ROAD: {
+            if (!graph.is_path(event.target) || bitboards.get_occupied_paths().test(event.target)) {
+                return false;
+            }
+            shared_ptr<Path> path = board.get_path_by_id(event.target);
+            path->set_inhabitant(Road(player));
+            player->incdec_road_pieces(-1);
+            board.report_road_lengths(false);
+            if (event.type == EVENT_SETUP_ROAD) {
+                player->add_initial_road_anchor(
+                    path->get_endpoints().plot_a->get_position_coordinates(),
+                    path->get_endpoints().plot_b->get_position_coordinates());
+            }
+            return true;
+        }
+        case EVENT_BUY_DEVCARD: {
+            // The deck was shuffled by the game's random numbers, so the card drawn is taken out by its type
+            DevCard card = context.get_bank().take_devcard(devcard);
+            if (!card.is_valid()) {
+                return false;
+            }
+            player->gain_devcard(card, false);
+            return true;
+        }
+        case EVENT_PLAY_DEVCARD:
+            if (!player->play_devcard(devcard)) {
+                return false;
+            }
+            if (devcard == KNIGHT) {
+                player->gain_knight(false);
+            }
+            return true;
+        case EVENT_ROBBER:
+            if (!graph.is_tile(event.target)) {
+                return false;
+            }
+            board.set_robber_position(board.get_tile_by_id(event.target).get_position_id());
+            return true;
+        case EVENT_GAIN_FROM_BANK:
+        case EVENT_GAIN:
+        case EVENT_RETURN_TO_BANK:
+        case EVENT_LOSE:
+            if (resource < GRAIN || resource > LUMBER) {
+                return false;
+            }
+            // Discarding caps the loss at what the player holds, so a loss of more than that is refused here
+            if ((event.type == EVENT_RETURN_TO_BANK || event.type == EVENT_LOSE) &&
+                !player->get_resources().covers({{resource, event.amount}})) {
+                return false;
+            }
+            // So is a gain from the bank, which caps it at what the bank holds
+            if (event.type == EVENT_GAIN_FROM_BANK &&
+                !context.get_bank().get_available_resources().covers({{resource, event.amount}})) {
+                return false;
+            }
+            if (event.type == EVENT_GAIN_FROM_BANK || event.type == EVENT_GAIN) {
+                player->gain_many_resources({{resource, event.amount}}, event.type == EVENT_GAIN_FROM_BANK, false);
+            } else {
+                player->discard_many_resources({{resource, event.amount}}, "lost", event.type == EVENT_RETURN_TO_BANK, false);
+            }
+            return true;
+        case EVENT_WINNER:
+            winner = color;
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::size_t GameLogReplayer::replay(const GameLogReader &reader) {
+    if (!reader.get_header().matches(board)) {
+        return 0;
+    }
+    std::size_t applied = 0;
+    for (const GameEvent &event : reader) {
+        if (!apply(event)) {
+            break;
+        }
+        applied++;
+    }
+    return applied;
+}
+
+player_color GameLogReplayer::get_winner() const {
+    return winner;
+}
@@ -0,0 +1,78 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/GameRandom.h"
+
+using std::uint64_t, std::uint32_t;
+
+static uint64_t rotate_left(const uint64_t x, const int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+GameRandom::GameRandom(const uint64_t seed) {
+    this->seed(seed);
+}
+
+void GameRandom::seed(const uint64_t seed) {
+    uint64_t x = seed;
+    for (uint64_t &word : state) {
+        x += 0x9e3779b97f4a7c15;
+        uint64_t z = x;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        word = z ^ (z >> 31);
+    }
+}
+
+uint64_t GameRandom::next() {
+    uint64_t result = rotate_left(state[1] * 5, 7) * 9;
+    uint64_t t = state[1] << 17;
+
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotate_left(state[3], 45);
+
+    return result;
+}
+
+// Lemire's multiply and shift, which only needs another number in the rare case the first lands in the uneven part
+int GameRandom::next_int(const int bound) {
+    uint32_t range = static_cast<uint32_t>(bound);
+    uint64_t product = (next() >> 32) * range;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < range) {
+        uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = (next() >> 32) * range;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<int>(product >> 32);
+}
+
+void GameRandom::jump() {
+    static const uint64_t JUMP[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+
+    std::array<uint64_t, 4> jumped = {0, 0, 0, 0};
+    for (uint64_t jump_word : JUMP) {
+        for (int bit = 0; bit < 64; bit++) {
+            if ((jump_word >> bit) & 1) {
+                for (int i = 0; i < 4; i++) {
+                    jumped[i] ^= state[i];
+                }
+            }
+            next();
+        }
+    }
+    state = jumped;
+}
+
+GameRandom GameRandom::split() {
+    GameRandom stream = *this;
+    jump();
+    return stream;
+}
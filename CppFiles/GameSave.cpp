@@ -0,0 +1,460 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/GameSave.h"
+#include "../HeaderFiles/GameBank.h"
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/Player.h"
+#include "../HeaderFiles/Building.h"
+#include "../HeaderFiles/Road.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+
+using std::string, std::vector, std::map, std::shared_ptr, std::uint8_t, std::uint64_t;
+
+static const char BINARY_MAGIC[4] = {'H', 'X', 'S', 'V'};
+static const string TEXT_MAGIC = "hexsettlers-save";
+
+// Prefixes of each player's fields in the text format, by color
+static const string PLAYER_NAMES[GameState::PLAYER_COUNT] = {"red", "yellow", "green", "blue"};
+
+/**
+* Requires: state, visitor called as visit(name, pointer to the first value, number of values)
+* Modifies: whatever the visitor changes
+* Effects: visits every saved field of the state in the order they are saved. Only the players in the game
+* are visited, so player_count has to be visited (and read) before them
+*/
+template <typename Visitor>
+static void visit_fields(GameState &state, Visitor &visit) {
+    visit("tile_types", state.tile_types.data(), StandardBoard::TILE_COUNT);
+    visit("tile_numbers", state.tile_numbers.data(), StandardBoard::TILE_COUNT);
+    visit("plot_ports", state.plot_ports.data(), StandardBoard::PLOT_COUNT);
+    visit("robber_tile", &state.robber_tile, 1);
+    visit("plot_owners", state.plot_owners.data(), StandardBoard::PLOT_COUNT);
+    visit("plot_cities", state.plot_cities.data(), StandardBoard::PLOT_COUNT);
+    visit("path_owners", state.path_owners.data(), StandardBoard::PATH_COUNT);
+    visit("bank_resources", state.bank_resources.data(), TILE_EMPTY);
+    visit("deck", state.deck.data(), CARD_EMPTY);
+    visit("longest_road_holder", &state.longest_road_holder, 1);
+    visit("largest_army_holder", &state.largest_army_holder, 1);
+    visit("current_player", &state.current_player, 1);
+    visit("in_setup", &state.in_setup, 1);
+    visit("winner", &state.winner, 1);
+    visit("turn_count", &state.turn_count, 1);
+    visit("player_count", &state.player_count, 1);
+
+    int player_count = state.player_count < GameState::PLAYER_COUNT ? state.player_count : GameState::PLAYER_COUNT;
+    for (int c = 0; c < player_count; c++) {
+        PlayerState &player = state.players[c];
+        const string &name = PLAYER_NAMES[c];
+        visit(name + ".resources", player.resources.data(), TILE_EMPTY);
+        visit(name + ".devcards", player.devcards.data(), CARD_EMPTY);
+        visit(name + ".new_devcards", player.new_devcards.data(), CARD_EMPTY);
+        visit(name + ".played_devcard", &player.played_devcard, 1);
+        visit(name + ".knights", &player.knights, 1);
+        visit(name + ".road_length", &player.road_length, 1);
+        visit(name + ".roads_left", &player.roads_left, 1);
+        visit(name + ".settlements_left", &player.settlements_left, 1);
+        visit(name + ".cities_left", &player.cities_left, 1);
+    }
+}
+
+/**
+* Requires: number
+* Modifies: nothing
+* Effects: returns if the number can be stored in a T
+*/
+template <typename T>
+static bool fits(const long number) {
+    return number >= std::numeric_limits<T>::min() && number <= std::numeric_limits<T>::max();
+}
+
+struct BinaryWriter {
+    vector<uint8_t> &bytes;
+
+    template <typename T>
+    void operator()(const string &, const T *values, const int count) {
+        for (int i = 0; i < count; i++) {
+            uint64_t raw = static_cast<uint64_t>(values[i]);
+            for (int b = 0; b < static_cast<int>(sizeof(T)); b++) {
+                bytes.push_back(static_cast<uint8_t>(raw >> (8 * b)));
+            }
+        }
+    }
+};
+
+struct BinaryReader {
+    const uint8_t *bytes;
+    std::size_t size;
+    std::size_t position;
+    bool valid;
+
+    template <typename T>
+    void operator()(const string &, T *values, const int count) {
+        if (!valid || position + sizeof(T) * count > size) {
+            valid = false;
+            return;
+        }
+        for (int i = 0; i < count; i++) {
+            uint64_t raw = 0;
+            for (int b = 0; b < static_cast<int>(sizeof(T)); b++) {
+                raw |= static_cast<uint64_t>(bytes[position++]) << (8 * b);
+            }
+            values[i] = static_cast<T>(raw);
+        }
+    }
+};
+
+struct TextWriter {
+    std::ostringstream &out;
+
+    template <typename T>
+    void operator()(const string &name, const T *values, const int count) {
+        out << name;
+        for (int i = 0; i < count; i++) {
+            out << " " << static_cast<long>(values[i]);
+        }
+        out << "\n";
+    }
+};
+
+struct TextReader {
+    const map<string, vector<long>> &lines;
+    bool valid;
+
+    template <typename T>
+    void operator()(const string &name, T *values, const int count) {
+        auto line = lines.find(name);
+        if (!valid || line == lines.end() || line->second.size() != static_cast<std::size_t>(count)) {
+            valid = false;
+            return;
+        }
+        for (int i = 0; i < count; i++) {
+            if (!fits<T>(line->second[i])) {
+                valid = false;
+                return;
+            }
+            values[i] = static_cast<T>(line->second[i]);
+        }
+    }
+};
+
+vector<uint8_t> GameSave::encode_binary(const SavedGame &game) {
+    vector<uint8_t> bytes(BINARY_MAGIC, BINARY_MAGIC + sizeof(BINARY_MAGIC));
+    BinaryWriter writer{bytes};
+    std::uint16_t version = VERSION;
+    writer("version", &version, 1);
+    writer("seed", &game.seed, 1);
+    // The writer doesn't change anything, the copy only lets the fields be visited
+    GameState state = game.state;
+    visit_fields(state, writer);
+    return bytes;
+}
+
+bool GameSave::decode_binary(const uint8_t *bytes, const std::size_t size, SavedGame &game) {
+    if (size < sizeof(BINARY_MAGIC) || std::memcmp(bytes, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0) {
+        return false;
+    }
+    BinaryReader reader{bytes, size, sizeof(BINARY_MAGIC), true};
+    std::uint16_t version = 0;
+    reader("version", &version, 1);
+    if (!reader.valid || version != VERSION) {
+        return false;
+    }
+    SavedGame decoded;
+    reader("seed", &decoded.seed, 1);
+    visit_fields(decoded.state, reader);
+    if (!reader.valid || reader.position != size || !is_valid(decoded.state)) {
+        return false;
+    }
+    game = decoded;
+    return true;
+}
+
+string GameSave::encode_text(const SavedGame &game) {
+    std::ostringstream out;
+    out << TEXT_MAGIC << " " << VERSION << "\n";
+    out << "seed " << game.seed << "\n";
+    TextWriter writer{out};
+    GameState state = game.state;
+    visit_fields(state, writer);
+    return out.str();
+}
+
+bool GameSave::decode_text(const string &text, SavedGame &game) {
+    std::istringstream in(text);
+    string magic;
+    long version = 0;
+    if (!(in >> magic >> version) || magic != TEXT_MAGIC || version != VERSION) {
+        return false;
+    }
+
+    SavedGame decoded;
+    map<string, vector<long>> lines;
+    string line;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        string name;
+        if (!(fields >> name)) {
+            continue;
+        }
+        if (name == "seed") {
+            string seed;
+            fields >> seed;
+            char *end = nullptr;
+            decoded.seed = std::strtoull(seed.c_str(), &end, 10);
+            if (seed.empty() || *end != '\0') {
+                return false;
+            }
+            continue;
+        }
+        vector<long> &values = lines[name];
+        long value;
+        while (fields >> value) {
+            values.push_back(value);
+        }
+        if (!fields.eof()) {
+            return false;
+        }
+    }
+
+    TextReader reader{lines, true};
+    visit_fields(decoded.state, reader);
+    if (!reader.valid || !is_valid(decoded.state)) {
+        return false;
+    }
+    game = decoded;
+    return true;
+}
+
+bool GameSave::save(const string &path, const SavedGame &game, const save_format format) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    if (format == SAVE_TEXT) {
+        file << encode_text(game);
+    } else {
+        vector<uint8_t> bytes = encode_binary(game);
+        file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+    file.close();
+    return !file.fail();
+}
+
+bool GameSave::load(const string &path, SavedGame &game) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (contents.compare(0, TEXT_MAGIC.size(), TEXT_MAGIC) == 0) {
+        return decode_text(contents, game);
+    }
+    return decode_binary(reinterpret_cast<const uint8_t*>(contents.data()), contents.size(), game);
+}
+
+bool GameSave::is_valid(const GameState &state) {
+    int player_count = state.player_count;
+    if (player_count < 1 || player_count > GameState::PLAYER_COUNT) {
+        return false;
+    }
+    auto is_player = [player_count](const int color) {
+        return color < player_count;
+    };
+    auto is_player_or_empty = [player_count](const int color) {
+        return color < player_count || color == COLOR_EMPTY;
+    };
+
+    int deserts = 0;
+    for (int tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        int number = state.tile_numbers[tile];
+        if (state.tile_types[tile] == DESERT) {
+            deserts++;
+            if (number != -1) {
+                return false;
+            }
+        } else if (state.tile_types[tile] >= TILE_EMPTY || number < 2 || number > 12 || number == 7) {
+            return false;
+        }
+    }
+    if (deserts != 1 || state.robber_tile < 0 || state.robber_tile >= StandardBoard::TILE_COUNT) {
+        return false;
+    }
+
+    for (int plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        PortMask port = state.plot_ports[plot];
+        if ((port & (port - 1)) != 0 || port > UNIVERSAL_PORT || port == port_bit(DESERT) ||
+            !is_player_or_empty(state.plot_owners[plot]) ||
+            (state.plot_cities[plot] && state.plot_owners[plot] == COLOR_EMPTY)) {
+            return false;
+        }
+    }
+    for (int path = 0; path < StandardBoard::PATH_COUNT; path++) {
+        if (!is_player_or_empty(state.path_owners[path])) {
+            return false;
+        }
+    }
+
+    if (!is_player_or_empty(state.longest_road_holder) || !is_player_or_empty(state.largest_army_holder) ||
+        !is_player(state.current_player) || !is_player_or_empty(state.winner)) {
+        return false;
+    }
+
+    // Every resource is in the bank or a hand, and no more devcards are out than the deck started with
+    static const GameBank full_bank;
+    std::array<int, CARD_EMPTY> devcards_left{};
+    for (devcard_type card : full_bank.get_available_devcards()) {
+        devcards_left[card]++;
+    }
+    for (tile_type resource : RESOURCE_TYPES) {
+        int total = state.bank_resources[resource];
+        for (int c = 0; c < player_count; c++) {
+            total += state.players[c].resources[resource];
+        }
+        if (total != full_bank.get_available_resources().get(resource)) {
+            return false;
+        }
+    }
+    if (state.bank_resources[DESERT] != 0) {
+        return false;
+    }
+    for (int card = 0; card < CARD_EMPTY; card++) {
+        devcards_left[card] -= state.deck[card];
+        for (int c = 0; c < player_count; c++) {
+            devcards_left[card] -= state.players[c].devcards[card] + state.players[c].new_devcards[card];
+        }
+        if (devcards_left[card] < 0) {
+            return false;
+        }
+    }
+    for (int c = 0; c < player_count; c++) {
+        if (state.players[c].resources[DESERT] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+BoardLayout GameSave::get_layout(const GameState &state) {
+    BoardLayout layout;
+    for (int tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        layout.tile_types[tile] = static_cast<tile_type>(state.tile_types[tile]);
+        layout.tile_numbers[tile] = state.tile_numbers[tile];
+    }
+
+    // Each port is on two plots, either of which has the port's type
+    const StandardBoard::Topology &topology = StandardBoard::TOPOLOGY;
+    for (int plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        int port = topology.plot_port[plot];
+        PortMask mask = state.plot_ports[plot];
+        if (port == StandardBoard::NO_PORT || mask == 0) {
+            continue;
+        }
+        layout.port_types[port] = TILE_EMPTY;
+        for (tile_type resource : {GRAIN, WOOL, BRICK, ORE, LUMBER}) {
+            if (mask == port_bit(resource)) {
+                layout.port_types[port] = resource;
+            }
+        }
+    }
+    return layout;
+}
+
+bool GameSave::restore(const GameState &state, Board &board, GameContext &context) {
+    if (context.get_player_count() != state.player_count) {
+        return false;
+    }
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        if (board.get_tile_by_id(tile).get_type() != state.tile_types[tile] ||
+            board.get_tile_by_id(tile).get_production_number() != state.tile_numbers[tile]) {
+            return false;
+        }
+    }
+    board.set_robber_position(board.get_tile_by_id(state.robber_tile).get_position_id());
+
+    for (PlotId plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        if (state.plot_owners[plot] == COLOR_EMPTY) {
+            continue;
+        }
+        shared_ptr<Player> owner = context.get_player(static_cast<player_color>(state.plot_owners[plot]));
+        board.get_plot_by_id(plot)->set_inhabitant(Building(owner, SETTLEMENT));
+        owner->incdec_settlement_pieces(-1);
+        if (state.plot_cities[plot]) {
+            board.get_plot_by_id(plot)->upgrade_inhabitant();
+            owner->incdec_city_pieces(-1);
+            owner->incdec_settlement_pieces(1);
+        }
+    }
+    for (PathId path = 0; path < StandardBoard::PATH_COUNT; path++) {
+        if (state.path_owners[path] == COLOR_EMPTY) {
+            continue;
+        }
+        shared_ptr<Player> owner = context.get_player(static_cast<player_color>(state.path_owners[path]));
+        board.get_path_by_id(path)->set_inhabitant(Road(owner));
+        owner->incdec_road_pieces(-1);
+    }
+    board.report_road_lengths(false);
+
+    GameBank &bank = context.get_bank();
+    for (auto &entry : context.get_players()) {
+        const shared_ptr<Player> &player = entry.second;
+        const PlayerState &saved = state.players[player->get_color()];
+        if (player->get_road_pieces() != saved.roads_left ||
+            player->get_settlement_pieces() != saved.settlements_left ||
+            player->get_city_pieces() != saved.cities_left) {
+            return false;
+        }
+
+        ResourceVector resources;
+        for (tile_type resource : RESOURCE_TYPES) {
+            resources.set(resource, saved.resources[resource]);
+        }
+        player->gain_many_resources(resources, true, false);
+
+        // Cards in hand come out of the deck. Only the ones bought this turn stay unplayable
+        for (int card = 0; card < CARD_EMPTY; card++) {
+            for (int i = 0; i < saved.devcards[card] + saved.new_devcards[card]; i++) {
+                DevCard devcard = bank.take_devcard(static_cast<devcard_type>(card));
+                if (!devcard.is_valid()) {
+                    return false;
+                }
+                devcard.set_bought_this_turn(i >= saved.devcards[card]);
+                player->gain_devcard(devcard, false);
+            }
+        }
+        player->set_played_devcard_this_turn(saved.played_devcard);
+        for (int i = 0; i < saved.knights; i++) {
+            player->gain_knight(false);
+        }
+    }
+
+    for (tile_type resource : RESOURCE_TYPES) {
+        if (bank.get_available_resources().get(resource) != state.bank_resources[resource]) {
+            return false;
+        }
+    }
+
+    // What isn't in a hand or the deck any more has been played
+    for (int card = 0; card < CARD_EMPTY; card++) {
+        devcard_type type = static_cast<devcard_type>(card);
+        vector<devcard_type> deck = bank.get_available_devcards();
+        for (int extra = std::count(deck.begin(), deck.end(), type) - state.deck[card]; extra > 0; extra--) {
+            bank.take_devcard(type);
+        }
+    }
+
+    // Titles go to whoever held them, not whoever would take them now
+    for (auto &entry : context.get_players()) {
+        entry.second->set_longest_road(entry.second->get_color() == state.longest_road_holder);
+        entry.second->set_largest_army(entry.second->get_color() == state.largest_army_holder);
+    }
+    return true;
+}
@@ -0,0 +1,191 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/GameState.h"
+#include "../HeaderFiles/Board.h"
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/Player.h"
+#include "../HeaderFiles/ProductionTable.h"
+#include "../HeaderFiles/Zobrist.h"
+
+using std::uint8_t, std::int8_t, std::uint64_t, std::shared_ptr;
+
+int PlayerState::get_resource_count() const {
+    int count = 0;
+    for (uint8_t amount : resources) {
+        count += amount;
+    }
+    return count;
+}
+
+int PlayerState::get_victory_point_cards() const {
+    return devcards[VICTORY_POINT] + new_devcards[VICTORY_POINT];
+}
+
+GameState GameState::capture(const Board &board, const GameContext &context) {
+    // Value-initialized, so the padding is zero too and equal states compare equal byte for byte
+    GameState state{};
+    const BoardBitboards &bitboards = board.get_bitboards();
+
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        state.tile_types[tile] = board.get_tile_by_id(tile).get_type();
+        state.tile_numbers[tile] = static_cast<int8_t>(board.get_tile_by_id(tile).get_production_number());
+    }
+    state.robber_tile = static_cast<int8_t>(bitboards.get_production_table().get_robber_tile());
+
+    state.plot_owners.fill(COLOR_EMPTY);
+    state.path_owners.fill(COLOR_EMPTY);
+    for (PlotId plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        state.plot_ports[plot] = bitboards.get_plot_port(plot);
+    }
+    for (int c = 0; c < PLAYER_COUNT; c++) {
+        player_color color = static_cast<player_color>(c);
+        for (PlotMask plots = bitboards.get_buildings(color); plots != 0; plots &= plots - 1) {
+            state.plot_owners[lowest_bit(plots)] = color;
+        }
+        for (PlotMask cities = bitboards.get_cities(color); cities != 0; cities &= cities - 1) {
+            state.plot_cities[lowest_bit(cities)] = true;
+        }
+        PathMask roads = bitboards.get_roads(color);
+        for (PathId path = 0; path < StandardBoard::PATH_COUNT; path++) {
+            if (roads.test(path)) {
+                state.path_owners[path] = color;
+            }
+        }
+    }
+
+    const GameBank &bank = context.get_bank();
+    for (tile_type resource : RESOURCE_TYPES) {
+        state.bank_resources[resource] = bank.get_available_resources().get(resource);
+    }
+    for (devcard_type card : bank.get_available_devcards()) {
+        state.deck[card]++;
+    }
+
+    state.player_count = context.get_player_count();
+    for (auto &entry : context.get_players()) {
+        const shared_ptr<Player> &player = entry.second;
+        PlayerState &player_state = state.players[player->get_color()];
+        for (tile_type resource : {GRAIN, WOOL, BRICK, ORE, LUMBER}) {
+            player_state.resources[resource] = player->get_amount_of_resource(resource);
+        }
+        for (const DevCard &card : player->get_devcards()) {
+            if (card.was_bought_this_turn()) {
+                player_state.new_devcards[card.get_type()]++;
+            } else {
+                player_state.devcards[card.get_type()]++;
+            }
+        }
+        player_state.played_devcard = player->has_played_devcard_this_turn();
+        player_state.knights = player->get_number_of_knights();
+        player_state.road_length = player->get_length_of_road();
+        player_state.roads_left = player->get_road_pieces();
+        player_state.settlements_left = player->get_settlement_pieces();
+        player_state.cities_left = player->get_city_pieces();
+    }
+
+    const ScoreTracker &scores = context.get_score_tracker();
+    state.longest_road_holder = scores.get_longest_road_holder();
+    state.largest_army_holder = scores.get_largest_army_holder();
+
+    state.current_player = RED;
+    state.in_setup = false;
+    state.winner = COLOR_EMPTY;
+    state.turn_count = 0;
+    return state;
+}
+
+uint64_t GameState::hash() const {
+    const ZobristKeys &keys = ZobristKeys::get();
+    uint64_t hash = 0;
+
+    for (PlotId plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        if (plot_owners[plot] < PLAYER_COUNT) {
+            player_color owner = static_cast<player_color>(plot_owners[plot]);
+            hash ^= keys.plot_key(plot, owner, plot_cities[plot] ? CITY : SETTLEMENT);
+        }
+    }
+    for (PathId path = 0; path < StandardBoard::PATH_COUNT; path++) {
+        if (path_owners[path] < PLAYER_COUNT) {
+            hash ^= keys.path_key(path, static_cast<player_color>(path_owners[path]));
+        }
+    }
+    if (robber_tile >= 0) {
+        hash ^= keys.robber_key(robber_tile);
+    }
+
+    // Players not in the game hold nothing, and the keys for 0 are 0
+    for (int c = 0; c < PLAYER_COUNT; c++) {
+        player_color color = static_cast<player_color>(c);
+        const PlayerState &player = players[c];
+        for (int resource = GRAIN; resource < TILE_EMPTY; resource++) {
+            hash ^= keys.resource_key(color, static_cast<tile_type>(resource), player.resources[resource]);
+        }
+        for (int card = 0; card < CARD_EMPTY; card++) {
+            int held = player.devcards[card] + player.new_devcards[card];
+            hash ^= keys.devcard_key(color, static_cast<devcard_type>(card), held);
+        }
+        hash ^= keys.knight_key(color, player.knights);
+    }
+    for (int card = 0; card < CARD_EMPTY; card++) {
+        hash ^= keys.deck_key(static_cast<devcard_type>(card), deck[card]);
+    }
+
+    if (current_player < PLAYER_COUNT) {
+        hash ^= keys.turn_key(static_cast<player_color>(current_player));
+    }
+    if (in_setup) {
+        hash ^= keys.setup_key();
+    }
+    return hash;
+}
+
+PlotMask GameState::get_settlements(const player_color color) const {
+    PlotMask settlements = 0;
+    for (PlotId plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        if (plot_owners[plot] == color && !plot_cities[plot]) {
+            settlements |= PlotMask(1) << plot;
+        }
+    }
+    return settlements;
+}
+
+PlotMask GameState::get_cities(const player_color color) const {
+    PlotMask cities = 0;
+    for (PlotId plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        if (plot_owners[plot] == color && plot_cities[plot]) {
+            cities |= PlotMask(1) << plot;
+        }
+    }
+    return cities;
+}
+
+PathMask GameState::get_roads(const player_color color) const {
+    PathMask roads;
+    for (PathId path = 0; path < StandardBoard::PATH_COUNT; path++) {
+        if (path_owners[path] == color) {
+            roads = roads | PathMask::bit(path);
+        }
+    }
+    return roads;
+}
+
+int GameState::get_points(const player_color color, const bool is_private) const {
+    int points = 0;
+    for (PlotId plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        if (plot_owners[plot] == color) {
+            points += plot_cities[plot] ? ScoreTracker::CITY_POINTS : ScoreTracker::SETTLEMENT_POINTS;
+        }
+    }
+    if (longest_road_holder == color) {
+        points += ScoreTracker::TITLE_POINTS;
+    }
+    if (largest_army_holder == color) {
+        points += ScoreTracker::TITLE_POINTS;
+    }
+    if (is_private) {
+        points += players[color].get_victory_point_cards();
+    }
+    return points;
+}
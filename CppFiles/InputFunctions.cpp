@@ -4,13 +4,16 @@
 
 #include "../HeaderFiles/InputFunctions.h"
 #include "../HeaderFiles/Player.h"
-#include "../HeaderFiles/GameBank.h"
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/OutputSink.h"
+#include "../HeaderFiles/Instrumentation.h"
+#include "../HeaderFiles/TradePlanner.h"
 
 #include <iostream>
 #include <sstream>
 
-using std::cout, std::endl, std::cin;
-using std::string, std::vector, std::shared_ptr, std::map, std::stringstream, std::to_string, std::max;
+using std::cin;
+using std::string, std::vector, std::shared_ptr, std::map, std::stringstream, std::to_string, std::min;
 
 const int EXIT_CODE = -1324387596;
 
@@ -65,13 +68,14 @@ int generic_int_prompt(
     const string main_message,
     const string empty_message,
     const string invalid_message) {
+    INSTRUMENT_SCOPE("generic_int_prompt");
 
     // Int and string values for input
     int count = -1;
     string input;
     while (true) {
         stringstream ss;
-        cout << "\n" << main_message << endl;
+        game_output() << "\n" << main_message << '\n';
         getline(cin, input);
 
         string quit_command = "";
@@ -83,13 +87,13 @@ int generic_int_prompt(
         }
         // Is empty
         if (input.empty()) {
-            cout << empty_message << endl;
+            game_output() << empty_message << '\n';
             continue;
         }
         ss << input;
         // Is not an int
         if (!(ss >> count) || to_string(count).length() != input.length()){
-            cout << invalid_message << endl;
+            game_output() << invalid_message << '\n';
             continue;
         }
         break;
@@ -99,20 +103,21 @@ int generic_int_prompt(
 
 // Prompts the user for a coordinate id to a tile (Ex. b,c or c,f)
 string tile_id_prompt(const shared_ptr<Player> &player, const bool can_quit) {
+    INSTRUMENT_SCOPE("tile_id_prompt");
     // If the player is not valid, just return we can't do anything further if thats the case.
     if (player == nullptr) {
         return "";
     }
     // prints initial message
-    cout << "\n" << player->get_name() << ", please choose a tile (Ex. b,c)." << endl;
+    game_output() << "\n" << player->get_name() << ", please choose a tile (Ex. b,c)." << '\n';
     string tile_id;
     while (true) {
         getline(cin, tile_id);
 
         // Empty input failure
         if (tile_id.empty()) {
-            cout << "Your entry did not specify a tile." << endl;
-            cout << "Please choose a tile by typing its ID letters shown on the grid seperated by a ','" << endl;
+            game_output() << "Your entry did not specify a tile." << '\n';
+            game_output() << "Please choose a tile by typing its ID letters shown on the grid seperated by a ','" << '\n';
             continue;
         }
 
@@ -123,8 +128,8 @@ string tile_id_prompt(const shared_ptr<Player> &player, const bool can_quit) {
             if (can_quit) {
                 return "quit";
             }
-            cout << "Sorry, you cannot quit from this game action." << endl;
-            cout << "\n" << player->get_name() << ", please choose a tile (Ex. b,c)." << endl;
+            game_output() << "Sorry, you cannot quit from this game action." << '\n';
+            game_output() << "\n" << player->get_name() << ", please choose a tile (Ex. b,c)." << '\n';
             continue;
         }
 
@@ -139,20 +144,20 @@ string tile_id_prompt(const shared_ptr<Player> &player, const bool can_quit) {
 
         // Invalid Assumption failure
         if (has_parentheses) {
-            cout << "In order to get the tile you desire, avoid including parentheses." << endl;
-            cout << "Please enter a tile in the format *,* replacing * with the first and second letters of the tile" << endl;
+            game_output() << "In order to get the tile you desire, avoid including parentheses." << '\n';
+            game_output() << "Please enter a tile in the format *,* replacing * with the first and second letters of the tile" << '\n';
             continue;
         }
 
         // Too long Failure
         if (tile_id.size() > 3) {
-            cout << "Your entry was too long to specify a single tile." << endl;
-            cout << "Please enter a 3 character tile key. (For example, b,c)" << endl;
+            game_output() << "Your entry was too long to specify a single tile." << '\n';
+            game_output() << "Please enter a 3 character tile key. (For example, b,c)" << '\n';
             continue; }
         // Too Short Failure
         if (tile_id.size() < 3) {
-            cout << "Your entry was too short to specify a tile." << endl;
-            cout << "Please enter a 3 character tile key. (For example, b,c)" << endl;
+            game_output() << "Your entry was too short to specify a tile." << '\n';
+            game_output() << "Please enter a 3 character tile key. (For example, b,c)" << '\n';
             continue; }
 
         bool first_char_valid = false;
@@ -180,17 +185,17 @@ string tile_id_prompt(const shared_ptr<Player> &player, const bool can_quit) {
         }
         // If the input did not seperate characters with a comma, tell the player ot do that and try again
         if (tile_id[1] != ',') {
-            cout << "Your entry was not in the proper format. Remember to separate the letters you enter with ','" << endl;
-            cout << "Please enter a tile in the format *,* replacing * with the first and second letters of the tile" << endl;
+            game_output() << "Your entry was not in the proper format. Remember to separate the letters you enter with ','" << '\n';
+            game_output() << "Please enter a tile in the format *,* replacing * with the first and second letters of the tile" << '\n';
             continue;
         }
 
         // If either of the characters on either side of the comma are invalid, true again and give a hint as to the correct type of input.
         if (!first_char_valid || !second_char_valid) {
-            cout << "Either the first or second letters you entered we invalid." << endl;
-            cout << "The choices for the first letter are a,b, or c.";
-            cout << "The choices for the second letter depend on the first. take a look at the board's tiles and their IDs" << endl;
-            cout << "Please enter a tile in the format *,* replacing * with the first and second letters of the tile" << endl;
+            game_output() << "Either the first or second letters you entered we invalid." << '\n';
+            game_output() << "The choices for the first letter are a,b, or c.";
+            game_output() << "The choices for the second letter depend on the first. take a look at the board's tiles and their IDs" << '\n';
+            game_output() << "Please enter a tile in the format *,* replacing * with the first and second letters of the tile" << '\n';
             continue;
         }
 
@@ -207,6 +212,7 @@ shared_ptr<Path> placement_path_prompt(
     Board &board, const string tile_id,
     const player_color color, const bool require_adjacent_road,
     const bool can_quit) {
+    INSTRUMENT_SCOPE("placement_path_prompt");
     // If there is no tile there, return
     if (!board.has_tile(tile_id)) {
         return nullptr;
@@ -219,15 +225,12 @@ shared_ptr<Path> placement_path_prompt(
     tile.reset_path_icon_overrides();
 
     // Constructs valid index message and vector of valid indexes for input
+    // A path is valid if it is empty and, when required (most of the game), next to one of the player's roads
+    PathMask buildable_paths = board.get_bitboards().get_buildable_paths(color, require_adjacent_road);
     vector<int> valid_indexes;
     string valid_index_message = "(";
     for (auto &it : tile.get_adjacent_paths()) {
-        // If the path already has a road, it is not a valid spot for a road
-        if (it.second->is_occupied()){
-            continue;
-        }
-        // If the path requires an adjacent road (most of the game does) and it doesn't, it is not a valid spot
-        if (require_adjacent_road && !it.second->has_adjacent_matching_road(color)) {
+        if (!buildable_paths.test(it.second->get_id())) {
             continue;
         }
         valid_indexes.push_back(it.first);
@@ -257,11 +260,11 @@ shared_ptr<Path> placement_path_prompt(
             if (can_quit) {
                 return nullptr;
             }
-            cout << "Sorry, you cannot quit from this game action." << endl;
+            game_output() << "Sorry, you cannot quit from this game action." << '\n';
             continue;
         }
         if (!vector_has_value(valid_indexes, path_index)) {
-            cout << "Sorry, it seems the index you entered does not exist." << endl;
+            game_output() << "Sorry, it seems the index you entered does not exist." << '\n';
             continue;
         }
         return tile.get_adjacent_paths().at(path_index);
@@ -271,6 +274,7 @@ shared_ptr<Path> placement_path_prompt(
 // Handles prompt for placing something on a path, but takes in a building position.
 // This is used in the beginning of the game where a player must place a road adjacent to the building they just place
 shared_ptr<Path> placement_path_prompt(const Board &board, const OrderedPair building_position, const bool can_quit) {
+    INSTRUMENT_SCOPE("placement_path_prompt");
     if (!board.has_plot(building_position)) {
         return nullptr;
     }
@@ -345,11 +349,11 @@ shared_ptr<Path> placement_path_prompt(const Board &board, const OrderedPair bui
             if (can_quit) {
                 return nullptr;
             }
-            cout << "Sorry, you cannot quit from this game action." << endl;
+            game_output() << "Sorry, you cannot quit from this game action." << '\n';
             continue;
         }
         if (!vector_has_value(valid_indexes, plot_index)) {
-            cout << "Sorry, it seems the index you entered does not exist." << endl;
+            game_output() << "Sorry, it seems the index you entered does not exist." << '\n';
             continue;
         }
         return adjacent_paths.at(plot_index);
@@ -360,6 +364,7 @@ shared_ptr<Path> placement_path_prompt(const Board &board, const OrderedPair bui
 shared_ptr<Plot> placement_upgrade_prompt(
     Board &board, const shared_ptr<Player> &player,
     const string tile_id, const bool can_quit) {
+    INSTRUMENT_SCOPE("placement_upgrade_prompt");
     // If there is not tile there, return
     if (!board.has_tile(tile_id)) {
         return nullptr;
@@ -372,16 +377,12 @@ shared_ptr<Plot> placement_upgrade_prompt(
     board.display_board(false, {tile.get_position_id()});
     tile.reset_plot_icon_overrides();
 
+    // Only the player's own settlements can be upgraded
+    PlotMask settlements = board.get_bitboards().get_settlements(player->get_color());
     vector<int> valid_indexes;
     string valid_index_message = "(";
     for (auto &it : tile.get_adjacent_plots()) {
-        if (!it.second->is_occupied()) {
-            continue;
-        }
-        if (it.second->get_inhabitant()->get_building_type() != SETTLEMENT) {
-            continue;
-        }
-        if (it.second->get_inhabitant()->get_color() != player->get_color()) {
+        if ((settlements >> it.second->get_id() & 1) == 0) {
             continue;
         }
 
@@ -411,11 +412,11 @@ shared_ptr<Plot> placement_upgrade_prompt(
             if (can_quit) {
                 return nullptr;
             }
-            cout << "Sorry, you cannot quit from this game action." << endl;
+            game_output() << "Sorry, you cannot quit from this game action." << '\n';
             continue;
         }
         if (!vector_has_value(valid_indexes, plot_index)) {
-            cout << "Sorry, it seems the index you entered does not exist." << endl;
+            game_output() << "Sorry, it seems the index you entered does not exist." << '\n';
             continue;
         }
         return tile.get_adjacent_plots().at(plot_index);
@@ -426,6 +427,7 @@ shared_ptr<Plot> placement_upgrade_prompt(
 shared_ptr<Plot> placement_plot_prompt(
     Board &board, const shared_ptr<Player> &player,
     const string tile_id, const bool require_adjacent_road, const bool can_quit) {
+    INSTRUMENT_SCOPE("placement_plot_prompt");
     // If there is no tile there, return
     if (!board.has_tile(tile_id)) {
         return nullptr;
@@ -438,29 +440,14 @@ shared_ptr<Plot> placement_plot_prompt(
     tile.reset_plot_icon_overrides();
 
     // Formulates the valid indexes and the display of them in the prompt based on if they can be selected for settlement placement
+    // A plot is valid if it is empty, not next to a building, and when required, at the end of one of the player's roads
+    PlotMask buildable_plots = board.get_bitboards().get_buildable_plots(player->get_color(), require_adjacent_road);
     vector<int> valid_indexes;
     string valid_index_message = "(";
     for (auto &it : tile.get_adjacent_plots()) {
-        if (it.second->is_occupied() || it.second->next_to_building()) {
+        if ((buildable_plots >> it.second->get_id() & 1) == 0) {
             continue;
         }
-        if (require_adjacent_road) {
-            bool valid = false;
-            for (auto &map_pair : it.second->get_adjacent_plots()) {
-                shared_ptr<Path> connected_path =
-                    board.get_path(map_pair.second->get_position_coordinates(),
-                        it.second->get_position_coordinates());
-                if (connected_path == nullptr) {
-                    continue;
-                }
-                if (connected_path->is_occupied() && connected_path->get_inhabitant()->get_color() == player->get_color()) {
-                    valid = true;
-                }
-            }
-            if (!valid) {
-                continue;
-            }
-        }
         valid_indexes.push_back(it.first);
         if (valid_index_message.length() > 1) {
             valid_index_message += ", ";
@@ -488,11 +475,11 @@ shared_ptr<Plot> placement_plot_prompt(
             if (can_quit) {
                 return nullptr;
             }
-            cout << "Sorry, you cannot quit from this game action." << endl;
+            game_output() << "Sorry, you cannot quit from this game action." << '\n';
             continue;
         }
         if (!vector_has_value(valid_indexes, plot_index)) {
-            cout << "Sorry, it seems the index you entered does not exist." << endl;
+            game_output() << "Sorry, it seems the index you entered does not exist." << '\n';
             continue;
         }
         return tile.get_adjacent_plots().at(plot_index);
@@ -501,7 +488,8 @@ shared_ptr<Plot> placement_plot_prompt(
 
 // Prompts the user for the number of players the game will be played with
 int player_count_prompt() {
-    cout << "Hex Settlers can be played with 2-4 people. ";
+    INSTRUMENT_SCOPE("player_count_prompt");
+    game_output() << "Hex Settlers can be played with 2-4 people. ";
     int count = -1;
     while (true) {
         // Loop just handles the int input and validation with correct numbers of players (2, 3, or 4)
@@ -510,15 +498,56 @@ int player_count_prompt() {
             "Sorry, you cannot play Hex Settlers with... *cricket noises* ...players. ",
             "Sorry, the number you entered is not a valid input.");
         if (count < 2 || count > 4) {
-            cout << "Unfortunately, you cannot play Hex Settlers with " << count << " players." << endl;
+            game_output() << "Unfortunately, you cannot play Hex Settlers with " << count << " players." << '\n';
             continue;
         }
         break;
     }
-    cout << "Great. We'll start the game with " << count << " players!" << endl;
+    game_output() << "Great. We'll start the game with " << count << " players!" << '\n';
+    return count;
+}
+
+int computer_player_count_prompt(const int player_count) {
+    INSTRUMENT_SCOPE("computer_player_count_prompt");
+    int count = -1;
+    while (true) {
+        count = generic_int_prompt(
+            "How many of the " + to_string(player_count) + " players should the computer play? (0-" + to_string(player_count) + ") ",
+            "Please enter a number of computer players. ",
+            "Sorry, the number you entered is not a valid input.");
+        if (count < 0 || count > player_count) {
+            game_output() << "There can't be " << count << " computer players in a game of " << player_count << "." << '\n';
+            continue;
+        }
+        break;
+    }
+    if (count > 0) {
+        game_output() << "The computer will play the last " << count << " seat" << (count == 1 ? "" : "s") << "." << '\n';
+    }
     return count;
 }
 
+bool continue_saved_game_prompt() {
+    INSTRUMENT_SCOPE("continue_saved_game_prompt");
+    string input;
+    while (true) {
+        game_output() << "There is a saved game. Would you like to [Continue] it or start a [New] game?" << '\n';
+        getline(cin, input);
+        if (input.empty()) {
+            game_output() << "It seems you didn't enter anything." << '\n';
+            continue;
+        }
+        input = get_lowercase(input);
+        if (input == "continue") {
+            return true;
+        }
+        if (input == "new") {
+            return false;
+        }
+        game_output() << "Invalid input." << '\n';
+    }
+}
+
 tile_type resource_choice_prompt(
     const shared_ptr<Player> &player,
     const bool consider_remaining_bank_resources,
@@ -526,23 +555,26 @@ tile_type resource_choice_prompt(
     const bool can_quit,
     const vector<tile_type> &exclusions,
     const string main_message_override) {
+    INSTRUMENT_SCOPE("resource_choice_prompt");
     // Forms the valid resources, and eliminates them if the function cares about what resources remain in the supply
     string input;
     map<tile_type, string> valid_resources = get_resource_conversion_to_string(false);
     // If we are taking the resources in the bank into account of validity, look at each resources in the bank and remove it from the valid resources if there are no cards left
     if (consider_remaining_bank_resources) {
-        for (auto &resource : GameBank::instance().get_available_resources()) {
-            if (resource.second <= 0) {
-                valid_resources.erase(resource.first);
+        const ResourceVector &bank_resources = player->get_context().get_bank().get_available_resources();
+        for (tile_type resource : RESOURCE_TYPES) {
+            if (bank_resources.get(resource) <= 0) {
+                valid_resources.erase(resource);
             }
         }
     }
     // If we are taking the resources in hand into account of validity, look at each resource in hand, and remove it if there are none
     // This should never result in an empty map of valid resources unless the above validity trimming occurred. You should never be prompted to choose a resource from your hand if your hand is empty
     if (consider_resources_in_hand) {
-        for (auto &resource : player->get_resources()) {
-            if (resource.second <= 0 ) {
-                valid_resources.erase(resource.first);
+        ResourceVector hand = player->get_resources();
+        for (tile_type resource : RESOURCE_TYPES) {
+            if (hand.get(resource) <= 0 ) {
+                valid_resources.erase(resource);
             }
         }
     }
@@ -556,7 +588,7 @@ tile_type resource_choice_prompt(
 
     // If there are no resources to choose from, return
     if (valid_resources.empty()) {
-        cout << "There are no valid resources to choose." << endl;
+        game_output() << "There are no valid resources to choose." << '\n';
         return TILE_EMPTY; }
     // Create the prompt, only printing the available resources as options
     string prompt = main_message_override.empty() ? "Please choose a resource - " : main_message_override;
@@ -564,36 +596,37 @@ tile_type resource_choice_prompt(
         prompt += "[" + get_resource_color_code(resource.first) + resource.second + get_cancel_code() + "] "; }
     prompt += ": ";
     while (true) {
-        cout << prompt << endl;
+        game_output() << prompt << '\n';
         getline(cin, input);
         if (input.empty()) {
-            cout << "It seems you didn't enter anything " << endl;
+            game_output() << "It seems you didn't enter anything " << '\n';
             continue; }
         input = get_lowercase(input);
         if (input == "quit") {
             if (can_quit) {
                 return TILE_EMPTY;
             }
-            cout << "Sorry, but you cannot quit this action." << endl;
+            game_output() << "Sorry, but you cannot quit this action." << '\n';
         }
         for (auto &resource : valid_resources) {
             if (get_lowercase(resource.second) == input) {
                 return resource.first;
             }
         }
-        cout << "Sorry, you didn't enter a valid resource. " << endl;
+        game_output() << "Sorry, you didn't enter a valid resource. " << '\n';
     }
 }
 
 // Sets up building placement, displaying board, asking player to choose a tile, and asking the player to choose a plot adjacent to it.
-// All of this is 'quit-able'
-OrderedPair place_building(
+// All of this is 'quit-able'. Nothing is placed here, the chosen plot is handed back to the game engine
+shared_ptr<Plot> settlement_location_prompt(
     Board &board, const shared_ptr<Player> &player,
-    const bool require_adjacent_road, const bool can_quit, const bool spend_resources) {
+    const bool require_adjacent_road, const bool can_quit) {
+    INSTRUMENT_SCOPE("settlement_location_prompt");
 
     if (player->get_settlement_pieces() <= 0) {
-        cout << player->get_name() << ", you have already placed all of your settlement pieces. " << endl;
-        return OrderedPair(100, 100);
+        game_output() << player->get_name() << ", you have already placed all of your settlement pieces. " << '\n';
+        return nullptr;
     }
 
     while (true) {
@@ -606,37 +639,23 @@ OrderedPair place_building(
         // The can_quit parameter would be false in the initial turns ofr example, where a player must place a road
         string tile_id = tile_id_prompt(player, can_quit);
         if (tile_id == "quit" || tile_id == "") {
-            return OrderedPair(100, 100);
+            return nullptr;
         }
-        while (true) {
-            // Inner loop so you can quit and rechoose the tile
-
-            // Then prompt for a plot, which handles displaying the board based on the selected tile and overrides it's plots to show selection indexes
-            shared_ptr<Plot> plot = placement_plot_prompt(board, player, tile_id, require_adjacent_road, true);
-            if (plot == nullptr) {
-                break;
-            }
-
-            Building new_building = Building(player, SETTLEMENT);
-            plot->set_inhabitant(new_building);
-            player->incdec_settlement_pieces(-1);
-            if (spend_resources) {
-                player->discard_many_resources(new_building.get_recipe(), "spent", true);
-            }
-
-            cout << endl;
-            board.display_board(false);
-
-            return plot->get_position_coordinates();
+        // Then prompt for a plot, which handles displaying the board based on the selected tile and overrides it's plots to show selection indexes
+        // Quitting here goes back to choosing the tile
+        shared_ptr<Plot> plot = placement_plot_prompt(board, player, tile_id, require_adjacent_road, true);
+        if (plot != nullptr) {
+            return plot;
         }
     }
 }
 
-OrderedPair upgrade_building(Board &board, const shared_ptr<Player> &player, const bool can_quit) {
+shared_ptr<Plot> city_location_prompt(Board &board, const shared_ptr<Player> &player, const bool can_quit) {
+    INSTRUMENT_SCOPE("city_location_prompt");
 
     if (player->get_city_pieces() <= 0) {
-        cout << player->get_name() << ", you have already placed all of your city pieces. " << endl;
-        return OrderedPair(100, 100);
+        game_output() << player->get_name() << ", you have already placed all of your city pieces. " << '\n';
+        return nullptr;
     }
 
     while (true) {
@@ -645,34 +664,25 @@ OrderedPair upgrade_building(Board &board, const shared_ptr<Player> &player, con
 
         string tile_id = tile_id_prompt(player, can_quit);
         if (tile_id == "quit" || tile_id == "") {
-            return OrderedPair(100, 100);
+            return nullptr;
         }
 
-        while (true) {
-
-            shared_ptr<Plot> plot = placement_upgrade_prompt(board, player, tile_id, true);
-            if (plot == nullptr) {
-                break;
-            }
-
-            plot->get_inhabitant()->upgrade();
-            player->incdec_city_pieces(-1);
-            player->incdec_settlement_pieces(1);
-
-            cout << endl;
-            board.display_board(false);
-
-            return plot->get_position_coordinates();
+        shared_ptr<Plot> plot = placement_upgrade_prompt(board, player, tile_id, true);
+        if (plot != nullptr) {
+            return plot;
         }
     }
 }
 
 // Sets up road placement prompt, displaying board, getting the tile id choice, and getting the path index that surrounds the chosen tile
-void place_road(Board &board, const shared_ptr<Player> &player, const bool requires_adjacent_road, const bool can_quit, const bool spend_resources) {
+shared_ptr<Path> road_location_prompt(
+    Board &board, const shared_ptr<Player> &player,
+    const bool requires_adjacent_road, const bool can_quit) {
+    INSTRUMENT_SCOPE("road_location_prompt");
 
     if (player->get_road_pieces() <= 0) {
-        cout << player->get_name() << ", you have already placed all of your road pieces. " << endl;
-        return;
+        game_output() << player->get_name() << ", you have already placed all of your road pieces. " << '\n';
+        return nullptr;
     }
 
     while (true) {
@@ -682,39 +692,25 @@ void place_road(Board &board, const shared_ptr<Player> &player, const bool requi
         // Then prompt for a tile id
 
         // Outer loop lets the player quit to cancel placing a road, but only if the parameter can_quit is true can the tile_id_prompt allow this
-        // The can_quit parameter would be false in the initial turns ofr example, where a player must place a road
+        // The can_quit parameter would be false when playing Road Building for example, where a player must place a road
         string tile_id = tile_id_prompt(player, can_quit);
         if (tile_id == "quit" || tile_id == "") {
-            return;
+            return nullptr;
         }
-        // Then prompt for a path
-        while (true) {
-            // Inner loop allows player to quit and rechoose tile
-            shared_ptr<Path> path =
-                placement_path_prompt(board, tile_id, player->get_color(), requires_adjacent_road, true);
-            if (path == nullptr) {
-                break;
-            }
-            Road new_road = Road(player);
-            path->set_inhabitant(new_road);
-            player->incdec_road_pieces(-1);
-            player->set_length_of_road(player->calculate_length_of_road(board));
-            if (spend_resources) {
-                player->discard_many_resources(new_road.get_recipe(), "spent", true);
-            }
-
-            cout << endl;
-            board.display_board(false);
-
-            return;
+        // Then prompt for a path. Quitting here goes back to choosing the tile
+        shared_ptr<Path> path =
+            placement_path_prompt(board, tile_id, player->get_color(), requires_adjacent_road, true);
+        if (path != nullptr) {
+            return path;
         }
     }
 }
 
-void play_devcard(Board &board, const shared_ptr<Player> &player, const bool can_quit) {
+devcard_type devcard_choice_prompt(Board &board, const shared_ptr<Player> &player, const bool can_quit) {
+    INSTRUMENT_SCOPE("devcard_choice_prompt");
     player->print_devcards();
     if (player->get_devcards().size() <= 0) {
-        return;
+        return CARD_EMPTY;
     }
     string index_range = "0 - " + to_string(player->get_devcards().size() - 1) + ": ";
     while (true) {
@@ -725,150 +721,87 @@ void play_devcard(Board &board, const shared_ptr<Player> &player, const bool can
             );
         if (devcard_index == EXIT_CODE) {
             if (can_quit) {
-                return;
+                return CARD_EMPTY;
             }
-            cout << "Sorry, you cannot quit from this game action. " << endl;
+            game_output() << "Sorry, you cannot quit from this game action. " << '\n';
             continue;
         }
         if (devcard_index < 0 || devcard_index >= player->get_devcards().size()) {
-            cout << "Sorry, the index you entered is within the valid range: " << index_range << endl;
+            game_output() << "Sorry, the index you entered is within the valid range: " << index_range << '\n';
             continue;
         }
-        player->play_devcard(board, devcard_index);
-        return;
-    }
-}
-
-// Handles initial road placement, which is different from regular road placement because the initial roads are always placed adjacent to the
-// building that was just placed
-void initial_road_placement(const Board &board, const shared_ptr<Player> &player, const OrderedPair building_position) {
-    // Prompts for a path given building position
-    shared_ptr<Path> path = placement_path_prompt(board, building_position, true);
-
-    // Creates a road and sticks it into the pack
-    Road new_road = Road(player);
-    path->set_inhabitant(new_road);
-
-    cout << endl;
-    board.display_board(false);
-
-    player->incdec_road_pieces(-1);
-    player->add_initial_road_anchor(
-        path->get_endpoints().plot_a->get_position_coordinates(),
-        path->get_endpoints().plot_b->get_position_coordinates());
-    player->set_length_of_road(player->calculate_length_of_road(board));
-}
-
-void initial_player_setup(Board &board, const shared_ptr<Player> &player, const bool gain_adjacent_resources) {
-    // Start with placing a building a road, based on the buildings position
-    // You CANNOT skip this
-    OrderedPair building_position = place_building(board, player, false, false, false);
-
-    if (gain_adjacent_resources) {
-
-        map<tile_type, int> resources_gained = Player::get_base_resource_map();
-
-        for (OrderedPair coord : board.get_plot(building_position)->get_adjacent_tile_coords()) {
-            // Gets the resource type and if it is a real resource, adds it to the map
-            tile_type resource = board.get_tile(coord).get_type();
-            if (resource != DESERT && resource != TILE_EMPTY) {
-                resources_gained.at(resource) += 1;
-            }
+        DevCard card = player->get_devcards().at(devcard_index);
+        if (!card.test_playability(board, player)) {
+            return CARD_EMPTY;
         }
-        // gain the resources seen
-        player->gain_many_resources(resources_gained, true);
+        return card.get_type();
     }
-
-    initial_road_placement(board, player, building_position);
 }
 
-void robber_movement_prompt(Board &board, shared_ptr<Player> &player, const bool steal_resource) {
+TileId robber_tile_prompt(Board &board, const shared_ptr<Player> &player) {
+    INSTRUMENT_SCOPE("robber_tile_prompt");
     board.display_board(true);
-    cout << "\n" << player->get_name() << " may now move the robber. ";
+    game_output() << "\n" << player->get_name() << " may now move the robber. ";
     while (true) {
         string tile_id = tile_id_prompt(player, false);
         if (board.get_tile(tile_id).has_robber()) {
-            cout << "The tile you chose is invalid. Please choose a tile that does not already have the robber" << endl;
+            game_output() << "The tile you chose is invalid. Please choose a tile that does not already have the robber" << '\n';
             continue;
         }
-        board.set_robber_position(tile_id);
-        board.display_board(false);
-        if (steal_resource) {
-            adjacent_resource_theft_prompt(board, player, tile_id);
-        }
-        return;
+        return board.get_tile_id(tile_id);
     }
 }
 
-void adjacent_resource_theft_prompt(Board &board, shared_ptr<Player> &player, const string tile_id) {
-    const Tile tile = board.get_tile(tile_id);
-    vector<string> valid_players;
-    map<player_color, string> colors =
-        {{RED, "red"}, {YELLOW, "yellow"},
-        {GREEN, "green"}, {BLUE, "blue"}};
-    for (auto color : colors) {
-        for (auto plot_pair : tile.get_adjacent_plots()) {
-            if (!plot_pair.second->is_occupied()) {
-                continue;}
-            if (plot_pair.second->get_inhabitant()->get_color() == color.first && color.first != player->get_color()) {
-                valid_players.push_back(color.second);
-                break; }
-        }
+player_color steal_target_prompt(const shared_ptr<Player> &player, const vector<player_color> &targets) {
+    INSTRUMENT_SCOPE("steal_target_prompt");
+    if (targets.empty()) {
+        game_output() << "Sorry " << player->get_name() << ". There are no adjacent players to steal from." << '\n';
+        return COLOR_EMPTY;
     }
-    if (valid_players.empty()) {
-        cout << "Sorry " << player->get_name() << ". There are no adjacent players to steal from." << endl;
-        return;}
 
     string input = "";
     while (true) {
-        cout << "Please choose a player color to steal from: ";
-        for (string color : valid_players) {
-            cout << "[" << get_capitalized(color) << "] ";
+        game_output() << "Please choose a player color to steal from: ";
+        for (player_color color : targets) {
+            game_output() << "[" << Player::get_color_as_text(color) << "] ";
         }
 
         getline(cin, input);
         if (input.empty()) {
-            cout << "It seems you didn't enter anything." << endl;
+            game_output() << "It seems you didn't enter anything." << '\n';
             continue;
         }
         // Lowercase for user flexibility
         input = get_lowercase(input);
 
-        if (!vector_has_value(valid_players, input)) {
-            cout << "Sorry, it seems the player you chose is not a valid player at all." << endl;
-            continue; }
-
-        shared_ptr<Player> target = GameBank::instance().get_player(input);
-        if (target == nullptr) {
-            cout << "SOMETHING WENT WRONG WITH RETRIEVING THE PLAYER GIVEN A STRING" << endl;
-            continue;
-        }
-
-        tile_type chosen_resource = target->get_random_resource();
-        if (chosen_resource == TILE_EMPTY) {
-            cout << "Bummer..." << target->get_name() << " does not have any resources to steal." << endl;
-            return;
+        for (player_color color : targets) {
+            if (get_lowercase(Player::get_color_as_text(color)) == input) {
+                return color;
+            }
         }
-        target->discard_many_resources({{chosen_resource, 1}}, "lost", false);
-        player->gain_many_resources({{chosen_resource, 1}}, false);
-        return;
+        game_output() << "Sorry, it seems the player you chose is not a valid player at all." << '\n';
     }
 }
 
-void discard_resources_prompt(shared_ptr<Player> player, int number_of_resources) {
+ResourceVector discard_resources_prompt(const shared_ptr<Player> &player, int number_of_resources) {
+    INSTRUMENT_SCOPE("discard_resources_prompt");
+    ResourceVector discarded;
     if (number_of_resources < 1) {
-        cout << "SOMETHING WENT WRONG WITH DISCARD RESOURCE COUNT" << endl;
-        return;
+        game_output() << "SOMETHING WENT WRONG WITH DISCARD RESOURCE COUNT" << '\n';
+        return discarded;
     }
-    cout << "You must discard " << number_of_resources << " resources total." << endl;
+    game_output() << player->get_name() << ", you must discard " << number_of_resources << " resources total." << '\n';
+    // Resources which have all been chosen already can't be chosen again
+    vector<tile_type> used_up;
     while (true) {
-        tile_type resource_choice = resource_choice_prompt(player, false, true);
+        tile_type resource_choice = resource_choice_prompt(player, false, true, false, used_up, "");
         if (resource_choice == TILE_EMPTY) {
-            return;
+            return discarded;
         }
+        int remaining = player->get_amount_of_resource(resource_choice) - discarded.get(resource_choice);
         while (true) {
-            cout << "You have " << player->get_amount_of_resource(resource_choice) << " " <<
-                get_resource_conversion_to_string().at(resource_choice) << " and still need to discard " << number_of_resources << " resources. " << endl;
+            game_output() << "You have " << remaining << " " <<
+                get_resource_conversion_to_string().at(resource_choice) << " and still need to discard " << number_of_resources << " resources. " << '\n';
             int count = generic_int_prompt(
                 "Please choose a number of the chosen resource to discard: ",
                 "It seems you didn't enter anything",
@@ -877,28 +810,31 @@ void discard_resources_prompt(shared_ptr<Player> player, int number_of_resources
             if (count == EXIT_CODE) {
                 break; }
             if (count < 1) {
-                cout << "You cannot discard " << count << " of the chosen resource" << endl;
+                game_output() << "You cannot discard " << count << " of the chosen resource" << '\n';
                 continue; }
-            if (count > player->get_resources().at(resource_choice)) {
-                cout << "You cannot discard " << count << " of the chosen resource because you only have " << player->get_resources().at(resource_choice) << "." << endl;
+            if (count > remaining) {
+                game_output() << "You cannot discard " << count << " of the chosen resource because you only have " << remaining << "." << '\n';
                 continue; }
             if (count > number_of_resources) {
-                cout << "You cannot discard " << count << " of the chosen resource because you only need to discard " << number_of_resources << " resources." << endl;
+                game_output() << "You cannot discard " << count << " of the chosen resource because you only need to discard " << number_of_resources << " resources." << '\n';
                 continue;
             }
 
             number_of_resources -= count;
-            player->discard_many_resources({{resource_choice, count}}, "discarded", true);
+            discarded.add(resource_choice, count);
+            if (count == remaining) {
+                used_up.push_back(resource_choice);
+            }
 
             if (number_of_resources > 0) {
-                cout << player->get_name() << ", you still need to discard " << number_of_resources << " resources." << endl;
+                game_output() << player->get_name() << ", you still need to discard " << number_of_resources << " resources." << '\n';
             }
 
             break;
         }
 
         if (number_of_resources <= 0) {
-            return;
+            return discarded;
         }
     }
 }
@@ -906,14 +842,15 @@ void discard_resources_prompt(shared_ptr<Player> player, int number_of_resources
 void request_info_prompt(
     const Board &board, const shared_ptr<Player> &player,
     const map<int, shared_ptr<Player>> &players) {
+    INSTRUMENT_SCOPE("request_info_prompt");
 
     string input;
     while (true) {
-        cout << "What type of info would you like to see?" << endl;
-        cout << " [Quit]  [Board]  [Player]  [Rules]  [Recipes]" << endl;
+        game_output() << "What type of info would you like to see?" << '\n';
+        game_output() << " [Quit]  [Board]  [Player]  [Rules]  [Recipes]" << '\n';
         getline(cin, input);
         if (input.empty()) {
-            cout << "It seems you didn't enter anything." << endl;
+            game_output() << "It seems you didn't enter anything." << '\n';
             continue;
         }
         input = get_lowercase(input);
@@ -940,14 +877,15 @@ void request_info_prompt(
 }
 
 void request_board_info_prompt(const Board &board) {
+    INSTRUMENT_SCOPE("request_board_info_prompt");
     string input;
 
     while (true) {
-        cout << "What would you like?" << endl;
-        cout << " [Quit]  [Display]  [Rules] " << endl;
+        game_output() << "What would you like?" << '\n';
+        game_output() << " [Quit]  [Display]  [Rules] " << '\n';
         getline(cin, input);
         if (input.empty()) {
-            cout << "It seems you didn't enter anything." << endl;
+            game_output() << "It seems you didn't enter anything." << '\n';
             continue;
         }
         input = get_lowercase(input);
@@ -957,10 +895,10 @@ void request_board_info_prompt(const Board &board) {
         if (input == "display") {
             string board_info_input;
             while (true) {
-                cout << "Would you like to include the tiles' ID coordinates? [Y]/[N]?" << endl;
+                game_output() << "Would you like to include the tiles' ID coordinates? [Y]/[N]?" << '\n';
                 getline(cin, board_info_input);
                 if (board_info_input.empty()) {
-                    cout << "It seems you didn't enter anything." << endl;
+                    game_output() << "It seems you didn't enter anything." << '\n';
                     continue;
                 }
                 board_info_input = get_lowercase(board_info_input);
@@ -968,7 +906,7 @@ void request_board_info_prompt(const Board &board) {
                     break;
                 }
                 if (!vector_has_value({"y", "n"}, board_info_input)) {
-                    cout << "Invalid input." << endl;
+                    game_output() << "Invalid input." << '\n';
                     continue;
                 }
                 board.display_board(board_info_input == "y");
@@ -976,17 +914,17 @@ void request_board_info_prompt(const Board &board) {
             }
         }
         if (input == "rules") {
-            cout << "Here is some rules info on the board:" << endl;
-            cout << " - The board is seperated into 19 tiles, each with 6 adjacent paths and intersections" << endl;
-            cout << " - Buildings are placed on intersections. Roads are placed on paths." << endl;
-            cout << " - There are ports on the shores of the island which indicate their trade type." << endl;
-            cout << " - If a player has a building placed on an intersection marked with a port, they gain its benefit." << endl;
-            cout << " - Ports marked with a resource give the player a permanent 2:1 trade with the bank with that resource." << endl;
-            cout << " - Ports marked with '?' give the player a permanent 3:1 trade with all resources." << endl;
-            cout << " - The robber is denoted by !R! and prevents resource production from the tile it is on." << endl;
-            cout << " - Resources are produced based on the number rolled on the die. If it matches a tile's number, it produces." << endl;
-            cout << " - The resource produced is denoted by the letter on the tile (Ex. W = WOOL). D is the desert which produces nothing." << endl;
-            cout << endl;
+            game_output() << "Here is some rules info on the board:" << '\n';
+            game_output() << " - The board is seperated into 19 tiles, each with 6 adjacent paths and intersections" << '\n';
+            game_output() << " - Buildings are placed on intersections. Roads are placed on paths." << '\n';
+            game_output() << " - There are ports on the shores of the island which indicate their trade type." << '\n';
+            game_output() << " - If a player has a building placed on an intersection marked with a port, they gain its benefit." << '\n';
+            game_output() << " - Ports marked with a resource give the player a permanent 2:1 trade with the bank with that resource." << '\n';
+            game_output() << " - Ports marked with '?' give the player a permanent 3:1 trade with all resources." << '\n';
+            game_output() << " - The robber is denoted by !R! and prevents resource production from the tile it is on." << '\n';
+            game_output() << " - Resources are produced based on the number rolled on the die. If it matches a tile's number, it produces." << '\n';
+            game_output() << " - The resource produced is denoted by the letter on the tile (Ex. W = WOOL). D is the desert which produces nothing." << '\n';
+            game_output() << '\n';
             return;
         }
     }
@@ -994,6 +932,7 @@ void request_board_info_prompt(const Board &board) {
 
 
 void request_player_info_prompt(const Board &board, const shared_ptr<Player> &subject_player, const map<int, shared_ptr<Player>> &players) {
+    INSTRUMENT_SCOPE("request_player_info_prompt");
     map<player_color, string> colors = {{RED, "red"}, {YELLOW, "yellow"}, {GREEN, "green"}, {BLUE, "blue"}};
     vector<string> choices = {"all"};
     // Form choices vector, including the strings corresponding with the enums that exist in the current playeres
@@ -1010,18 +949,18 @@ void request_player_info_prompt(const Board &board, const shared_ptr<Player> &su
     }
     string input;
     while (true) {
-        cout << subject_player->get_name() << ", please choose a player whose info you'd like displayed" << endl;
-        cout << choice_message << endl;
+        game_output() << subject_player->get_name() << ", please choose a player whose info you'd like displayed" << '\n';
+        game_output() << choice_message << '\n';
         getline(cin, input);
         if (input.empty()) {
-            cout << "It seems you didn't enter anything." << endl;
+            game_output() << "It seems you didn't enter anything." << '\n';
             continue;
         }
         input = get_lowercase(input);
         if (input == "quit") {
             return; }
         if (!vector_has_value(choices, input)) {
-            cout << "Your response was invalid." << endl;
+            game_output() << "Your response was invalid." << '\n';
             continue; }
         if (input == "all") {
             for (auto &player : players) {
@@ -1029,27 +968,27 @@ void request_player_info_prompt(const Board &board, const shared_ptr<Player> &su
             }
             return;
         }
-        shared_ptr<Player> target_player = GameBank::instance().get_player(input);
+        shared_ptr<Player> target_player = subject_player->get_context().get_player(input);
         if (target_player == nullptr) {
-            cout << "SOMETHING WENT WRONG IN REQUESTING A PLAYER'S INFO AND RETRIEVING THE PLAYER THROUGH THE GAMEBANK" << endl;
+            game_output() << "SOMETHING WENT WRONG IN REQUESTING A PLAYER'S INFO AND RETRIEVING THE PLAYER THROUGH THE GAMEBANK" << '\n';
             continue;
         }
         // If the player chose themselves, let them choose whether they print all info, or just the general public info
         if (target_player == subject_player) {
-            cout << subject_player->get_name() << ", you chose yourself." << endl;
+            game_output() << subject_player->get_name() << ", you chose yourself." << '\n';
             string priv_info_input;
             while (true) {
-                cout << "Would you like to print private info (cards in hand, resources, etc.) [y]/[n]" << endl;
+                game_output() << "Would you like to print private info (cards in hand, resources, etc.) [y]/[n]" << '\n';
                 getline(cin, priv_info_input);
                 if (priv_info_input.empty()) {
-                    cout << "It seems you didn't enter anything." << endl;
+                    game_output() << "It seems you didn't enter anything." << '\n';
                     continue; }
                 priv_info_input = get_lowercase(priv_info_input);
                 if (priv_info_input == "quit") {
                     break;
                 }
                 if (!vector_has_value({"y", "n"}, priv_info_input)) {
-                    cout << "Invalid input." << endl;
+                    game_output() << "Invalid input." << '\n';
                     continue;
                 }
                 subject_player->print_info(board, priv_info_input == "y");
@@ -1062,32 +1001,34 @@ void request_player_info_prompt(const Board &board, const shared_ptr<Player> &su
     }
 }
 
-void craft_something_prompt(Board &board, const shared_ptr<Player> &player) {
+bool craft_something_prompt(Board &board, const shared_ptr<Player> &player, Action &craft) {
+    INSTRUMENT_SCOPE("craft_something_prompt");
     map<tile_type, string> conversion = get_resource_conversion_to_string();
 
     vector<string> options;
     if (player->get_settlement_pieces() > 0 &&
-        player->can_afford(Craftable::get_recipe("settlement"), false)) { options.emplace_back("settlement"); }
+        player->can_afford(Craftable::SETTLEMENT_RECIPE, false)) { options.emplace_back("settlement"); }
     if (player->get_city_pieces() > 0 &&
-        player->can_afford(Craftable::get_recipe("city"), false)) { options.emplace_back("city"); }
+        player->can_afford(Craftable::CITY_RECIPE, false)) { options.emplace_back("city"); }
     if (player->get_road_pieces() > 0 &&
-        player->can_afford(Craftable::get_recipe("road"), false)) { options.emplace_back("road"); }
-    if (GameBank::instance().has_devcard() &&
-        player->can_afford(Craftable::get_recipe("devcard"), false)) { options.emplace_back("development card"); }
+        player->can_afford(Craftable::ROAD_RECIPE, false)) { options.emplace_back("road"); }
+    if (player->get_context().get_bank().has_devcard() &&
+        player->can_afford(Craftable::DEVCARD_RECIPE, false)) { options.emplace_back("development card"); }
 
     string resource_message;
-    for (auto &res : player->get_resources()) {
-        resource_message += " | " + conversion.at(res.first) + " - " + to_string(res.second);
+    ResourceVector hand = player->get_resources();
+    for (tile_type resource : RESOURCE_TYPES) {
+        resource_message += " | " + conversion.at(resource) + " - " + to_string(hand.get(resource));
     }
 
     if (options.empty()) {
-        cout << endl;
-        cout << resource_message << endl;
-        cout << "Sorry, there is nothing you have the resources to craft right now. \n" << endl;
-        return;
+        game_output() << '\n';
+        game_output() << resource_message << '\n';
+        game_output() << "Sorry, there is nothing you have the resources to craft right now. \n" << '\n';
+        return false;
     }
 
-    cout << player->get_name() << ", what would you like to craft?" << endl;
+    game_output() << player->get_name() << ", what would you like to craft?" << '\n';
 
     vector<string> alternate_codes = {"devcard", "settle", "s", "c", "r", "d"};
     string option_message = " [Quit] ";
@@ -1097,52 +1038,68 @@ void craft_something_prompt(Board &board, const shared_ptr<Player> &player) {
 
     string input;
     while (true) {
-        cout << "\nWhat would you like to craft?" << endl;
-        cout << resource_message << endl;
-        cout << option_message << endl;
+        game_output() << "\nWhat would you like to craft?" << '\n';
+        game_output() << resource_message << '\n';
+        game_output() << option_message << '\n';
         getline(cin, input);
         if (input.empty()) {
-            cout << "It seems you didn't enter anything." << endl;
+            game_output() << "It seems you didn't enter anything." << '\n';
             continue;
         }
         input = get_lowercase(input);
         if (input == "quit") {
-            return;
+            return false;
         }
         if (!vector_has_value(options, input) && !vector_has_value(alternate_codes, input)) {
-            cout << "Your response was invalid." << endl;
+            game_output() << "Your response was invalid." << '\n';
             continue;
         }
-        map<tile_type, int> desired_recipe = Craftable::get_recipe(input);
+        ResourceVector desired_recipe = Craftable::get_recipe(input);
         if (!player->can_afford(desired_recipe, true)) {
             continue;
         }
 
+        // Quitting a placement goes back to choosing what to craft
         if ((input == "settlement" || input == "settle" || input == "s") && vector_has_value(options, "settlement")) {
-            place_building(board, player, true, true, true);
-            return;
+            shared_ptr<Plot> plot = settlement_location_prompt(board, player, true, true);
+            if (plot == nullptr) {
+                continue;
+            }
+            craft.type = BUILD_SETTLEMENT;
+            craft.target = plot->get_id();
+            return true;
         }
         if ((input == "city" || input == "c") && vector_has_value(options, "city")){
-            upgrade_building(board, player, true);
-            return;
+            shared_ptr<Plot> plot = city_location_prompt(board, player, true);
+            if (plot == nullptr) {
+                continue;
+            }
+            craft.type = BUILD_CITY;
+            craft.target = plot->get_id();
+            return true;
         }
         if ((input == "road" || input == "r") && vector_has_value(options, "road")) {
-            place_road(board, player, true, true, true);
-            return;
+            shared_ptr<Path> path = road_location_prompt(board, player, true, true);
+            if (path == nullptr) {
+                continue;
+            }
+            craft.type = BUILD_ROAD;
+            craft.target = path->get_id();
+            return true;
         }
         if ((input == "development card" || input == "devcard" || input == "d") && vector_has_value(options, "development card")){
-            if (!GameBank::instance().has_devcard()) {
-                cout << "Sorry, there are no Development Cards remaining." << endl;
+            if (!player->get_context().get_bank().has_devcard()) {
+                game_output() << "Sorry, there are no Development Cards remaining." << '\n';
                 continue;
             }
-            player->discard_many_resources(desired_recipe, "spent", true);
-            player->gain_devcard(GameBank::instance().draw_devcard());
-            return;
+            craft.type = BUY_DEVCARD;
+            return true;
         }
     }
 }
 
-void trade_prompt(const Board &board, const shared_ptr<Player> &subject_player, const map<int, shared_ptr<Player>> &players) {
+bool trade_prompt(const Board &board, const shared_ptr<Player> &subject_player, const map<int, shared_ptr<Player>> &players, Action &bank_trade) {
+    INSTRUMENT_SCOPE("trade_prompt");
     map<tile_type, string> resource_conversion = get_resource_conversion_to_string();
     map<int, string> conversion = {{RED, "red"}, {YELLOW, "yellow"}, {GREEN, "green"}, {BLUE, "blue"}, {COLOR_EMPTY, "???"}};
     vector<string> options;
@@ -1151,49 +1108,52 @@ void trade_prompt(const Board &board, const shared_ptr<Player> &subject_player,
             options.push_back(conversion.at(player.second->get_color()));
         }
     }
-    string option_message = " [Quit]  [Bank] ";
+    string option_message = " [Quit]  [Bank]  [Suggest] ";
     for (string option : options) {
         option_message += " [" + get_capitalized(option) + "] ";
     }
 
     string input;
     while (true) {
-        cout << subject_player->get_name() << ", with whom would you like to trade?" << endl;
-        cout << option_message << endl;
+        game_output() << subject_player->get_name() << ", with whom would you like to trade?" << '\n';
+        game_output() << option_message << '\n';
         getline(cin, input);
         if (input.empty()) {
-            cout << "It seems you didn't enter anything." << endl;
+            game_output() << "It seems you didn't enter anything." << '\n';
             continue;
         }
         input = get_lowercase(input);
         if (input == "quit") {
-            return;
+            return false;
         }
         if (input == "bank") {
-            maritime_trade(subject_player, subject_player->get_ports(board), subject_player->has_universal_port(board));
-            return;
+            return maritime_trade(board, subject_player, bank_trade);
+        }
+        if (input == "suggest") {
+            suggest_trade_prompt(board, subject_player);
+            continue;
         }
         if (!vector_has_value(options, input)) {
-            cout << "Your response was invalid." << endl;
+            game_output() << "Your response was invalid." << '\n';
             continue;
         }
-        shared_ptr<Player> target_player = GameBank::instance().get_player(input);
+        shared_ptr<Player> target_player = subject_player->get_context().get_player(input);
         if (target_player == nullptr) {
-            cout << "SOMETHING WENT WRONG WITH THE GAMEBANK GETPLAYER" << endl;
-            return;
+            game_output() << "SOMETHING WENT WRONG WITH THE GAMEBANK GETPLAYER" << '\n';
+            return false;
         }
-        cout << subject_player->get_name() << " has decided to propose a trade with " << target_player->get_name() << ". " << endl;
+        game_output() << subject_player->get_name() << " has decided to propose a trade with " << target_player->get_name() << ". " << '\n';
 
-        map<tile_type, int> current_payment;
-        map<tile_type, int> current_gain;
+        ResourceVector current_payment;
+        ResourceVector current_gain;
         string trade_input;
         string previous_input;
         while (true) {
-            cout << subject_player->get_name() << " How would you like to proceed with the trade?" << endl;
-            cout << " [Quit]  [Modify]  [Confirm]  [Review]" << endl;
+            game_output() << subject_player->get_name() << " How would you like to proceed with the trade?" << '\n';
+            game_output() << " [Quit]  [Modify]  [Confirm]  [Review]" << '\n';
             getline(cin, trade_input);
             if (trade_input.empty()) {
-                cout << "It seems you didn't enter anything." << endl;
+                game_output() << "It seems you didn't enter anything." << '\n';
                 continue;
             }
             trade_input = get_lowercase(trade_input);
@@ -1209,22 +1169,22 @@ void trade_prompt(const Board &board, const shared_ptr<Player> &subject_player,
                 previous_input = "confirm";
 
                 if (!valid_trade_side(current_payment)) {
-                    cout << "You cannot confirm a trade with no payment. " << endl;
+                    game_output() << "You cannot confirm a trade with no payment. " << '\n';
                     continue;
                 }
 
                 if (!valid_trade_side(current_gain)) {
-                    cout << "You cannot confirm a trade with no gain. " << endl;
+                    game_output() << "You cannot confirm a trade with no gain. " << '\n';
                     continue;
                 }
 
                 if (previous_input == "modify") {
-                    cout << "The trade is the following: " << endl;
+                    game_output() << "The trade is the following: " << '\n';
                     display_trade(subject_player, target_player, current_payment, current_gain);
                 }
                 bool result = trade_confirm_prompt(subject_player, target_player, current_payment, current_gain);
                 if (!result) {
-                    return;
+                    return false;
                 }
                 continue;
             }
@@ -1233,43 +1193,36 @@ void trade_prompt(const Board &board, const shared_ptr<Player> &subject_player,
                 display_trade(subject_player, target_player, current_payment, current_gain);
                 continue;
             }
-            cout << "Invalid input." << endl;
+            game_output() << "Invalid input." << '\n';
         }
     }
 }
 
-void maritime_trade(const shared_ptr<Player> &subject_player, const vector<tile_type> &typed_ports, const bool with_universal_port) {
+bool maritime_trade(const Board &board, const shared_ptr<Player> &subject_player, Action &trade) {
 
-    int trade_price = with_universal_port ? 3 : 4;
-
-    map<tile_type, int> trade_rates = {
-        {GRAIN, trade_price},
-        {WOOL, trade_price},
-        {BRICK, trade_price},
-        {ORE, trade_price},
-        {LUMBER, trade_price}};
-
-    for (auto &type : typed_ports) {
-        if (trade_rates.find(type) != trade_rates.end()) {
-            trade_rates[type] = 2;
-        }
+    // The board keeps the ports each player can use, so the rates are direct lookups
+    const BoardBitboards &bitboards = board.get_bitboards();
+    ResourceVector trade_rates;
+    for (tile_type type : RESOURCE_TYPES) {
+        trade_rates.set(type, bitboards.get_trade_rate(subject_player->get_color(), type));
     }
 
     // Gets a list of all resources the player does not have enough of to trade.
     vector<tile_type> invalid_payments;
 
-    for (auto &res : subject_player->get_resources()) {
-        if (res.second < trade_rates.at(res.first)) {
-            invalid_payments.push_back(res.first);
+    ResourceVector hand = subject_player->get_resources();
+    for (tile_type type : RESOURCE_TYPES) {
+        if (hand.get(type) < trade_rates.get(type)) {
+            invalid_payments.push_back(type);
         }
     }
 
-    cout << "Trade rates: " << endl;
-    for (auto &rate : trade_rates) {
-        string material = get_resource_conversion_to_string().at(rate.first);
-        cout << " | " << material << " - " << rate.second << ":1 ";
+    game_output() << "Trade rates: " << '\n';
+    for (tile_type type : RESOURCE_TYPES) {
+        string material = get_resource_conversion_to_string().at(type);
+        game_output() << " | " << material << " - " << trade_rates.get(type) << ":1 ";
     }
-    cout << " |" << endl;
+    game_output() << " |" << '\n';
 
     tile_type payment = resource_choice_prompt(
         subject_player,
@@ -1279,7 +1232,7 @@ void maritime_trade(const shared_ptr<Player> &subject_player, const vector<tile_
         invalid_payments,
         "Please choose the resource you will pay - ");
     if (payment == TILE_EMPTY) {
-        return;
+        return false;
     }
 
     tile_type gain = resource_choice_prompt(
@@ -1290,42 +1243,88 @@ void maritime_trade(const shared_ptr<Player> &subject_player, const vector<tile_
         {},
         "Please choose a resource to receive - ");
     if (gain == TILE_EMPTY) {
-        return;
+        return false;
     }
 
-    subject_player->discard_many_resources({{payment, trade_rates.at(payment)}}, "traded away", true);
-    subject_player->gain_many_resources({{gain, 1}}, true);
+    trade.type = MARITIME_TRADE;
+    trade.give = payment;
+    trade.give_amount = trade_rates.get(payment);
+    trade.receive = gain;
+    return true;
+}
+
+void suggest_trade_prompt(const Board &board, const shared_ptr<Player> &player) {
+    INSTRUMENT_SCOPE("suggest_trade_prompt");
+    map<tile_type, string> conversion = get_resource_conversion_to_string();
+    vector<string> options = {"settlement", "city", "road", "development card"};
+    vector<string> alternate_codes = {"settle", "s", "c", "r", "devcard", "d"};
+
+    string input;
+    while (true) {
+        game_output() << player->get_name() << ", what would you like to be able to afford?" << '\n';
+        game_output() << " [Quit]  [Settlement]  [City]  [Road]  [Development Card]" << '\n';
+        getline(cin, input);
+        if (input.empty()) {
+            game_output() << "It seems you didn't enter anything." << '\n';
+            continue;
+        }
+        input = get_lowercase(input);
+        if (input == "quit") {
+            return;
+        }
+        if (!vector_has_value(options, input) && !vector_has_value(alternate_codes, input)) {
+            game_output() << "Your response was invalid." << '\n';
+            continue;
+        }
+        break;
+    }
 
+    ActionList trades;
+    int cost = TradePlanner::plan(board, *player, player->get_context().get_bank(), Craftable::get_recipe(input), trades);
+    if (cost == 0) {
+        game_output() << "You can already afford that." << '\n';
+        return;
+    }
+    if (cost == TradePlanner::NO_PLAN) {
+        game_output() << "No trades with the bank would let you afford that." << '\n';
+        return;
+    }
+    game_output() << "The cheapest way is to trade " << cost << " cards with the bank:" << '\n';
+    for (const Action &trade : trades) {
+        game_output() << " - " << trade.give_amount << " " << conversion.at(trade.give) << " for 1 " <<
+            conversion.at(trade.receive) << '\n';
+    }
 }
 
 bool trade_confirm_prompt(
     const shared_ptr<Player> &proposer, const shared_ptr<Player> &target_player,
-    const map<tile_type, int> &proposers_payment, const map<tile_type, int> &targets_payment) {
+    const ResourceVector &proposers_payment, const ResourceVector &targets_payment) {
+    INSTRUMENT_SCOPE("trade_confirm_prompt");
 
     string input;
     while (true) {
-        cout << target_player->get_name() << ", would you like to [Confirm], [Deny], or [Suggest] changes." << endl;
+        game_output() << target_player->get_name() << ", would you like to [Confirm], [Deny], or [Suggest] changes." << '\n';
         getline(cin, input);
         if (input.empty()) {
-            cout << "It seems you didn't enter anything." << endl;
+            game_output() << "It seems you didn't enter anything." << '\n';
             continue;
         }
         input = get_lowercase(input);
         if (input == "quit") {
-            cout << "You cannot quit from this game action." << endl;
+            game_output() << "You cannot quit from this game action." << '\n';
             continue;
         }
         if (input == "deny") {
-            cout << target_player->get_name() << " has denied the trade." << endl;
+            game_output() << target_player->get_name() << " has denied the trade." << '\n';
             return false;
         }
         if (input == "confirm") {
             if (!target_player->can_afford(targets_payment, false)) {
-                cout << "Sorry " << target_player->get_name() << ", " << proposer->get_name() << " was too ambitious." << endl;
+                game_output() << "Sorry " << target_player->get_name() << ", " << proposer->get_name() << " was too ambitious." << '\n';
                 target_player->can_afford(targets_payment, true);
                 continue;
             }
-            cout << target_player->get_name() << " has confirmed the trade." << endl;
+            game_output() << target_player->get_name() << " has confirmed the trade." << '\n';
 
             proposer->discard_many_resources(proposers_payment, "traded away", false);
             target_player->gain_many_resources(proposers_payment, false);
@@ -1336,61 +1335,86 @@ bool trade_confirm_prompt(
             return false;
         }
         if (input == "suggest") {
-            cout << target_player->get_name() << " would like some changes made to the trade." << endl;
+            game_output() << target_player->get_name() << " would like some changes made to the trade." << '\n';
             return true;
         }
         if (input == "suggest changes") {
-            cout << "There is no command called suggest changes. Did you mean 'suggest'?" << endl;
+            game_output() << "There is no command called suggest changes. Did you mean 'suggest'?" << '\n';
             continue;
         }
-        cout << "Invalid input." << endl;
+        game_output() << "Invalid input." << '\n';
     }
 }
 
-void display_trade(const shared_ptr<Player> &proposer, const shared_ptr<Player> &target_player, const map<tile_type, int> &payment, const map<tile_type, int> &gain) {
+bool trade_response_prompt(
+    const shared_ptr<Player> &proposer, const shared_ptr<Player> &target_player,
+    const ResourceVector &proposers_payment, const ResourceVector &targets_payment) {
+    INSTRUMENT_SCOPE("trade_response_prompt");
+
+    display_trade(proposer, target_player, proposers_payment, targets_payment);
+    string input;
+    while (true) {
+        game_output() << target_player->get_name() << ", would you like to [Confirm] or [Deny] the trade." << '\n';
+        getline(cin, input);
+        if (input.empty()) {
+            game_output() << "It seems you didn't enter anything." << '\n';
+            continue;
+        }
+        input = get_lowercase(input);
+        if (input == "deny" || input == "quit") {
+            return false;
+        }
+        if (input == "confirm") {
+            if (!target_player->can_afford(targets_payment, true)) {
+                return false;
+            }
+            return true;
+        }
+        game_output() << "Invalid input." << '\n';
+    }
+}
+
+void display_trade(const shared_ptr<Player> &proposer, const shared_ptr<Player> &target_player, const ResourceVector &payment, const ResourceVector &gain) {
     map<tile_type, string> resource_conversion = get_resource_conversion_to_string();
-    cout << proposer->get_name() << " ----> " << target_player->get_name() << endl;
+    game_output() << proposer->get_name() << " ----> " << target_player->get_name() << '\n';
     if (!valid_trade_side(payment)) {
-        cout << " * No Payment * " << endl;
+        game_output() << " * No Payment * " << '\n';
     } else {
-        for (auto &resource : payment) {
-            cout << " - " << resource.second << " " << resource_conversion.at(resource.first) << endl;
+        for (tile_type resource : RESOURCE_TYPES) {
+            if (payment.get(resource) > 0) {
+                game_output() << " - " << payment.get(resource) << " " << resource_conversion.at(resource) << '\n';
+            }
         }
     }
-    cout << proposer->get_name() << " <---- " << target_player->get_name() << endl;
+    game_output() << proposer->get_name() << " <---- " << target_player->get_name() << '\n';
     if (!valid_trade_side(gain)) {
-        cout << " * No Gain * " << endl;
+        game_output() << " * No Gain * " << '\n';
     } else {
-        for (auto &resource : gain) {
-            cout << " - " << resource.second << " " << resource_conversion.at(resource.first) << endl;
+        for (tile_type resource : RESOURCE_TYPES) {
+            if (gain.get(resource) > 0) {
+                game_output() << " - " << gain.get(resource) << " " << resource_conversion.at(resource) << '\n';
+            }
         }
     }
 
 }
 
-bool valid_trade_side(const map<tile_type, int> &payment) {
-    if (payment.size() == 0) {
-        return false;
-    }
-    for (auto &resource : payment) {
-        if (resource.second > 0) {
-            return true;
-        }
-    }
-    return false;
+bool valid_trade_side(const ResourceVector &payment) {
+    return !payment.is_empty();
 }
 
-void modify_trade_prompt(const shared_ptr<Player> &proposer, map<tile_type, int> &payment, map<tile_type, int> &gain) {
+void modify_trade_prompt(const shared_ptr<Player> &proposer, ResourceVector &payment, ResourceVector &gain) {
+    INSTRUMENT_SCOPE("modify_trade_prompt");
     map<tile_type, string> resource_conversion = get_resource_conversion_to_string();
     string input;
     string target_aspect;
     string change;
     while (true) {
-        cout << "How would you like to change about the trade?" << endl;
-        cout << " [Quit]  [Payment]  [Gain]" << endl;
+        game_output() << "How would you like to change about the trade?" << '\n';
+        game_output() << " [Quit]  [Payment]  [Gain]" << '\n';
         getline(cin, input);
         if (input.empty()) {
-            cout << "It seems you didn't enter anything." << endl;
+            game_output() << "It seems you didn't enter anything." << '\n';
             continue;
         }
         input = get_lowercase(input);
@@ -1405,15 +1429,15 @@ void modify_trade_prompt(const shared_ptr<Player> &proposer, map<tile_type, int>
             target_aspect = "gain";
             break;
         }
-        cout << "Invalid input." << endl;
+        game_output() << "Invalid input." << '\n';
     }
 
     while (true) {
-        cout << "What would you like to do?" << endl;
-        cout << " [Quit]  [Add]  [Subtract]" << endl;
+        game_output() << "What would you like to do?" << '\n';
+        game_output() << " [Quit]  [Add]  [Subtract]" << '\n';
         getline(cin, input);
         if (input.empty()) {
-            cout << "It seems you didn't enter anything." << endl;
+            game_output() << "It seems you didn't enter anything." << '\n';
             continue;
         }
         input = get_lowercase(input);
@@ -1428,12 +1452,12 @@ void modify_trade_prompt(const shared_ptr<Player> &proposer, map<tile_type, int>
             change = "subtract";
             break;
         }
-        cout << "Invalid input." << endl;
+        game_output() << "Invalid input." << '\n';
     }
 
     tile_type resource_choice;
     while (true) {
-        cout << "Choose a resource to " << change << ". ";
+        game_output() << "Choose a resource to " << change << ". ";
         resource_choice = resource_choice_prompt(
             proposer, false,
             change == "add" && target_aspect == "payment", true);
@@ -1441,14 +1465,9 @@ void modify_trade_prompt(const shared_ptr<Player> &proposer, map<tile_type, int>
             return;
         }
 
-        int max_addition;
-        if (payment.find(resource_choice) == payment.end()) {
-            max_addition = proposer->get_amount_of_resource(resource_choice);
-        } else {
-            max_addition = proposer->get_amount_of_resource(resource_choice) - payment.at(resource_choice);
-        }
+        int max_addition = proposer->get_amount_of_resource(resource_choice) - payment.get(resource_choice);
         if (target_aspect == "payment") {
-            cout << "You have " << max_addition << " " <<
+            game_output() << "You have " << max_addition << " " <<
                 resource_conversion.at(resource_choice) << " that has not been added to the trade.";
         }
         int num = generic_int_prompt(
@@ -1456,12 +1475,12 @@ void modify_trade_prompt(const shared_ptr<Player> &proposer, map<tile_type, int>
             "It seems you didn't enter anything",
             "Invalid input for number of resources.");
         if (num <= 0) {
-            cout << "Invalid input. You cannot " << change << " " << num << " " << resource_conversion.at(resource_choice) << "." << endl;
+            game_output() << "Invalid input. You cannot " << change << " " << num << " " << resource_conversion.at(resource_choice) << "." << '\n';
             continue;
         }
         if (change == "add" && target_aspect == "payment" && num > max_addition) {
-            cout << "You cannot add " << num << " " << resource_conversion.at(resource_choice) <<
-                " to the payment. You only have " << max_addition << " left that has not been added already." << endl;
+            game_output() << "You cannot add " << num << " " << resource_conversion.at(resource_choice) <<
+                " to the payment. You only have " << max_addition << " left that has not been added already." << '\n';
             continue;
         }
 
@@ -1475,73 +1494,68 @@ void modify_trade_prompt(const shared_ptr<Player> &proposer, map<tile_type, int>
 }
 
 void modify_trade_side(
-    map<tile_type, int> &side, const string change,
+    ResourceVector &side, const string change,
     const string target_aspect, const tile_type resource, const int amount) {
     if (!vector_has_value({"add", "subtract"}, change) || !vector_has_value({"payment", "gain"}, target_aspect)) {
-        cout << "SOMETHING WENT WRONG WITH PROVIDED CHANGE OR TARGET ASPECT" << endl;
+        game_output() << "SOMETHING WENT WRONG WITH PROVIDED CHANGE OR TARGET ASPECT" << '\n';
         return;
     }
     if (resource == TILE_EMPTY) {
-        cout << "RESOURCE TO ADD/SUBTRACT FROM TRADE SIDE INVALID" << endl;
+        game_output() << "RESOURCE TO ADD/SUBTRACT FROM TRADE SIDE INVALID" << '\n';
         return;
     }
     map<tile_type, string> resource_conversion = get_resource_conversion_to_string();
-    if (side.find(resource) == side.end() && change == "add") {
-        side.insert({resource, amount});
-        cout << amount << " " << resource_conversion.at(resource) << " added to "  << target_aspect << "." << endl;
-    } else {
-        for (auto &res : side) {
-            if (res.first == resource) {
-                if (change == "add") {
-                    res.second += amount;
-                    cout << amount << " " << resource_conversion.at(resource) << " added to "  << target_aspect << "." << endl;
-                } else {
-                    int delta = max(res.second, amount);
-                    res.second -= delta;
-                    cout << delta << " " << resource_conversion.at(resource) << " subtracted from " << target_aspect << "." << endl;
-                }
-            }
-        }
+    if (change == "add") {
+        side.add(resource, amount);
+        game_output() << amount << " " << resource_conversion.at(resource) << " added to "  << target_aspect << "." << '\n';
+    } else if (side.get(resource) > 0) {
+        // Only what is on the side can be taken off it
+        int delta = min(side.get(resource), amount);
+        side.add(resource, -delta);
+        game_output() << delta << " " << resource_conversion.at(resource) << " subtracted from " << target_aspect << "." << '\n';
     }
 }
 
 void help_message() {
-    cout << "| How To Play |\n";
-    cout << "Settlers of Catan is a game about collecting and managing resources and expanding your settlements across the island." << endl;
-    cout << "Unfortunately, this is not Settlers of Catan, but rather Hex Settlers..." << endl;;
-    cout << "Hex Settlers has the same rules as Settlers of Catan, so for any specific\n"
-            "rules queries, you may need to seek an official rulebook" << endl;
-    cout << "\n| Basics |\n";
-    cout << " - A players turn starts with rolling two six sided dice.\n"
-            "The result determines the resources gathered based on the numbers displayed on the tiles." << endl;
-    cout << " - If a tile has the robber {!R!} on it, it will not generate resources." << endl;
-    cout << " - Settlements (S) generate 1 resource while Cities (C) generate 2 resources" << endl;
-    cout << " - A city must be placed replacing an existing settlement you own." << endl;
-    cout << " - Settlements cannot be placed within 1 space of another and usually must be placed at the end of a road you own." << endl;
-    cout << " - You use resources to craft development cards for powerful effects, or buildings/roads to expand your rule." << endl;;
-    cout << " - The winner is the first person to 10 points. Points are determined mostly by buildings.\n"
-            "Settlements (1 point each); Cities (2 points each)." << endl;
-    cout << " - ... but there are also special awards for players with both the largest army of knight cards played, and the longest\n"
-            "continuous road. Both of these are worth 2 points." << endl;
-    cout << " - You may trade resources with other willing players on your turn, or the bank but at a steep cost (4:1)\n" << endl;
-    cout << "That's pretty much it for the basics of Hex Settlers. Good luck!\n" << endl;
+    game_output() << "| How To Play |\n";
+    game_output() << "Settlers of Catan is a game about collecting and managing resources and expanding your settlements across the island." << '\n';
+    game_output() << "Unfortunately, this is not Settlers of Catan, but rather Hex Settlers..." << '\n';;
+    game_output() << "Hex Settlers has the same rules as Settlers of Catan, so for any specific\n"
+            "rules queries, you may need to seek an official rulebook" << '\n';
+    game_output() << "\n| Basics |\n";
+    game_output() << " - A players turn starts with rolling two six sided dice.\n"
+            "The result determines the resources gathered based on the numbers displayed on the tiles." << '\n';
+    game_output() << " - If a tile has the robber {!R!} on it, it will not generate resources." << '\n';
+    game_output() << " - Settlements (S) generate 1 resource while Cities (C) generate 2 resources" << '\n';
+    game_output() << " - A city must be placed replacing an existing settlement you own." << '\n';
+    game_output() << " - Settlements cannot be placed within 1 space of another and usually must be placed at the end of a road you own." << '\n';
+    game_output() << " - You use resources to craft development cards for powerful effects, or buildings/roads to expand your rule." << '\n';;
+    game_output() << " - The winner is the first person to 10 points. Points are determined mostly by buildings.\n"
+            "Settlements (1 point each); Cities (2 points each)." << '\n';
+    game_output() << " - ... but there are also special awards for players with both the largest army of knight cards played, and the longest\n"
+            "continuous road. Both of these are worth 2 points." << '\n';
+    game_output() << " - You may trade resources with other willing players on your turn, or the bank but at a steep cost (4:1)\n" << '\n';
+    game_output() << "That's pretty much it for the basics of Hex Settlers. Good luck!\n" << '\n';
 }
 
 void recipe_message() {
     map<tile_type, string> conversion = get_resource_conversion_to_string();
-    cout << "Crafting Recipes:" << endl;
+    game_output() << "Crafting Recipes:" << '\n';
 
     vector<string> craftables = {"settlement", "city", "road", "devcard"};
     for (string craft : craftables) {
-        cout << " - " << get_capitalized(craft) << ": ";
-        for (auto &res : Craftable::get_recipe(craft)) {
-            cout << res.second << " " << conversion.at(res.first) << " | ";
+        game_output() << " - " << get_capitalized(craft) << ": ";
+        ResourceVector recipe = Craftable::get_recipe(craft);
+        for (tile_type resource : RESOURCE_TYPES) {
+            if (recipe.get(resource) > 0) {
+                game_output() << recipe.get(resource) << " " << conversion.at(resource) << " | ";
+            }
         }
-        cout << endl;
+        game_output() << '\n';
     }
-    cout << endl;
+    game_output() << '\n';
 }
 
 void welcome_message() {
-    cout << "\n| Welcome to Hex Settlers |\n" << endl;
+    game_output() << "\n| Welcome to Hex Settlers |\n" << '\n';
 }
\ No newline at end of file
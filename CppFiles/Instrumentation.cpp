@@ -0,0 +1,268 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/Instrumentation.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define INSTRUMENT_HAS_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define INSTRUMENT_HAS_TSC
+#endif
+
+using std::string, std::vector, std::array, std::uint64_t;
+
+namespace {
+    struct SiteRecord {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> ticks{0};
+        std::atomic<uint64_t> allocations{0};
+    };
+
+    struct ThreadRecords;
+
+    // The sites, and the records of every thread, behind one lock
+    struct Registry {
+        std::mutex lock;
+        vector<const InstrumentSite*> sites;
+        vector<const ThreadRecords*> threads;
+        // What threads which have finished recorded
+        array<InstrumentStats, InstrumentSite::MAX_SITES> finished{};
+    };
+
+    Registry& get_registry() {
+        static Registry registry;
+        return registry;
+    }
+
+    // Only the thread they belong to writes its records, others read them for a report
+    struct ThreadRecords {
+        array<SiteRecord, InstrumentSite::MAX_SITES> records;
+
+        ThreadRecords() {
+            Registry &registry = get_registry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            registry.threads.push_back(this);
+        }
+
+        ~ThreadRecords() {
+            Registry &registry = get_registry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            for (int i = 0; i < InstrumentSite::MAX_SITES; i++) {
+                registry.finished[i].calls += records[i].calls.load(std::memory_order_relaxed);
+                registry.finished[i].ticks += records[i].ticks.load(std::memory_order_relaxed);
+                registry.finished[i].allocations += records[i].allocations.load(std::memory_order_relaxed);
+            }
+            registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+        }
+    };
+
+    ThreadRecords& get_thread_records() {
+        thread_local ThreadRecords records;
+        return records;
+    }
+
+    // Counted by operator new when instrumentation is compiled in
+    thread_local uint64_t thread_allocations = 0;
+
+    // A tick and a time taken together at start up, to work out how long a tick is
+    const uint64_t start_ticks = Instrumentation::now();
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+    // Adds to a record without a locked instruction, as only this thread writes it
+    void add(std::atomic<uint64_t> &record, const uint64_t amount) {
+        record.store(record.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    // Requires the registry's lock
+    InstrumentStats sum_records(const Registry &registry, const int index) {
+        InstrumentStats stats = registry.finished[index];
+        for (const ThreadRecords *thread : registry.threads) {
+            stats.calls += thread->records[index].calls.load(std::memory_order_relaxed);
+            stats.ticks += thread->records[index].ticks.load(std::memory_order_relaxed);
+            stats.allocations += thread->records[index].allocations.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+}
+
+InstrumentSite::InstrumentSite(const char *_name, const bool _timed) : name(_name), timed(_timed), index(-1) {
+    Registry &registry = get_registry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    if (static_cast<int>(registry.sites.size()) < MAX_SITES) {
+        index = registry.sites.size();
+        registry.sites.push_back(this);
+    }
+}
+
+void InstrumentSite::record(const uint64_t calls, const uint64_t ticks, const uint64_t allocations) const {
+    if (index == -1) {
+        return;
+    }
+    SiteRecord &site_record = get_thread_records().records[index];
+    add(site_record.calls, calls);
+    if (timed) {
+        add(site_record.ticks, ticks);
+        add(site_record.allocations, allocations);
+    }
+}
+
+const char* InstrumentSite::get_name() const {
+    return name;
+}
+
+bool InstrumentSite::is_timed() const {
+    return timed;
+}
+
+int InstrumentSite::get_index() const {
+    return index;
+}
+
+ScopedTimer::ScopedTimer(const InstrumentSite &_site)
+    : site(_site), start(Instrumentation::now()), start_allocations(thread_allocations) {}
+
+ScopedTimer::~ScopedTimer() {
+    site.record(1, Instrumentation::now() - start, thread_allocations - start_allocations);
+}
+
+bool Instrumentation::is_compiled_in() {
+#ifdef HEXSETTLERS_INSTRUMENT
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t Instrumentation::now() {
+#ifdef INSTRUMENT_HAS_TSC
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+double Instrumentation::ticks_to_ns(const uint64_t ticks) {
+#ifdef INSTRUMENT_HAS_TSC
+    double elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start_time).count();
+    uint64_t elapsed_ticks = now() - start_ticks;
+    return elapsed_ticks == 0 ? 0.0 : ticks * (elapsed_ns / elapsed_ticks);
+#else
+    return static_cast<double>(ticks);
+#endif
+}
+
+uint64_t Instrumentation::get_thread_allocations() {
+    return thread_allocations;
+}
+
+// Sites with the same name (the overloads of a function, say) are added up together
+InstrumentStats Instrumentation::get_stats(const string &name) {
+    Registry &registry = get_registry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    InstrumentStats total;
+    for (const InstrumentSite *site : registry.sites) {
+        if (name == site->get_name()) {
+            InstrumentStats stats = sum_records(registry, site->get_index());
+            total.calls += stats.calls;
+            total.ticks += stats.ticks;
+            total.allocations += stats.allocations;
+        }
+    }
+    return total;
+}
+
+void Instrumentation::report(std::ostream &out) {
+    if (!is_compiled_in()) {
+        out << "The game was built without instrumentation (see the HEXSETTLERS_INSTRUMENT CMake option)" << '\n';
+        return;
+    }
+
+    // Sites with the same name share a row
+    vector<std::pair<const InstrumentSite*, InstrumentStats>> called;
+    {
+        Registry &registry = get_registry();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        for (const InstrumentSite *site : registry.sites) {
+            InstrumentStats stats = sum_records(registry, site->get_index());
+            auto row = std::find_if(called.begin(), called.end(), [site](const auto &other) {
+                return std::strcmp(other.first->get_name(), site->get_name()) == 0;
+            });
+            if (row == called.end()) {
+                called.emplace_back(site, stats);
+            } else {
+                row->second.calls += stats.calls;
+                row->second.ticks += stats.ticks;
+                row->second.allocations += stats.allocations;
+            }
+        }
+    }
+    called.erase(std::remove_if(called.begin(), called.end(), [](const auto &row) {
+        return row.second.calls == 0;
+    }), called.end());
+    std::sort(called.begin(), called.end(), [](const auto &a, const auto &b) {
+        return a.second.ticks != b.second.ticks ? a.second.ticks > b.second.ticks : a.second.calls > b.second.calls;
+    });
+
+    out << std::left << std::setw(36) << "Call site" << std::right << std::setw(12) << "calls"
+        << std::setw(14) << "total ms" << std::setw(12) << "mean us" << std::setw(14) << "allocations" << '\n';
+    out << std::fixed << std::setprecision(2);
+    for (const auto &[site, stats] : called) {
+        out << std::left << std::setw(36) << site->get_name() << std::right << std::setw(12) << stats.calls;
+        if (site->is_timed()) {
+            double total_ns = ticks_to_ns(stats.ticks);
+            out << std::setw(14) << total_ns / 1e6 << std::setw(12) << total_ns / 1e3 / stats.calls
+                << std::setw(14) << stats.allocations;
+        }
+        out << '\n';
+    }
+    out << "Allocations on this thread: " << get_thread_allocations() << '\n';
+}
+
+#ifdef HEXSETTLERS_INSTRUMENT
+
+// Every allocation is counted on the thread making it, so a timed site can tell how many it made
+
+void* operator new(std::size_t size) {
+    thread_allocations++;
+    void *memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+#endif
@@ -0,0 +1,169 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/LegalActionGenerator.h"
+#include "../HeaderFiles/Board.h"
+#include "../HeaderFiles/Player.h"
+#include "../HeaderFiles/GameBank.h"
+#include "../HeaderFiles/Craftable.h"
+
+void ActionList::clear() {
+    count = 0;
+}
+
+void ActionList::push(const Action &action) {
+    if (count < CAPACITY) {
+        actions[count] = action;
+        count++;
+    }
+}
+
+int ActionList::size() const {
+    return count;
+}
+
+bool ActionList::empty() const {
+    return count == 0;
+}
+
+const Action& ActionList::operator[](const int index) const {
+    return actions[index];
+}
+
+int ActionList::count_of(const action_type type) const {
+    int number = 0;
+    for (const Action &action : *this) {
+        if (action.type == type) {
+            number++;
+        }
+    }
+    return number;
+}
+
+const Action* ActionList::begin() const {
+    return actions.data();
+}
+
+const Action* ActionList::end() const {
+    return actions.data() + count;
+}
+
+void LegalActionGenerator::generate(const Board &board, const Player &player, const GameBank &bank, ActionList &actions) {
+    actions.clear();
+    add_builds(board, player, actions);
+    add_devcards(board, player, bank, actions);
+    add_trades(board, player, bank, actions);
+
+    Action pass;
+    pass.type = PASS_TURN;
+    actions.push(pass);
+}
+
+void LegalActionGenerator::add_builds(const Board &board, const Player &player, ActionList &actions) {
+    const BoardBitboards &bitboards = board.get_bitboards();
+    player_color color = player.get_color();
+
+    // Settlements need the pieces, the resources, and an empty plot at the end of one of the player's roads
+    if (player.get_settlement_pieces() > 0 && player.can_afford(Craftable::SETTLEMENT_RECIPE, false)) {
+        PlotMask plots = bitboards.get_buildable_plots(color, true);
+        while (plots != 0) {
+            Action action;
+            action.type = BUILD_SETTLEMENT;
+            action.target = lowest_bit(plots);
+            actions.push(action);
+            plots &= plots - 1;
+        }
+    }
+
+    // Cities go on top of the player's own settlements
+    if (player.get_city_pieces() > 0 && player.can_afford(Craftable::CITY_RECIPE, false)) {
+        PlotMask plots = bitboards.get_settlements(color);
+        while (plots != 0) {
+            Action action;
+            action.type = BUILD_CITY;
+            action.target = lowest_bit(plots);
+            actions.push(action);
+            plots &= plots - 1;
+        }
+    }
+
+    // Roads go on empty paths next to one of the player's roads
+    if (player.get_road_pieces() > 0 && player.can_afford(Craftable::ROAD_RECIPE, false)) {
+        PathMask paths = bitboards.get_buildable_paths(color, true);
+        const std::uint64_t halves[2] = {paths.low, paths.high};
+        for (int h = 0; h < 2; h++) {
+            std::uint64_t half = halves[h];
+            while (half != 0) {
+                Action action;
+                action.type = BUILD_ROAD;
+                action.target = h * 64 + lowest_bit(half);
+                actions.push(action);
+                half &= half - 1;
+            }
+        }
+    }
+}
+
+// Same rules as DevCard::test_playability, without the messages
+void LegalActionGenerator::add_devcards(const Board &board, const Player &player, const GameBank &bank, ActionList &actions) {
+    if (bank.has_devcard() && player.can_afford(Craftable::DEVCARD_RECIPE, false)) {
+        Action action;
+        action.type = BUY_DEVCARD;
+        actions.push(action);
+    }
+
+    if (player.has_played_devcard_this_turn()) {
+        return;
+    }
+
+    bool bank_has_resources = false;
+    for (tile_type resource : RESOURCE_TYPES) {
+        bank_has_resources = bank_has_resources || bank.has_resource(resource);
+    }
+
+    // Only one action per type of card, since which copy is played doesn't matter
+    bool type_added[CARD_EMPTY] = {};
+    for (const DevCard &card : player.get_devcards()) {
+        devcard_type type = card.get_type();
+        if (card.was_bought_this_turn() || type == VICTORY_POINT || type == CARD_EMPTY || type_added[type]) {
+            continue;
+        }
+        if (type == ROAD_BUILDING && !board.get_bitboards().can_place_road(player.get_color())) {
+            continue;
+        }
+        if (type == YEAR_OF_PLENTY && !bank_has_resources) {
+            continue;
+        }
+        type_added[type] = true;
+
+        Action action;
+        action.type = PLAY_DEVCARD;
+        action.target = type;
+        actions.push(action);
+    }
+}
+
+int LegalActionGenerator::get_trade_rate(const Board &board, const Player &player, const tile_type resource) {
+    return board.get_bitboards().get_trade_rate(player.get_color(), resource);
+}
+
+void LegalActionGenerator::add_trades(const Board &board, const Player &player, const GameBank &bank, ActionList &actions) {
+    for (tile_type give : RESOURCE_TYPES) {
+        int rate = get_trade_rate(board, player, give);
+        if (player.get_amount_of_resource(give) < rate) {
+            continue;
+        }
+        for (tile_type receive : RESOURCE_TYPES) {
+            if (receive == give || !bank.has_resource(receive)) {
+                continue;
+            }
+            Action action;
+            action.type = MARITIME_TRADE;
+            action.give = give;
+            action.give_amount = rate;
+            action.receive = receive;
+            actions.push(action);
+        }
+    }
+}
@@ -0,0 +1,128 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/LongestRoadEngine.h"
+#include "../HeaderFiles/Instrumentation.h"
+
+#include <algorithm>
+
+using namespace std;
+
+void LongestRoadEngine::road_placed(const BoardBitboards &bitboards, const PathId path, const player_color color) {
+    if (color < 0 || color >= BoardBitboards::COLOR_COUNT) {
+        return;
+    }
+    rebuild(bitboards, color, PathMask::bit(path) | bitboards.get_path_neighbours(path));
+}
+
+void LongestRoadEngine::building_placed(const BoardBitboards &bitboards, const PlotId plot) {
+    PathMask incident = bitboards.get_plot_paths(plot);
+    for (int c = 0; c < BoardBitboards::COLOR_COUNT; c++) {
+        player_color color = static_cast<player_color>(c);
+        if ((bitboards.get_roads(color) & incident).any()) {
+            rebuild(bitboards, color, incident);
+        }
+    }
+}
+
+int LongestRoadEngine::get_length(const player_color color) const {
+    if (color < 0 || color >= BoardBitboards::COLOR_COUNT) {
+        return 0;
+    }
+    return lengths[color];
+}
+
+const vector<RoadComponent>& LongestRoadEngine::get_components(const player_color color) const {
+    return components[color];
+}
+
+void LongestRoadEngine::rebuild(const BoardBitboards &bitboards, const player_color color, const PathMask &changed) {
+    INSTRUMENT_SCOPE("LongestRoadEngine::rebuild");
+    PathMask roads = bitboards.get_roads(color);
+    PlotMask broken = get_broken_plots(bitboards, color);
+
+    // Pull out every component touching the change, and pool their roads with any new ones
+    PathMask pool = changed & roads;
+    vector<RoadComponent> &color_components = components[color];
+    vector<RoadComponent> kept;
+    for (const RoadComponent &component : color_components) {
+        if ((component.roads & changed).any()) {
+            pool |= component.roads;
+        } else {
+            kept.push_back(component);
+        }
+    }
+    color_components = kept;
+
+    // Split the pool back into components by flood filling through plots which aren't broken
+    while (pool.any()) {
+        PathMask component = PathMask::bit(pool.first());
+        PathMask frontier = component;
+        while (frontier.any()) {
+            PathId path = frontier.first();
+            frontier ^= PathMask::bit(path);
+            PlotMask endpoints = bitboards.get_path_plots(path) & ~broken;
+            while (endpoints != 0) {
+                PlotId plot = lowest_bit(endpoints);
+                endpoints &= endpoints - 1;
+                PathMask next = bitboards.get_plot_paths(plot) & pool & ~component;
+                component |= next;
+                frontier |= next;
+            }
+        }
+        pool &= ~component;
+        color_components.push_back({component, longest_trail(bitboards, component, color)});
+    }
+
+    lengths[color] = 0;
+    for (const RoadComponent &component : color_components) {
+        lengths[color] = max(lengths[color], component.length);
+    }
+}
+
+PlotMask LongestRoadEngine::get_broken_plots(const BoardBitboards &bitboards, const player_color color) {
+    return bitboards.get_occupied_plots() & ~bitboards.get_buildings(color);
+}
+
+int LongestRoadEngine::longest_trail(const BoardBitboards &bitboards, const PathMask &roads, const player_color color) {
+    PlotMask broken = get_broken_plots(bitboards, color);
+
+    PlotMask starts = 0;
+    PathMask remaining = roads;
+    while (remaining.any()) {
+        PathId path = remaining.first();
+        remaining ^= PathMask::bit(path);
+        starts |= bitboards.get_path_plots(path);
+    }
+
+    // A trail may start or end on a broken plot, it just can't pass through one
+    int best = 0;
+    while (starts != 0) {
+        PlotId plot = lowest_bit(starts);
+        starts &= starts - 1;
+        best = max(best, trail_from(bitboards, plot, roads, PathMask(), broken));
+    }
+    return best;
+}
+
+int LongestRoadEngine::trail_from(
+    const BoardBitboards &bitboards, const PlotId plot,
+    const PathMask &roads, const PathMask &used, const PlotMask broken) {
+
+    int best = 0;
+    PathMask options = bitboards.get_plot_paths(plot) & roads & ~used;
+    while (options.any()) {
+        PathId path = options.first();
+        options ^= PathMask::bit(path);
+
+        PlotMask other_end = bitboards.get_path_plots(path) & ~(PlotMask(1) << plot);
+        PlotId next = lowest_bit(other_end);
+        int length = 1;
+        if (((broken >> next) & 1) == 0) {
+            length += trail_from(bitboards, next, roads, used | PathMask::bit(path), broken);
+        }
+        best = max(best, length);
+    }
+    return best;
+}
@@ -0,0 +1,420 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/MctsAgent.h"
+#include "../HeaderFiles/Board.h"
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/GameRandom.h"
+#include "../HeaderFiles/Player.h"
+#include "../HeaderFiles/StateEngine.h"
+#include "../HeaderFiles/StatePolicy.h"
+#include "../HeaderFiles/TranspositionTable.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+// Rewards are summed as fixed point numbers, so they can be added atomically
+static const double REWARD_SCALE = 1 << 16;
+
+// Most visits a new node takes over from the table, so what was found elsewhere guides it without drowning
+// out its own playouts
+static const int MAX_PRIOR_VISITS = 16;
+
+struct MctsNode {
+    // The action which led here, and the roll or devcard drawn after it if this is a chance outcome
+    Action action;
+    int outcome = -1;
+    // The player who chose the action. Rewards here are that player's
+    player_color mover = COLOR_EMPTY;
+    // Children are the outcomes of rolling the dice or drawing a devcard after the action, not actions
+    bool chance = false;
+
+    std::atomic<int> visits{0};
+    std::atomic<int> virtual_losses{0};
+    std::atomic<std::int64_t> reward{0};
+
+    // Guards children, which other threads may be adding to
+    std::mutex lock;
+    vector<unique_ptr<MctsNode>> children;
+};
+
+// What every searching thread shares
+struct MctsSearch {
+    const MctsOptions &options;
+    const GameState &root_state;
+    player_color observer;
+    MctsNode root;
+    chrono::steady_clock::time_point deadline;
+    std::atomic<int> playouts{0};
+    // What the nodes have found about the positions after their actions, shared by every node reaching them
+    unique_ptr<TranspositionTable> table;
+    std::atomic<int> transpositions{0};
+
+    MctsSearch(const MctsOptions &_options, const GameState &_root_state)
+        : options(_options), root_state(_root_state), observer(static_cast<player_color>(_root_state.current_player)) {
+        if (options.transposition_log2 > 0) {
+            table = make_unique<TranspositionTable>(options.transposition_log2);
+        }
+    }
+};
+
+/**
+* Requires: two actions
+* Modifies: nothing
+* Effects: returns if the actions are the same
+*/
+static bool same_action(const Action &a, const Action &b) {
+    return a.type == b.type && a.target == b.target && a.give == b.give && a.give_amount == b.give_amount &&
+        a.receive == b.receive;
+}
+
+/**
+* Requires: state, the player searching, random numbers
+* Modifies: state, random
+* Effects: deals the opponents' devcards again from every card the observer can't see (the deck and the
+* opponents' hands), keeping how many each opponent holds
+*/
+static void determinize(GameState &state, const player_color observer, GameRandom &random) {
+    array<int, CARD_EMPTY> pool{};
+    int pool_size = 0;
+    for (int type = 0; type < CARD_EMPTY; type++) {
+        pool[type] = state.deck[type];
+        for (int other = 0; other < state.player_count; other++) {
+            if (other != observer) {
+                pool[type] += state.players[other].devcards[type] + state.players[other].new_devcards[type];
+            }
+        }
+        pool_size += pool[type];
+    }
+
+    auto deal = [&](array<std::uint8_t, CARD_EMPTY> &hand) {
+        int count = 0;
+        for (std::uint8_t &held : hand) {
+            count += held;
+            held = 0;
+        }
+        for (int i = 0; i < count && pool_size > 0; i++) {
+            int card = random.next_int(pool_size);
+            int type = 0;
+            while (card >= pool[type]) {
+                card -= pool[type];
+                type++;
+            }
+            pool[type]--;
+            pool_size--;
+            hand[type]++;
+        }
+    };
+    for (int other = 0; other < state.player_count; other++) {
+        if (other != observer) {
+            deal(state.players[other].devcards);
+            deal(state.players[other].new_devcards);
+        }
+    }
+    for (int type = 0; type < CARD_EMPTY; type++) {
+        state.deck[type] = pool[type];
+    }
+}
+
+/**
+* Requires: parent node, children to choose from (locked by the caller), exploration
+* Modifies: nothing
+* Effects: returns the child with the best UCT score. Virtual losses count as visits which scored 0
+*/
+static MctsNode* select_uct(const MctsNode &parent, const vector<MctsNode*> &options, const double exploration) {
+    double parent_visits = parent.visits.load(memory_order_relaxed) + parent.virtual_losses.load(memory_order_relaxed) + 1;
+    double log_parent = log(parent_visits);
+    MctsNode *best = nullptr;
+    double best_score = -1;
+    for (MctsNode *child : options) {
+        double visits = child->visits.load(memory_order_relaxed) + child->virtual_losses.load(memory_order_relaxed);
+        double mean = child->reward.load(memory_order_relaxed) / REWARD_SCALE / max(visits, 1.0);
+        double score = mean + exploration * sqrt(log_parent / max(visits, 1.0));
+        if (score > best_score) {
+            best = child;
+            best_score = score;
+        }
+    }
+    return best;
+}
+
+/**
+* Requires: chance node, the outcome rolled or drawn
+* Modifies: node's children
+* Effects: returns the node's child for the outcome, adding it if this is the first time it came up
+*/
+static MctsNode* outcome_child(MctsNode &node, const int outcome) {
+    lock_guard<mutex> guard(node.lock);
+    for (unique_ptr<MctsNode> &child : node.children) {
+        if (child->outcome == outcome) {
+            return child.get();
+        }
+    }
+    node.children.push_back(make_unique<MctsNode>());
+    MctsNode *child = node.children.back().get();
+    child->action = node.action;
+    child->outcome = outcome;
+    child->mover = node.mover;
+    return child;
+}
+
+/**
+* Requires: finished or cut off state
+* Modifies: nothing
+* Effects: returns every color's reward: 1 for the winner, or each player's share of the points
+*/
+static array<double, GameState::PLAYER_COUNT> score_state(const GameState &state) {
+    array<double, GameState::PLAYER_COUNT> rewards{};
+    if (state.winner < GameState::PLAYER_COUNT) {
+        rewards[state.winner] = 1;
+        return rewards;
+    }
+    double total = 0;
+    for (int color = 0; color < state.player_count; color++) {
+        rewards[color] = state.get_points(static_cast<player_color>(color));
+        total += rewards[color];
+    }
+    for (int color = 0; color < state.player_count; color++) {
+        rewards[color] = total > 0 ? rewards[color] / total : 1.0 / state.player_count;
+    }
+    return rewards;
+}
+
+/**
+* Requires: search, random numbers and action list of the thread
+* Modifies: search's tree, random, actions
+* Effects: plays one playout: down the tree, one new node, the StatePolicy to the end, then scores it back up
+*/
+static void run_playout(MctsSearch &search, GameRandom &random, ActionList &actions) {
+    GameState state = search.root_state;
+    determinize(state, search.observer, random);
+
+    vector<MctsNode*> path = {&search.root};
+    vector<MctsNode*> options;
+    // Nodes on the path whose action left its mover still to move, with the hash of the position
+    vector<pair<MctsNode*, std::uint64_t>> positions;
+    MctsNode *node = &search.root;
+    node->virtual_losses.fetch_add(1, memory_order_relaxed);
+
+    bool expanded = false;
+    while (!expanded && state.winner == COLOR_EMPTY) {
+        StateEngine::generate(state, actions);
+
+        MctsNode *child = nullptr;
+        {
+            lock_guard<mutex> guard(node->lock);
+            // Hidden cards and steals differ between playouts, so only the children legal in this one count
+            options.clear();
+            for (const Action &action : actions) {
+                MctsNode *match = nullptr;
+                for (unique_ptr<MctsNode> &existing : node->children) {
+                    if (same_action(existing->action, action)) {
+                        match = existing.get();
+                        break;
+                    }
+                }
+                if (match == nullptr) {
+                    node->children.push_back(make_unique<MctsNode>());
+                    child = node->children.back().get();
+                    child->action = action;
+                    child->mover = static_cast<player_color>(state.current_player);
+                    child->chance = action.type == PASS_TURN || action.type == BUY_DEVCARD;
+                    expanded = true;
+                    break;
+                }
+                options.push_back(match);
+            }
+            if (child == nullptr) {
+                child = select_uct(*node, options, search.options.exploration);
+            }
+        }
+        child->virtual_losses.fetch_add(1, memory_order_relaxed);
+        path.push_back(child);
+
+        int outcome = -1;
+        if (child->action.type == PASS_TURN) {
+            StateEngine::end_turn(state);
+            if (state.winner == COLOR_EMPTY) {
+                outcome = StateEngine::roll_dice(random);
+                StateEngine::start_turn(state, outcome, random);
+            }
+        } else {
+            outcome = StateEngine::apply_action(state, child->action, random);
+        }
+
+        // A new node for a position another order of actions already reached starts from what was found there
+        if (search.table != nullptr && !child->chance && state.winner == COLOR_EMPTY &&
+            state.current_player == child->mover) {
+            std::uint64_t position = state.hash();
+            positions.push_back({child, position});
+            TranspositionEntry entry;
+            if (expanded && search.table->probe(position, entry) && entry.visits > 0) {
+                int prior_visits = min<int>(entry.visits, MAX_PRIOR_VISITS);
+                child->reward.fetch_add(llround(entry.value * prior_visits * REWARD_SCALE), memory_order_relaxed);
+                child->visits.fetch_add(prior_visits, memory_order_relaxed);
+                search.transpositions.fetch_add(1, memory_order_relaxed);
+            }
+        }
+
+        node = child;
+        if (child->chance && outcome != -1) {
+            node = outcome_child(*child, outcome);
+            node->virtual_losses.fetch_add(1, memory_order_relaxed);
+            path.push_back(node);
+        }
+    }
+
+    if (state.winner == COLOR_EMPTY) {
+        StatePolicy::play_out(state, random, search.options.playout_turns);
+    }
+    array<double, GameState::PLAYER_COUNT> rewards = score_state(state);
+
+    for (MctsNode *visited : path) {
+        double reward = visited->mover < GameState::PLAYER_COUNT ? rewards[visited->mover] : 0;
+        visited->reward.fetch_add(llround(reward * REWARD_SCALE), memory_order_relaxed);
+        visited->visits.fetch_add(1, memory_order_relaxed);
+        visited->virtual_losses.fetch_sub(1, memory_order_relaxed);
+    }
+    // MCTS has no search depth, so entries are ranked by how many times their visits doubled instead
+    for (const pair<MctsNode*, std::uint64_t> &position : positions) {
+        int visits = position.first->visits.load(memory_order_relaxed);
+        TranspositionEntry entry;
+        entry.value = static_cast<float>(position.first->reward.load(memory_order_relaxed) / REWARD_SCALE / max(visits, 1));
+        entry.visits = static_cast<std::uint16_t>(min(visits, 0xFFFF));
+        entry.depth = 0;
+        for (int doubled = visits; doubled > 1; doubled >>= 1) {
+            entry.depth++;
+        }
+        entry.best_action = 0;
+        search.table->store(position.second, entry);
+    }
+    search.playouts.fetch_add(1, memory_order_relaxed);
+}
+
+/**
+* Requires: search, the thread's random numbers
+* Modifies: search's tree, random
+* Effects: plays playouts until the deadline or the playout limit
+*/
+static void run_search_thread(MctsSearch &search, GameRandom random) {
+    ActionList actions;
+    while (chrono::steady_clock::now() < search.deadline) {
+        if (search.options.max_playouts > 0 && search.playouts.load(memory_order_relaxed) >= search.options.max_playouts) {
+            return;
+        }
+        run_playout(search, random, actions);
+    }
+}
+
+MctsAgent::MctsAgent(const MctsOptions &_options) : options(_options) {}
+
+MctsResult MctsAgent::search(const GameState &state, const uint64_t seed) const {
+    MctsSearch search(options, state);
+    search.deadline = chrono::steady_clock::now() + chrono::milliseconds(options.time_ms);
+
+    int thread_count = options.threads > 0 ? options.threads : max(1u, thread::hardware_concurrency());
+    // Every thread gets its own stream of random numbers split from the seed
+    GameRandom random(seed);
+    vector<thread> helpers;
+    for (int t = 1; t < thread_count; t++) {
+        helpers.emplace_back(run_search_thread, ref(search), random.split());
+    }
+    run_search_thread(search, random.split());
+    for (thread &helper : helpers) {
+        helper.join();
+    }
+
+    MctsResult result;
+    result.playouts = search.playouts.load();
+    result.transpositions = search.transpositions.load();
+    for (unique_ptr<MctsNode> &child : search.root.children) {
+        int visits = child->visits.load();
+        if (visits > result.visits) {
+            result.action = child->action;
+            result.visits = visits;
+        }
+    }
+    return result;
+}
+
+GameState MctsAgent::observe(const Board &board, const shared_ptr<Player> &player) {
+    GameState state = GameState::capture(board, player->get_context());
+    state.current_player = player->get_color();
+    return state;
+}
+
+PlotId MctsAgent::choose_initial_settlement(Board &board, const shared_ptr<Player> &player) {
+    return StatePolicy::choose_initial_settlement(observe(board, player), player->get_color());
+}
+
+PathId MctsAgent::choose_initial_road(Board &board, const shared_ptr<Player> &player, const PlotId settlement) {
+    return StatePolicy::choose_initial_road(observe(board, player), player->get_color(), settlement);
+}
+
+Action MctsAgent::choose_action(Board &board, const shared_ptr<Player> &player, const ActionList &legal_actions) {
+    if (legal_actions.size() == 1) {
+        return legal_actions[0];
+    }
+    MctsResult result = search(observe(board, player), player->get_context().get_random().next());
+    for (const Action &action : legal_actions) {
+        if (same_action(action, result.action)) {
+            return action;
+        }
+    }
+    // The search plays on a GameState, which lists the same actions, so this is only a safety net
+    return legal_actions[legal_actions.size() - 1];
+}
+
+PathId MctsAgent::choose_free_road(Board &board, const shared_ptr<Player> &player) {
+    return StatePolicy::choose_free_road(observe(board, player), player->get_color(), player->get_context().get_random());
+}
+
+ResourceVector MctsAgent::choose_discard(Board &board, const shared_ptr<Player> &player, const int number_of_resources) {
+    array<int, TILE_EMPTY> discard = StatePolicy::choose_discard(observe(board, player), player->get_color(), number_of_resources);
+    ResourceVector chosen;
+    for (tile_type resource : RESOURCE_TYPES) {
+        chosen.set(resource, discard[resource]);
+    }
+    return chosen;
+}
+
+TileId MctsAgent::choose_robber_tile(Board &board, const shared_ptr<Player> &player) {
+    return StatePolicy::choose_robber_tile(observe(board, player), player->get_color());
+}
+
+player_color MctsAgent::choose_steal_target(Board &board, const shared_ptr<Player> &player, const vector<player_color> &targets) {
+    uint8_t target_mask = 0;
+    for (player_color target : targets) {
+        if (target < GameState::PLAYER_COUNT) {
+            target_mask |= 1 << target;
+        }
+    }
+    player_color target = StatePolicy::choose_steal_target(observe(board, player), player->get_color(), target_mask);
+    return target == COLOR_EMPTY && !targets.empty() ? targets.front() : target;
+}
+
+tile_type MctsAgent::choose_resource(Board &board, const shared_ptr<Player> &player, const devcard_type reason) {
+    return StatePolicy::choose_resource(observe(board, player), player->get_color(), reason);
+}
+
+bool MctsAgent::respond_to_trade(
+    Board &board, const shared_ptr<Player> &player, const shared_ptr<Player> &proposer,
+    const ResourceVector &payment, const ResourceVector &gain) {
+    array<int, TILE_EMPTY> receive{};
+    array<int, TILE_EMPTY> give{};
+    for (tile_type resource : RESOURCE_TYPES) {
+        receive[resource] = payment.get(resource);
+        give[resource] = gain.get(resource);
+    }
+    return StatePolicy::respond_to_trade(observe(board, player), player->get_color(), proposer->get_color(), receive, give);
+}
+
+const MctsOptions& MctsAgent::get_options() const {
+    return options;
+}
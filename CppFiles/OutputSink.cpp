@@ -0,0 +1,106 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/OutputSink.h"
+
+#include <iostream>
+
+namespace {
+    // The sink each thread writes to until it sets another, made the first time the thread prints
+    OutputSink& get_default_sink() {
+        thread_local OutputSink default_sink(&std::cout);
+        return default_sink;
+    }
+
+    thread_local OutputSink *current_sink = nullptr;
+}
+
+OutputSink::OutputSink(std::ostream *_target) : target(_target), stream(this) {
+    if (target != nullptr) {
+        buffer.reserve(BUFFER_SIZE);
+    }
+}
+
+OutputSink::~OutputSink() {
+    flush();
+}
+
+OutputSink::int_type OutputSink::overflow(int_type character) {
+    if (traits_type::eq_int_type(character, traits_type::eof())) {
+        return traits_type::not_eof(character);
+    }
+    char written = traits_type::to_char_type(character);
+    xsputn(&written, 1);
+    return character;
+}
+
+std::streamsize OutputSink::xsputn(const char *characters, std::streamsize count) {
+    for (std::streamsize i = 0; i < count; i++) {
+        if (characters[i] == '\n') {
+            line_count++;
+        }
+    }
+    byte_count += count;
+
+    if (target == nullptr) {
+        return count;
+    }
+    buffer.insert(buffer.end(), characters, characters + count);
+    if (buffer.size() >= BUFFER_SIZE) {
+        flush();
+    }
+    return count;
+}
+
+int OutputSink::sync() {
+    flush();
+    return 0;
+}
+
+void OutputSink::flush() {
+    if (target == nullptr || buffer.empty()) {
+        return;
+    }
+    target->write(buffer.data(), buffer.size());
+    target->flush();
+    buffer.clear();
+    flush_count++;
+}
+
+std::ostream& OutputSink::get_stream() {
+    return stream;
+}
+
+bool OutputSink::is_silent() const {
+    return target == nullptr;
+}
+
+std::size_t OutputSink::get_line_count() const {
+    return line_count;
+}
+
+std::size_t OutputSink::get_byte_count() const {
+    return byte_count;
+}
+
+std::size_t OutputSink::get_flush_count() const {
+    return flush_count;
+}
+
+OutputSink& OutputSink::get_current() {
+    return current_sink != nullptr ? *current_sink : get_default_sink();
+}
+
+void OutputSink::set_current(OutputSink *sink) {
+    get_current().flush();
+    current_sink = sink;
+}
+
+std::ostream& game_output() {
+    return OutputSink::get_current().get_stream();
+}
+
+void flush_game_output() {
+    OutputSink::get_current().flush();
+}
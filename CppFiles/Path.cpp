@@ -12,6 +12,8 @@ Path::Path(const EndpointPair _endpoints, const OrderedPair anchor_tile_coords)
         endpoints.plot_b->get_position_coordinates(), anchor_tile_coords);
 }
 
+Path::Path(const EndpointPair _endpoints, const int _direction) : direction(_direction), endpoints(_endpoints) {}
+
 Path::Path() : direction(0) {}
 
 EndpointPair Path::get_endpoints() const {
@@ -56,6 +58,10 @@ string Path::get_icon() const {
 // Loops through adjacent paths to see if the path has a matching road of the given color
 // This is used for determining if a road can be placed in a particular spot, as for most of the game they must be placed adjacent to another of the same color
 bool Path::has_adjacent_matching_road(const player_color color) const {
+    // On a board, this is just a mask check
+    if (bitboards != nullptr && id != INVALID_ID) {
+        return bitboards->has_adjacent_road(id, color);
+    }
     for (shared_ptr<Path> path : adjacent_paths) {
         if (!path->is_occupied()) {
             continue;
@@ -102,15 +108,15 @@ int Path::calculate_direction(
         endpointb.x *= 2;
     }
 
-    // Use slope formula on endpoints to get the slope of the path as if it was a line in cartesian coordinates
-    double slope_rise = endpointa.y - endpointb.y;
-    double slope_run = endpointa.x - endpointb.x;
-    double slope = slope_rise / slope_run;
+    // Use the signs of the rise and run to get the sign of the slope of the path as if it was a line in
+    // cartesian coordinates. No division needed, the sign is all that matters
+    int slope_rise = endpointa.y - endpointb.y;
+    int slope_run = endpointa.x - endpointb.x;
 
-    if (slope == 0) {
+    if (slope_rise == 0) {
         return 0;
     }
-    if (slope > 0) {
+    if ((slope_rise > 0) == (slope_run > 0)) {
         return 1;
     }
     return -1;
@@ -119,6 +125,9 @@ int Path::calculate_direction(
 
 void Path::set_inhabitant(Road new_inhabitant) {
     inhabitant = make_unique<Road>(new_inhabitant);
+    if (bitboards != nullptr && id != INVALID_ID) {
+        bitboards->place_road(id, inhabitant->get_color());
+    }
 }
 
 string Path::get_icon_override() const {
@@ -133,4 +142,16 @@ void Path::add_to_adjacent_paths(shared_ptr<Path> &new_path) {
     adjacent_paths.insert(new_path);
 }
 
+PathId Path::get_id() const {
+    return id;
+}
+
+void Path::set_id(const PathId _id) {
+    id = _id;
+}
+
+void Path::set_bitboards(const shared_ptr<BoardBitboards> &_bitboards) {
+    bitboards = _bitboards;
+}
+
 
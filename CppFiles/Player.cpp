@@ -4,21 +4,24 @@
 
 #include "../HeaderFiles/Player.h"
 #include "../HeaderFiles/Board.h"
+#include "../HeaderFiles/BoardBitboards.h"
 #include "../HeaderFiles/InputFunctions.h"
 #include "../HeaderFiles/Path.h"
-#include "../HeaderFiles/GameBank.h"
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/GameLog.h"
+#include "../HeaderFiles/Zobrist.h"
+#include "../HeaderFiles/OutputSink.h"
 
 #include <cmath>
 
-#include <iostream>
 
-using std::cout, std::endl;
 using std::max, std::min, std::ceil, std::swap;
 using std::shared_ptr, std::vector, std::set, std::pair, std::string, std::map, std::find;
 
-Player::Player(const int _ID, const player_color _color) {
+Player::Player(const int _ID, const player_color _color, GameContext &_context) {
     ID = _ID;
     color = _color;
+    context = &_context;
 
     reset_resources();
 
@@ -37,6 +40,7 @@ Player::Player(const int _ID, const player_color _color) {
 Player::Player() {
     ID = -1;
     color = COLOR_EMPTY;
+    context = nullptr;
 
     reset_resources();
 
@@ -52,89 +56,74 @@ Player::Player() {
     remaining_settlements = 0;
 }
 
-// determines the number of points the player has and returns it
-int Player::get_points(const Board &board, const bool is_private) const{
-    int total_points = 0;
+GameContext& Player::get_context() const {
+    return *context;
+}
 
-    /* Points from buildings */
-    total_points += get_number_of_placed_building(board, SETTLEMENT);
-    if (total_points > 0) {
+void Player::hash_resource_change(const tile_type resource, const int change) const {
+    if (context == nullptr || color == COLOR_EMPTY) {
+        return;
     }
-    total_points += 2 * get_number_of_placed_building(board, CITY);
+    const ZobristKeys &keys = ZobristKeys::get();
+    int count = resource_cards.get(resource);
+    context->toggle_hand_hash(keys.resource_key(color, resource, count) ^ keys.resource_key(color, resource, count + change));
+}
 
-    /* Points from cards */
-    if (is_private) {
-        total_points += get_number_of_vp_devcards();
+void Player::hash_devcard_change(const devcard_type type, const int change) const {
+    if (context == nullptr || color == COLOR_EMPTY) {
+        return;
     }
+    const ZobristKeys &keys = ZobristKeys::get();
+    int count = count_devcards(type);
+    context->toggle_hand_hash(keys.devcard_key(color, type, count) ^ keys.devcard_key(color, type, count + change));
+}
 
-    if (has_longest_road()){
-        total_points += 2;
+void Player::hash_knight_change(const int change) const {
+    if (context == nullptr || color == COLOR_EMPTY) {
+        return;
     }
+    const ZobristKeys &keys = ZobristKeys::get();
+    context->toggle_hand_hash(keys.knight_key(color, number_of_knights) ^ keys.knight_key(color, number_of_knights + change));
+}
 
-    if (has_largest_army()){
-        total_points += 2;
+int Player::count_devcards(const devcard_type type) const {
+    int count = 0;
+    for (const DevCard &card : devcards) {
+        if (card.get_type() == type) {
+            count++;
+        }
     }
-    return total_points;
+    return count;
 }
 
-int Player::get_number_of_placed_building(const Board &board, const building_type type) const {
-    int num = 0;
-    for (const shared_ptr<Plot> &plot : board.get_board_plots()){
-        // if the plot is not relavent to this player, continue
-        if (!plot->is_occupied()){ continue; }
-        if (plot->get_inhabitant()->get_color() != color){ continue; }
+// Points are kept up to date by the score tracker and the board's bitboards as things are built and gained
+int Player::get_points(const Board &board, const bool is_private) const{
+    return context->get_score_tracker().get_points(board.get_bitboards(), color, is_private);
+}
 
-        if (plot->get_inhabitant()->get_building_type() == type){
-            num += 1;
-        }
-    }
-    return num;
+int Player::get_number_of_placed_building(const Board &board, const building_type type) const {
+    const BoardBitboards &bitboards = board.get_bitboards();
+    return count_bits(type == CITY ? bitboards.get_cities(color) : bitboards.get_settlements(color));
 }
 
 int Player::get_number_of_vp_devcards() const {
-    int num = 0;
-    for (const DevCard &card : devcards) {
-        if (card.get_type() == VICTORY_POINT) {
-            num += 1;
-        }
-    }
-    return num;
+    return context->get_score_tracker().get_victory_point_cards(color);
 }
 
+// The board's bitboards keep a mask of the ports each color has a building on
 vector<tile_type> Player::get_ports(const Board &board) const {
     vector<tile_type> ports;
-    for (const shared_ptr<Plot> &plot : board.get_board_plots()) {
-        if (!plot->is_occupied()) {
-            continue;
-        }
-        if (plot->get_inhabitant()->get_color() != color) {
-            continue;
-        }
-        if (plot->get_port_type() == TILE_EMPTY) {
-            continue;
-        }
-        bool has_it = false;
-        for (tile_type t : ports) {
-            if (plot->get_port_type() == t) {
-                has_it = true;
-            }
-        }
-        if (!has_it) {
-            ports.push_back(plot->get_port_type());
+    PortMask access = board.get_bitboards().get_port_access(color);
+    for (tile_type type : {GRAIN, WOOL, BRICK, ORE, LUMBER}) {
+        if ((access & port_bit(type)) != 0) {
+            ports.push_back(type);
         }
     }
     return ports;
 }
 
 bool Player::has_universal_port(const Board &board) const {
-    for (const shared_ptr<Plot> &plot : board.get_board_plots()) {
-        if (plot->is_occupied() && plot->get_inhabitant()->get_color() == color) {
-            if (plot->is_universal_port()) {
-                return true;
-            }
-        }
-    }
-    return false;
+    return (board.get_bitboards().get_port_access(color) & UNIVERSAL_PORT) != 0;
 }
 
 // determines whether the player has the longest road or largest army or not
@@ -146,148 +135,9 @@ int Player::get_length_of_road() const {
     return length_of_road;
 }
 
+// The board's road engine keeps every color's longest road measured as things are built, so this is a lookup
 int Player::calculate_length_of_road(const Board &board) {
-    int first_length = 0;
-    int second_length = 0;
-
-    // Calculate the lengths but only if the initial road is not the default value. If it is, it will probably cause an error...
-    if (!(first_road_path.first == OrderedPair() && first_road_path.second == OrderedPair())) {
-        shared_ptr<Path> start_path = board.get_path(first_road_path.first, first_road_path.second);
-        first_length = road_length_helper(start_path);
-    }
-    if (!(second_road_path.first == OrderedPair() && second_road_path.second == OrderedPair())) {
-        shared_ptr<Path> start_path = board.get_path(second_road_path.first, second_road_path.second);
-        second_length = road_length_helper(start_path);
-    }
-
-    return max(first_length, second_length);
-}
-
-int Player::road_length_helper(const shared_ptr<Path> start_path) {
-
-    struct sequence {
-        // Fields
-        vector<shared_ptr<Path>> seq;
-        bool terminated;
-        // Funcs
-        void add(const shared_ptr<Path> &path) { seq.push_back(path); }
-        sequence(shared_ptr<Path> initial) : terminated(false), seq({initial}) {}
-        sequence(vector<shared_ptr<Path>> initial_sequence) : terminated(false), seq(initial_sequence) {}
-        sequence() : terminated(false), seq({}) {}
-    };
-
-    vector<sequence> path_collection = {sequence(start_path)};
-
-    while (true) {
-
-        vector<sequence> new_sequences;
-
-        for (auto &p : path_collection) {
-
-            // Get the current sequence vector and declare its previous and previous previous entries
-            vector<shared_ptr<Path>> &seq = p.seq;
-            shared_ptr<Path> previous = !seq.empty() ? seq[seq.size() - 1] : nullptr;
-            shared_ptr<Path> prev_prev = seq.size() >= 2 ? seq[seq.size() - 2] : nullptr;
-
-            // If there was no previous entry, there was an issue. We should continue
-            if (previous == nullptr) {
-                continue;
-            }
-
-            set<shared_ptr<Path>> exclude;
-            if (prev_prev != nullptr) {
-                exclude = prev_prev->get_adjacent_paths();
-                exclude.insert(prev_prev);
-                for (shared_ptr<Path> has_seen : p.seq) {
-                    if (exclude.find(has_seen) == exclude.end()) {
-                        exclude.insert(has_seen);
-                    }
-                }
-            }
-            set<shared_ptr<Path>> current_adjacencies = get_valid_adjacent_road_paths(previous, exclude);
-
-            if (current_adjacencies.empty()) {
-                // If there are no valid adjacent paths from the previous one (cannot continue), then terminate
-                p.terminated = true;
-            } else {
-
-                // Create a copy out here because by the time I need it, it may have been added to and I want it as-is.
-                sequence copy_sequence(seq);
-                bool has_seen_adj = false;
-
-                // For each valid path adjacent to the previous one, if it is not already added and is not backtracking, consider it.
-                for (auto &road_path : current_adjacencies) {
-
-                    bool already_in_sequence = vector_has_path(seq, road_path);
-                    bool is_backtracking = prev_prev != nullptr && (road_path == prev_prev || prev_prev->get_adjacent_paths().count(road_path) > 0);
-
-                    if (!already_in_sequence && !is_backtracking) {
-                        // if this is the first (or only) adjacent path, just add to the sequence
-                        if (!has_seen_adj) {
-                            p.add(road_path);
-                            has_seen_adj = true;
-                        } else {
-                            // Otherwise, create a new sequence that is a copy of the other and add to that
-
-                            // ¡Ay, caramba! I make another copy. Hear me out hear me out. I need this one too for sure.
-                            // I need another one to add a new item to. If I added to the original copy, the item would be there for a future iteration
-                            // To recap:
-                            //    First copy was to avoid items getting added too early to seq, and copying a vector with too many items
-                            //    Second copy is to add to directly and not affect future iterations that rely on the original copy. Capiche?
-                            sequence copied_copy_seqeuence(copy_sequence.seq);
-                            copied_copy_seqeuence.add(road_path);
-                            new_sequences.push_back(copied_copy_seqeuence);
-
-                        }
-                    }
-
-                }
-            }
-        }
-
-        path_collection.insert(path_collection.end(),
-            new_sequences.begin(), new_sequences.end());
-
-        bool all_terminated = true;
-        for (auto &p : path_collection) {
-            if (!p.terminated) {
-                all_terminated = false;
-            }
-        }
-        if (all_terminated) {
-            break;
-        }
-    }
-
-    int max_length = 0;
-    for (auto &p : path_collection) {
-        if (p.seq.size() > max_length) {
-            max_length = p.seq.size();
-        }
-    }
-
-    return max_length;
-}
-
-set<shared_ptr<Path>> Player::get_valid_adjacent_road_paths(const shared_ptr<Path> path, const set<shared_ptr<Path>> &exclude) const {
-    set<shared_ptr<Path>> roads;
-    for (auto &p : path->get_adjacent_paths()) {
-        if (p->is_occupied()) {
-            if (p->get_inhabitant()->get_color() == get_color() && exclude.find(p) == exclude.end()) {
-                roads.insert(p);
-            }
-        }
-    }
-    return roads;
-}
-
-bool Player::vector_has_path(const vector<shared_ptr<Path>> &vec, const shared_ptr<Path> &path) const {
-    for (const shared_ptr<Path> &p : vec) {
-        if (p == path) {
-            return true;
-        }
-    }
-    return false;
+    return board.get_bitboards().get_road_length(get_color());
 }
 
 int Player::get_number_of_placed_roads(const Board &board) const {
@@ -310,7 +160,7 @@ void Player::set_length_of_road(const int length, const bool print_on_longest) {
     }
 
     bool gained_title = false;
-    shared_ptr<Player> longest_road_player = GameBank::instance().get_longest_road_player();
+    shared_ptr<Player> longest_road_player = context->get_longest_road_player();
     if (longest_road_player == nullptr) {
         if (length_of_road >= 5) {
             set_longest_road(true);
@@ -325,7 +175,7 @@ void Player::set_length_of_road(const int length, const bool print_on_longest) {
     }
 
     if (gained_title && print_on_longest) {
-        cout << get_name() << " now has the Longest Road!" << endl;
+        game_output() << get_name() << " now has the Longest Road!" << '\n';
     }
 }
 
@@ -356,17 +206,20 @@ bool Player::has_largest_army() const{
 
 void Player::set_longest_road(const bool _longest_road) {
     longest_road = _longest_road;
+    context->get_score_tracker().set_longest_road(color, longest_road);
 }
 
 void Player::set_largest_army(const bool _largest_army) {
     largest_army = _largest_army;
+    context->get_score_tracker().set_largest_army(color, largest_army);
 }
 
-void Player::gain_knight() {
+void Player::gain_knight(const bool print) {
+    hash_knight_change(1);
     number_of_knights++;
 
     bool gained_title = false;
-    shared_ptr<Player> largest_army_player = GameBank::instance().get_largest_army_player();
+    shared_ptr<Player> largest_army_player = context->get_largest_army_player();
     if (largest_army_player == nullptr) {
         if (number_of_knights >= 3) {
             set_largest_army(true);
@@ -380,8 +233,8 @@ void Player::gain_knight() {
         }
     }
 
-    if (gained_title) {
-        cout << get_name() << " now has the Largest Army!" << endl;
+    if (gained_title && print) {
+        game_output() << get_name() << " now has the Largest Army!" << '\n';
     }
 }
 
@@ -389,43 +242,45 @@ int Player::get_number_of_knights() const {
     return number_of_knights;
 }
 
-void Player::play_devcard(Board &board, const int index){
-
-    if (index < 0 || index >= devcards.size()) {
-        return;
-    }
-
-    if (devcards.at(index).get_type() == VICTORY_POINT) {
-        cout << "You cannot play a Victory Point Development Card." << endl;
-        cout << "The point is added to your total as long as it is in your hand.\n" << endl;
-        return;
+bool Player::play_devcard(const devcard_type type) {
+    if (played_devcard_this_turn || type == VICTORY_POINT) {
+        return false;
     }
-    if (!devcards.at(index).test_playability(board, shared_from_this())) {
-        return;
+    for (size_t i = 0; i < devcards.size(); i++) {
+        if (devcards[i].get_type() == type && !devcards[i].was_bought_this_turn()) {
+            hash_devcard_change(type, -1);
+            played_devcard_this_turn = true;
+            devcards.erase(devcards.begin() + i);
+            return true;
+        }
     }
-
-    // Play the card
-    devcards[index].play(board, shared_from_this());
-    // Remove the Card
-    devcards.erase(devcards.begin() + index);
+    return false;
 }
 
 void Player::gain_devcard(const devcard_type devcard, const bool print){
     if (devcard != CARD_EMPTY) {
+        hash_devcard_change(devcard, 1);
         devcards.emplace_back(DevCard(devcard));
+        if (devcard == VICTORY_POINT) {
+            context->get_score_tracker().add_victory_point_card(color);
+        }
         sort_devcards();
         if (print) {
-            cout << get_name() << " has gained a Development Card" << endl;
+            game_output() << get_name() << " has gained a Development Card" << '\n';
         }
     }
 }
 
 void Player::gain_devcard(const DevCard devcard, const bool print) {
     if (devcard.is_valid()) {
+        hash_devcard_change(devcard.get_type(), 1);
         devcards.push_back(devcard);
+        if (devcard.get_type() == VICTORY_POINT) {
+            context->get_score_tracker().add_victory_point_card(color);
+        }
         sort_devcards();
         if (print) {
-            cout << get_name() << " has gained a Development Card" << endl;
+            game_output() << get_name() << " has gained a Development Card" << '\n';
         }
     }
 
@@ -451,7 +306,7 @@ bool Player::has_devcard(const devcard_type devcard) const{
     return false;
 }
 
-vector<DevCard> Player::get_devcards() const {
+const vector<DevCard>& Player::get_devcards() const {
     return devcards;
 }
 
@@ -467,45 +322,53 @@ void Player::start_new_turn() {
     for (DevCard& card : devcards) {
         card.set_bought_this_turn(false);
     }
+    played_devcard_this_turn = false;
 }
 
 
 void Player::reset_resources() {
-    resource_cards = get_base_resource_map();
+    for (tile_type resource : RESOURCE_TYPES) {
+        hash_resource_change(resource, -resource_cards.get(resource));
+    }
+    resource_cards = ResourceVector();
 }
 
-map<tile_type, int> Player::get_resources() const {
+ResourceVector Player::get_resources() const {
     return resource_cards;
 }
 
-map<tile_type, int> Player::get_base_resource_map() {
-    return {{GRAIN, 0}, {WOOL, 0},{BRICK, 0}, {ORE, 0}, {LUMBER, 0}};
-}
-
 void Player::gain_resource(const tile_type resource) {
     if (!resource_exists(resource)) {
         return;
     }
-    resource_cards[resource] += 1;
+    hash_resource_change(resource, 1);
+    resource_cards.add(resource, 1);
 }
 
-void Player::gain_many_resources(const map<tile_type, int> resources, const bool from_bank, const bool print) {
-    // for each pair in the map, print a message and add the numnber of resources.
+void Player::gain_many_resources(const ResourceVector resources, const bool from_bank, const bool print) {
+    // The bank can only give what it has left
+    ResourceVector gains = from_bank ? resources.capped_at(context->get_bank().get_available_resources()) : resources;
+    if (gains.is_empty()) {
+        return;
+    }
 
-    for (auto &it : resources) {
-        int gain = it.second;
-        if (from_bank) {
-            gain = min(gain, GameBank::instance().get_available_resources().at(it.first));
+    // Print and log each resource, in order, then move them all at once
+    for (tile_type resource : RESOURCE_TYPES) {
+        int gain = gains.get(resource);
+        if (gain == 0) {
+            continue;
         }
-        if (gain > 0 && print) {
-            cout << get_name() << " gained " << gain << " " << Tile::type_to_string(it.first) << "." << endl;
+        if (print) {
+            game_output() << get_name() << " gained " << gain << " " << Tile::type_to_string(resource) << "." << '\n';
         }
-        for (int i = 0; i < gain; i++) {
-            gain_resource(it.first);
-            if (from_bank) {
-                GameBank::instance().draw_resource(it.first);
-            }
+        if (context->get_log() != nullptr) {
+            context->get_log()->append(from_bank ? EVENT_GAIN_FROM_BANK : EVENT_GAIN, color, resource, gain);
         }
+        hash_resource_change(resource, gain);
+    }
+    resource_cards += gains;
+    if (from_bank) {
+        context->get_bank().draw_resources(gains);
     }
 }
 
@@ -513,98 +376,80 @@ void Player::discard_resource(const tile_type resource) {
     if (!has_resource(resource)) {
         return;
     }
-    resource_cards[resource] -= 1;
+    hash_resource_change(resource, -1);
+    resource_cards.add(resource, -1);
 }
 
 void Player::discard_many_resources(
-    const map<tile_type, int> resources, const string purpose, const bool to_bank, const bool print) {
-    // for each pair in the map, print a message and remove the numnber of resources.
-    for (auto &resource_pair : resources) {
-        int count = 0;
-        for (int i = 0; i < resource_pair.second; i++) {
-            if (!has_resource(resource_pair.first)) {
-                break;
-            }
-            discard_resource(resource_pair.first);
-            if (to_bank) {
-                GameBank::instance().return_resource(resource_pair.first);
-            }
-            count++;
+    const ResourceVector resources, const string purpose, const bool to_bank, const bool print) {
+    // Nothing more than is in hand can be discarded
+    ResourceVector losses = resources.capped_at(resource_cards);
+    if (losses.is_empty()) {
+        return;
+    }
+
+    for (tile_type resource : RESOURCE_TYPES) {
+        int count = losses.get(resource);
+        if (count == 0) {
+            continue;
+        }
+        if (print) {
+            game_output() << get_name() << " " << purpose << " " << count << " " << Tile::type_to_string(resource) << "." << '\n';
         }
-        if (count > 0 && print) {
-            cout << get_name() << " " << purpose << " " << count << " " << Tile::type_to_string(resource_pair.first) << "." << endl;
+        if (context->get_log() != nullptr) {
+            context->get_log()->append(to_bank ? EVENT_RETURN_TO_BANK : EVENT_LOSE, color, resource, count);
         }
+        hash_resource_change(resource, -count);
+    }
+    resource_cards -= losses;
+    if (to_bank) {
+        context->get_bank().return_resources(losses);
     }
 }
 
 tile_type Player::get_random_resource() {
-    srand(time(nullptr));
-    vector<tile_type> resources;
-    for (auto &resource_pair : resource_cards) {
-        for (int i = 0; i < resource_pair.second; i++) {
-            resources.push_back(resource_pair.first);
-        }
-    }
-    if (resources.size() == 0) {
+    int hand_size = get_number_of_resources();
+    if (hand_size == 0) {
         return TILE_EMPTY;
     }
-    return resources[rand() % resources.size()];
+    // Count through the hand to the chosen card instead of laying every card out
+    int card = context->get_random().next_int(hand_size);
+    for (tile_type resource : RESOURCE_TYPES) {
+        if (card < resource_cards.get(resource)) {
+            return resource;
+        }
+        card -= resource_cards.get(resource);
+    }
+    return TILE_EMPTY;
 }
 
 bool Player::has_resource(const tile_type resource) const {
-    if (!resource_exists(resource)) {
-        return false;
-    }
-    return resource_cards.at(resource) > 0;
+    return resource_cards.get(resource) > 0;
 }
 
 bool Player::resource_exists(const tile_type resource) const {
-    for (auto &it : resource_cards) {
-        if (it.first == resource) {
-            return true;
-        }
-    }
-    return false;
+    return ResourceVector::is_resource(resource);
 }
 
 int Player::get_number_of_resources() const {
-    int number = 0;
-    for (auto &resource : resource_cards) {
-        number += resource.second;
-    }
-    return number;
+    return resource_cards.get_total();
 }
 
 int Player::get_amount_of_resource(const tile_type resource) const {
-    for (auto &res : resource_cards) {
-        if (res.first == resource) {
-            return res.second;
-        }
-    }
-    return 0;
+    return resource_cards.get(resource);
 }
 
-bool Player::can_afford(map<tile_type, int> recipe, const bool print) const {
-    map<tile_type, string> conversion = get_resource_conversion_to_string();
-    conversion.insert({TILE_EMPTY, "..."});
-    bool affordable = true;
-    for (auto &requirement : recipe) {
-
-        if (!resource_exists(requirement.first)) {
-            cout << "SOMETHING WENT WRONG WITH PLAYER RESOURCE MAP INITIALIZATION" << endl;
-            return false;
-        }
-
-        if (resource_cards.at(requirement.first) < requirement.second) {
-            affordable = false;
-            break;
-        }
-    }
+bool Player::can_afford(const ResourceVector &recipe, const bool print) const {
+    bool affordable = resource_cards.covers(recipe);
     if (print && !affordable) {
-        cout << "Sorry, you can't afford that." << endl;
-        for (auto &requirement : recipe) {
-            cout << "You have " << resource_cards.at(requirement.first) << " / " << requirement.second;
-            cout << " of the required " << conversion.at(requirement.first) << ". " << endl;
+        map<tile_type, string> conversion = get_resource_conversion_to_string();
+        game_output() << "Sorry, you can't afford that." << '\n';
+        for (tile_type resource : RESOURCE_TYPES) {
+            if (recipe.get(resource) == 0) {
+                continue;
+            }
+            game_output() << "You have " << resource_cards.get(resource) << " / " << recipe.get(resource);
+            game_output() << " of the required " << conversion.at(resource) << ". " << '\n';
         }
     }
     return affordable;
@@ -658,66 +503,55 @@ void Player::incdec_settlement_pieces(const int change) {
     remaining_settlements += change;
 }
 
-void Player::seven_rolled() {
-    int total_resource_cards = get_number_of_resources();
-    if (total_resource_cards <= 7) {
-        cout << get_name() << " has less than or equal to 7 resource cards, so they are safe." << endl;
-        return;
-    }
-    cout << get_name() << ", you have more than seven resource cards, and must discard half of them" << endl;
-    int number_to_discard = ceil(total_resource_cards / 2.0);
-    discard_resources_prompt(shared_from_this(), number_to_discard);
-}
-
 void Player::print_resources() const {
-    cout << "Resources: " << endl;;
+    game_output() << "Resources: " << '\n';;
     for (auto &res : get_resource_conversion_to_string()) {
-        cout << " - " << res.second << ": " << resource_cards.at(res.first) << endl;
+        game_output() << " - " << res.second << ": " << resource_cards.get(res.first) << '\n';
     }
 }
 
 void Player::print_devcards() const {
     if (devcards.size() <= 0) {
-        cout << "You do not have any Development Cards..." << endl;
+        game_output() << "You do not have any Development Cards..." << '\n';
     } else {
-        cout << "Development Cards: " << endl;
+        game_output() << "Development Cards: " << '\n';
         for (int i = 0; i < devcards.size(); i++) {
-            cout << " " << i << " - " << devcards[i].get_name() << endl;
+            game_output() << " " << i << " - " << devcards[i].get_name() << '\n';
         }
     }
 }
 
 void Player::print_info(const Board &board, const bool show_private) const {
-    cout << get_name() << ": " << endl;
-    cout << "General info:" << endl;
+    game_output() << get_name() << ": " << '\n';
+    game_output() << "General info:" << '\n';
     // Print points
     if (show_private) {
-        cout << " - " << get_points(board, false) << " {" << get_points(board, true) << "} Victory Points" << endl;
+        game_output() << " - " << get_points(board, false) << " {" << get_points(board, true) << "} Victory Points" << '\n';
     } else {
-        cout << " - " << get_points(board, false) << " Victory Points" << endl;
+        game_output() << " - " << get_points(board, false) << " Victory Points" << '\n';
     }
     // Print Road Length
-    cout << " - Road length: " << get_length_of_road();
+    game_output() << " - Road length: " << get_length_of_road();
     if (has_longest_road()) {
-        cout << " ~ LONGEST ROAD!" << endl;
+        game_output() << " ~ LONGEST ROAD!" << '\n';
     } else {
-        cout << endl;
+        game_output() << '\n';
     }
     // Print Army Size
-    cout << " - Army Size: " << get_number_of_knights();
+    game_output() << " - Army Size: " << get_number_of_knights();
     if (has_largest_army()) {
-        cout << " ~ LARGEST ARMY!" << endl;
+        game_output() << " ~ LARGEST ARMY!" << '\n';
     } else {
-        cout << endl;
+        game_output() << '\n';
     }
     if (show_private) {
         print_resources();
         print_devcards();
     } else {
         // Print resource count
-        cout << " - " << get_number_of_resources() << " Resource Cards" << endl;
+        game_output() << " - " << get_number_of_resources() << " Resource Cards" << '\n';
         // Print devcard count
-        cout << " - " << devcards.size() << " Development Cards" << endl;
+        game_output() << " - " << devcards.size() << " Development Cards" << '\n';
     }
 
 }
@@ -74,6 +74,18 @@ map<int, shared_ptr<Plot>> Plot::get_adjacent_plots() const{
     return adjacent_plots;
 }
 
+PlotId Plot::get_id() const {
+    return id;
+}
+
+void Plot::set_id(const PlotId _id) {
+    id = _id;
+}
+
+void Plot::set_bitboards(const shared_ptr<BoardBitboards> &_bitboards) {
+    bitboards = _bitboards;
+}
+
 
 bool Plot::is_occupied() const {
     return (inhabitant != nullptr);
@@ -82,6 +94,10 @@ bool Plot::is_occupied() const {
 // Loops through adjacent plots to determine if this plot has a building next to it
 // This is used for building placement, as a building cannot be next to another, regardless of what color they are
 bool Plot::next_to_building() const {
+    // On a board, this is just a mask check
+    if (bitboards != nullptr && id != INVALID_ID) {
+        return bitboards->next_to_building(id);
+    }
     for (auto &it : adjacent_plots) {
         if (it.second->is_occupied()) {
             return true;
@@ -105,6 +121,19 @@ void Plot::add_to_adjacent_tiles(const OrderedPair coords) {
 
 void Plot::set_inhabitant(Building new_inhabitant) {
     inhabitant = make_unique<Building>(new_inhabitant);
+    if (bitboards != nullptr && id != INVALID_ID) {
+        bitboards->place_building(id, inhabitant->get_color(), inhabitant->get_building_type());
+    }
+}
+
+void Plot::upgrade_inhabitant() {
+    if (!is_occupied()) {
+        return;
+    }
+    inhabitant->upgrade();
+    if (bitboards != nullptr && id != INVALID_ID) {
+        bitboards->place_building(id, inhabitant->get_color(), inhabitant->get_building_type());
+    }
 }
 
 void Plot::set_icon_override(const string _icon_override) {
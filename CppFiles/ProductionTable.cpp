@@ -0,0 +1,148 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/ProductionTable.h"
+
+#include <algorithm>
+
+using namespace std;
+
+ProductionTable::ProductionTable(const int plot_count) {
+    plot_colors.assign(plot_count, COLOR_EMPTY);
+    plot_production.assign(plot_count, 0);
+    plot_tiles.assign(plot_count, {});
+}
+
+bool ProductionTable::is_production_number(const int number) {
+    return number >= MIN_ROLL && number <= MAX_ROLL && number != 7;
+}
+
+bool ProductionTable::is_producing(const TileId tile) const {
+    return tile != robber_tile && tile_types[tile] != DESERT && tile_types[tile] != TILE_EMPTY &&
+        is_production_number(tile_numbers[tile]);
+}
+
+void ProductionTable::add_amount(const TileId tile, const player_color color, const int amount) {
+    if (color < 0 || color >= COLOR_COUNT) {
+        return;
+    }
+    amounts[tile_numbers[tile] - MIN_ROLL][color][tile_types[tile]] += amount;
+}
+
+void ProductionTable::apply_tile(const TileId tile, const int sign) {
+    if (tile == INVALID_ID || tile >= static_cast<int>(tile_types.size()) || !is_producing(tile)) {
+        return;
+    }
+    for (PlotId plot : tile_plots[tile]) {
+        if (plot != INVALID_ID && plot_production[plot] > 0) {
+            add_amount(tile, plot_colors[plot], sign * plot_production[plot]);
+        }
+    }
+    rebuild_entries(tile_numbers[tile]);
+}
+
+void ProductionTable::rebuild_entries(const int roll) {
+    vector<ProductionEntry> &roll_entries = entries[roll - MIN_ROLL];
+    roll_entries.clear();
+    for (int color = 0; color < COLOR_COUNT; color++) {
+        for (int resource = 0; resource < RESOURCE_COUNT; resource++) {
+            int amount = amounts[roll - MIN_ROLL][color][resource];
+            if (amount > 0) {
+                roll_entries.push_back({static_cast<player_color>(color), static_cast<tile_type>(resource), amount});
+            }
+        }
+    }
+}
+
+void ProductionTable::set_tile(
+    const TileId tile, const tile_type type, const int number,
+    const array<PlotId, BoardGraph::TILE_DEGREE> &plots) {
+
+    if (tile >= static_cast<int>(tile_types.size())) {
+        array<PlotId, BoardGraph::TILE_DEGREE> no_plots;
+        no_plots.fill(INVALID_ID);
+        tile_types.resize(tile + 1, TILE_EMPTY);
+        tile_numbers.resize(tile + 1, -1);
+        tile_plots.resize(tile + 1, no_plots);
+    }
+
+    // Take away whatever the tile produced before, and where it was listed, in case it is being set again
+    apply_tile(tile, -1);
+    if (is_production_number(tile_numbers[tile])) {
+        vector<TileId> &old_roll_tiles = roll_tiles[tile_numbers[tile] - MIN_ROLL];
+        old_roll_tiles.erase(remove(old_roll_tiles.begin(), old_roll_tiles.end(), tile), old_roll_tiles.end());
+    }
+    for (PlotId plot : tile_plots[tile]) {
+        if (plot != INVALID_ID && find(plots.begin(), plots.end(), plot) == plots.end()) {
+            vector<TileId> &tiles = plot_tiles[plot];
+            tiles.erase(remove(tiles.begin(), tiles.end(), tile), tiles.end());
+        }
+    }
+    tile_types[tile] = type;
+    tile_numbers[tile] = number;
+    tile_plots[tile] = plots;
+
+    for (PlotId plot : plots) {
+        if (plot == INVALID_ID) {
+            continue;
+        }
+        vector<TileId> &tiles = plot_tiles[plot];
+        bool has_tile = false;
+        for (TileId t : tiles) {
+            has_tile = has_tile || t == tile;
+        }
+        if (!has_tile) {
+            tiles.push_back(tile);
+        }
+    }
+    if (is_production_number(number)) {
+        roll_tiles[number - MIN_ROLL].push_back(tile);
+    }
+    apply_tile(tile, 1);
+}
+
+void ProductionTable::building_placed(const PlotId plot, const player_color color, const building_type type) {
+    int production = type == CITY ? 2 : 1;
+    for (TileId tile : plot_tiles[plot]) {
+        if (!is_producing(tile)) {
+            continue;
+        }
+        add_amount(tile, plot_colors[plot], -plot_production[plot]);
+        add_amount(tile, color, production);
+        rebuild_entries(tile_numbers[tile]);
+    }
+    plot_colors[plot] = color;
+    plot_production[plot] = production;
+}
+
+void ProductionTable::robber_moved(const TileId tile) {
+    if (tile == robber_tile) {
+        return;
+    }
+    TileId previous = robber_tile;
+    // The new tile still produces at this point, so its production can be taken away before the robber lands
+    apply_tile(tile, -1);
+    robber_tile = tile;
+    apply_tile(previous, 1);
+}
+
+const vector<ProductionEntry>& ProductionTable::get_production(const int roll) const {
+    static const vector<ProductionEntry> NONE;
+    if (roll < MIN_ROLL || roll > MAX_ROLL) {
+        return NONE;
+    }
+    return entries[roll - MIN_ROLL];
+}
+
+const vector<TileId>& ProductionTable::get_tiles(const int roll) const {
+    static const vector<TileId> NONE;
+    if (roll < MIN_ROLL || roll > MAX_ROLL) {
+        return NONE;
+    }
+    return roll_tiles[roll - MIN_ROLL];
+}
+
+TileId ProductionTable::get_robber_tile() const {
+    return robber_tile;
+}
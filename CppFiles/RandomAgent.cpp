@@ -0,0 +1,117 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/RandomAgent.h"
+#include "../HeaderFiles/Board.h"
+#include "../HeaderFiles/Player.h"
+#include "../HeaderFiles/GameContext.h"
+#include "../HeaderFiles/ProductionTable.h"
+
+using namespace std;
+
+// Index of the nth (from 0) set bit of the mask
+static int nth_bit(uint64_t mask, int n) {
+    for (; n > 0; n--) {
+        mask &= mask - 1;
+    }
+    return lowest_bit(mask);
+}
+
+int RandomAgent::random_bit(GameRandom &random, const uint64_t mask) {
+    int count = count_bits(mask);
+    if (count == 0) {
+        return INVALID_ID;
+    }
+    return nth_bit(mask, random.next_int(count));
+}
+
+int RandomAgent::random_bit(GameRandom &random, const PathMask &mask) {
+    int count = mask.count();
+    if (count == 0) {
+        return INVALID_ID;
+    }
+    int n = random.next_int(count);
+    int low_count = count_bits(mask.low);
+    if (n < low_count) {
+        return nth_bit(mask.low, n);
+    }
+    return 64 + nth_bit(mask.high, n - low_count);
+}
+
+PlotId RandomAgent::choose_initial_settlement(Board &board, const shared_ptr<Player> &player) {
+    return random_bit(player->get_context().get_random(), board.get_bitboards().get_buildable_plots(player->get_color(), false));
+}
+
+PathId RandomAgent::choose_initial_road(Board &board, const shared_ptr<Player> &player, const PlotId settlement) {
+    const BoardBitboards &bitboards = board.get_bitboards();
+    return random_bit(player->get_context().get_random(), bitboards.get_plot_paths(settlement) & ~bitboards.get_occupied_paths());
+}
+
+Action RandomAgent::choose_action(Board &, const shared_ptr<Player> &player, const ActionList &legal_actions) {
+    return legal_actions[player->get_context().get_random().next_int(legal_actions.size())];
+}
+
+PathId RandomAgent::choose_free_road(Board &board, const shared_ptr<Player> &player) {
+    return random_bit(player->get_context().get_random(), board.get_bitboards().get_buildable_paths(player->get_color(), true));
+}
+
+ResourceVector RandomAgent::choose_discard(Board &, const shared_ptr<Player> &player, const int number_of_resources) {
+    // Draw the cards one at a time, as if picking blindly from the hand
+    ResourceVector hand = player->get_resources();
+    int hand_size = player->get_number_of_resources();
+    ResourceVector discarded;
+    for (int i = 0; i < number_of_resources && hand_size > 0; i++) {
+        int card = player->get_context().get_random().next_int(hand_size);
+        for (tile_type resource : RESOURCE_TYPES) {
+            if (card < hand.get(resource)) {
+                hand.add(resource, -1);
+                discarded.add(resource, 1);
+                break;
+            }
+            card -= hand.get(resource);
+        }
+        hand_size--;
+    }
+    return discarded;
+}
+
+TileId RandomAgent::choose_robber_tile(Board &board, const shared_ptr<Player> &player) {
+    int tile_count = board.get_graph().get_tile_count();
+    TileId robber_tile = board.get_bitboards().get_production_table().get_robber_tile();
+    if (tile_count < 2) {
+        return INVALID_ID;
+    }
+    // Pick from every tile but the robber's
+    TileId tile = player->get_context().get_random().next_int(tile_count - 1);
+    if (robber_tile != INVALID_ID && tile >= robber_tile) {
+        tile++;
+    }
+    return tile;
+}
+
+player_color RandomAgent::choose_steal_target(Board &, const shared_ptr<Player> &player, const vector<player_color> &targets) {
+    if (targets.empty()) {
+        return COLOR_EMPTY;
+    }
+    return targets[player->get_context().get_random().next_int(targets.size())];
+}
+
+tile_type RandomAgent::choose_resource(Board &, const shared_ptr<Player> &player, const devcard_type reason) {
+    vector<tile_type> options;
+    for (tile_type resource : RESOURCE_TYPES) {
+        if (reason != YEAR_OF_PLENTY || player->get_context().get_bank().has_resource(resource)) {
+            options.push_back(resource);
+        }
+    }
+    if (options.empty()) {
+        return TILE_EMPTY;
+    }
+    return options[player->get_context().get_random().next_int(options.size())];
+}
+
+bool RandomAgent::respond_to_trade(
+    Board &, const shared_ptr<Player> &player, const shared_ptr<Player> &,
+    const ResourceVector &, const ResourceVector &gain) {
+    return player->can_afford(gain, false) && player->get_context().get_random().next_int(2) == 0;
+}
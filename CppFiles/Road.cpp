@@ -5,10 +5,10 @@
 #include "../HeaderFiles/Road.h"
 #include "../HeaderFiles/Player.h"
 
-using std::map, std::string, std::shared_ptr;
+using std::string, std::shared_ptr;
 
-map<tile_type, int> Road::get_recipe() const {
-    return {{BRICK, 1}, {LUMBER, 1}};
+ResourceVector Road::get_recipe() const {
+    return ROAD_RECIPE;
 }
 
 Road::Road(const shared_ptr<Player> _owner) : Construct(_owner, get_recipe()) {}
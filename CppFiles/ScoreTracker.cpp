@@ -0,0 +1,77 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/ScoreTracker.h"
+#include "../HeaderFiles/BoardBitboards.h"
+
+bool ScoreTracker::is_player_color(const player_color color) {
+    return color >= 0 && color < COLOR_COUNT;
+}
+
+void ScoreTracker::add_victory_point_card(const player_color color) {
+    if (is_player_color(color)) {
+        victory_point_cards[color]++;
+    }
+}
+
+void ScoreTracker::set_longest_road(const player_color color, const bool holds) {
+    if (holds) {
+        longest_road_holder = color;
+    } else if (longest_road_holder == color) {
+        longest_road_holder = COLOR_EMPTY;
+    }
+}
+
+void ScoreTracker::set_largest_army(const player_color color, const bool holds) {
+    if (holds) {
+        largest_army_holder = color;
+    } else if (largest_army_holder == color) {
+        largest_army_holder = COLOR_EMPTY;
+    }
+}
+
+void ScoreTracker::reset() {
+    victory_point_cards.fill(0);
+    longest_road_holder = COLOR_EMPTY;
+    largest_army_holder = COLOR_EMPTY;
+}
+
+player_color ScoreTracker::get_longest_road_holder() const {
+    return longest_road_holder;
+}
+
+player_color ScoreTracker::get_largest_army_holder() const {
+    return largest_army_holder;
+}
+
+int ScoreTracker::get_victory_point_cards(const player_color color) const {
+    return is_player_color(color) ? victory_point_cards[color] : 0;
+}
+
+int ScoreTracker::get_building_points(const BoardBitboards &bitboards, const player_color color) {
+    return SETTLEMENT_POINTS * count_bits(bitboards.get_settlements(color)) +
+        CITY_POINTS * count_bits(bitboards.get_cities(color));
+}
+
+int ScoreTracker::get_title_points(const player_color color) const {
+    if (!is_player_color(color)) {
+        return 0;
+    }
+    int points = 0;
+    if (longest_road_holder == color) {
+        points += TITLE_POINTS;
+    }
+    if (largest_army_holder == color) {
+        points += TITLE_POINTS;
+    }
+    return points;
+}
+
+int ScoreTracker::get_points(const BoardBitboards &bitboards, const player_color color, const bool is_private) const {
+    int points = get_building_points(bitboards, color) + get_title_points(color);
+    if (is_private) {
+        points += get_victory_point_cards(color);
+    }
+    return points;
+}
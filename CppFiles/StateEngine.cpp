@@ -0,0 +1,567 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/StateEngine.h"
+#include "../HeaderFiles/GameRandom.h"
+#include "../HeaderFiles/StatePolicy.h"
+#include "../HeaderFiles/StandardBoard.h"
+#include "../HeaderFiles/ResourceVector.h"
+
+#include <algorithm>
+
+using std::array, std::min, std::max;
+
+// The standard board's neighbours as masks, the same ones BoardBitboards precomputes from the BoardGraph
+struct StateTopology {
+    array<PlotMask, StandardBoard::PLOT_COUNT> plot_plots{};
+    array<PathMask, StandardBoard::PLOT_COUNT> plot_paths{};
+    array<PlotMask, StandardBoard::PATH_COUNT> path_plots{};
+    array<PathMask, StandardBoard::PATH_COUNT> path_paths{};
+    array<PlotMask, StandardBoard::TILE_COUNT> tile_plots{};
+
+    StateTopology() {
+        const StandardBoard::Topology &topology = StandardBoard::TOPOLOGY;
+        for (PlotId plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+            for (int neighbour : topology.plot_plots[plot]) {
+                if (neighbour != INVALID_ID) {
+                    plot_plots[plot] |= PlotMask(1) << neighbour;
+                }
+            }
+        }
+        for (PathId path = 0; path < StandardBoard::PATH_COUNT; path++) {
+            for (int plot : topology.path_plots[path]) {
+                path_plots[path] |= PlotMask(1) << plot;
+                plot_paths[plot] |= PathMask::bit(path);
+            }
+        }
+        for (PathId path = 0; path < StandardBoard::PATH_COUNT; path++) {
+            for (int plot : topology.path_plots[path]) {
+                path_paths[path] |= plot_paths[plot];
+            }
+            path_paths[path] &= ~PathMask::bit(path);
+        }
+        for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+            for (int plot : topology.tile_plots[tile]) {
+                tile_plots[tile] |= PlotMask(1) << plot;
+            }
+        }
+    }
+};
+
+static const StateTopology& get_topology() {
+    static const StateTopology topology;
+    return topology;
+}
+
+/**
+* Requires: state, color
+* Modifies: nothing
+* Effects: returns the color's settlements and cities, or every building on the board for COLOR_EMPTY
+*/
+static PlotMask get_buildings(const GameState &state, const int color) {
+    PlotMask buildings = 0;
+    for (PlotId plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        if (color == COLOR_EMPTY ? state.plot_owners[plot] != COLOR_EMPTY : state.plot_owners[plot] == color) {
+            buildings |= PlotMask(1) << plot;
+        }
+    }
+    return buildings;
+}
+
+/**
+* Requires: player, amounts of grain, wool, brick, ore and lumber
+* Modifies: nothing
+* Effects: returns if the player has at least that many of each resource
+*/
+static bool can_afford(const PlayerState &player, const int grain, const int wool, const int brick, const int ore, const int lumber) {
+    return player.resources[GRAIN] >= grain && player.resources[WOOL] >= wool && player.resources[BRICK] >= brick &&
+        player.resources[ORE] >= ore && player.resources[LUMBER] >= lumber;
+}
+
+void StateEngine::generate(const GameState &state, ActionList &actions) {
+    actions.clear();
+    player_color color = static_cast<player_color>(state.current_player);
+    const PlayerState &player = state.players[color];
+
+    if (player.settlements_left > 0 && can_afford(player, 1, 1, 1, 0, 1)) {
+        for (PlotMask plots = get_buildable_plots(state, color, true); plots != 0; plots &= plots - 1) {
+            Action action;
+            action.type = BUILD_SETTLEMENT;
+            action.target = lowest_bit(plots);
+            actions.push(action);
+        }
+    }
+    if (player.cities_left > 0 && can_afford(player, 2, 0, 0, 3, 0)) {
+        for (PlotMask plots = state.get_settlements(color); plots != 0; plots &= plots - 1) {
+            Action action;
+            action.type = BUILD_CITY;
+            action.target = lowest_bit(plots);
+            actions.push(action);
+        }
+    }
+    if (player.roads_left > 0 && can_afford(player, 0, 0, 1, 0, 1)) {
+        for (PathMask paths = get_buildable_paths(state, color); paths.any(); ) {
+            Action action;
+            action.type = BUILD_ROAD;
+            action.target = paths.first();
+            actions.push(action);
+            paths ^= PathMask::bit(action.target);
+        }
+    }
+
+    int deck_size = 0;
+    for (int count : state.deck) {
+        deck_size += count;
+    }
+    if (deck_size > 0 && can_afford(player, 1, 1, 0, 1, 0)) {
+        Action action;
+        action.type = BUY_DEVCARD;
+        actions.push(action);
+    }
+    if (!player.played_devcard) {
+        bool bank_has_resources = false;
+        for (tile_type resource : RESOURCE_TYPES) {
+            bank_has_resources = bank_has_resources || state.bank_resources[resource] > 0;
+        }
+        for (int type = KNIGHT; type < VICTORY_POINT; type++) {
+            if (player.devcards[type] == 0 ||
+                (type == ROAD_BUILDING && !get_buildable_paths(state, color).any()) ||
+                (type == YEAR_OF_PLENTY && !bank_has_resources)) {
+                continue;
+            }
+            Action action;
+            action.type = PLAY_DEVCARD;
+            action.target = type;
+            actions.push(action);
+        }
+    }
+
+    for (tile_type give : RESOURCE_TYPES) {
+        int rate = get_trade_rate(state, color, give);
+        if (player.resources[give] < rate) {
+            continue;
+        }
+        for (tile_type receive : RESOURCE_TYPES) {
+            if (receive == give || state.bank_resources[receive] == 0) {
+                continue;
+            }
+            Action action;
+            action.type = MARITIME_TRADE;
+            action.give = give;
+            action.give_amount = rate;
+            action.receive = receive;
+            actions.push(action);
+        }
+    }
+
+    Action pass;
+    pass.type = PASS_TURN;
+    actions.push(pass);
+}
+
+int StateEngine::roll_dice(GameRandom &random) {
+    return (random.next_int(6) + 1) + (random.next_int(6) + 1);
+}
+
+void StateEngine::start_turn(GameState &state, const int roll, GameRandom &random) {
+    PlayerState &player = state.players[state.current_player];
+    for (int type = 0; type < CARD_EMPTY; type++) {
+        player.devcards[type] += player.new_devcards[type];
+        player.new_devcards[type] = 0;
+    }
+    player.played_devcard = false;
+
+    if (roll == 7) {
+        seven_rolled(state, random);
+    } else {
+        produce(state, roll);
+    }
+}
+
+devcard_type StateEngine::apply_action(GameState &state, const Action &action, GameRandom &random) {
+    player_color color = static_cast<player_color>(state.current_player);
+    PlayerState &player = state.players[color];
+    devcard_type drawn = CARD_EMPTY;
+
+    switch (action.type) {
+        case PASS_TURN:
+            break;
+        case BUILD_SETTLEMENT:
+            pay(state, color, 1, 1, 1, 0, 1);
+            state.plot_owners[action.target] = color;
+            player.settlements_left--;
+            // The settlement may have broken an opponent's road
+            update_road_lengths(state);
+            break;
+        case BUILD_CITY:
+            pay(state, color, 2, 0, 0, 3, 0);
+            state.plot_cities[action.target] = true;
+            player.cities_left--;
+            player.settlements_left++;
+            break;
+        case BUILD_ROAD:
+            pay(state, color, 0, 0, 1, 0, 1);
+            place_road(state, color, action.target);
+            break;
+        case BUY_DEVCARD: {
+            pay(state, color, 1, 1, 0, 1, 0);
+            int deck_size = 0;
+            for (int count : state.deck) {
+                deck_size += count;
+            }
+            // Same as drawing a random card from the bank's list of cards
+            int card = random.next_int(deck_size);
+            for (int type = 0; type < CARD_EMPTY && drawn == CARD_EMPTY; type++) {
+                if (card < state.deck[type]) {
+                    drawn = static_cast<devcard_type>(type);
+                }
+                card -= state.deck[type];
+            }
+            state.deck[drawn]--;
+            player.new_devcards[drawn]++;
+            break;
+        }
+        case PLAY_DEVCARD:
+            play_devcard(state, static_cast<devcard_type>(action.target), random);
+            break;
+        case MARITIME_TRADE:
+            player.resources[action.give] -= action.give_amount;
+            state.bank_resources[action.give] += action.give_amount;
+            take_from_bank(state, color, action.receive, 1);
+            break;
+    }
+
+    if (state.winner == COLOR_EMPTY && state.get_points(color) >= ScoreTracker::WINNING_POINTS) {
+        state.winner = color;
+    }
+    return drawn;
+}
+
+void StateEngine::end_turn(GameState &state) {
+    player_color color = static_cast<player_color>(state.current_player);
+    if (state.winner == COLOR_EMPTY && state.get_points(color) >= ScoreTracker::WINNING_POINTS) {
+        state.winner = color;
+    }
+    state.turn_count++;
+    state.current_player = (state.current_player + 1) % max<int>(state.player_count, 1);
+}
+
+PlotMask StateEngine::get_buildable_plots(const GameState &state, const player_color color, const bool needs_road) {
+    const StateTopology &topology = get_topology();
+    PlotMask blocked = 0;
+    for (PlotMask buildings = get_buildings(state, COLOR_EMPTY); buildings != 0; buildings &= buildings - 1) {
+        PlotId plot = lowest_bit(buildings);
+        blocked |= (PlotMask(1) << plot) | topology.plot_plots[plot];
+    }
+    PlotMask buildable = ((PlotMask(1) << StandardBoard::PLOT_COUNT) - 1) & ~blocked;
+    if (needs_road) {
+        PlotMask road_plots = 0;
+        for (PathId path = 0; path < StandardBoard::PATH_COUNT; path++) {
+            if (state.path_owners[path] == color) {
+                road_plots |= topology.path_plots[path];
+            }
+        }
+        buildable &= road_plots;
+    }
+    return buildable;
+}
+
+PathMask StateEngine::get_buildable_paths(const GameState &state, const player_color color) {
+    const StateTopology &topology = get_topology();
+    PathMask frontier;
+    PathMask occupied;
+    for (PathId path = 0; path < StandardBoard::PATH_COUNT; path++) {
+        if (state.path_owners[path] == color) {
+            frontier |= topology.path_paths[path];
+        }
+        if (state.path_owners[path] != COLOR_EMPTY) {
+            occupied |= PathMask::bit(path);
+        }
+    }
+    return frontier & ~occupied;
+}
+
+int StateEngine::get_trade_rate(const GameState &state, const player_color color, const tile_type resource) {
+    PortMask ports = 0;
+    for (PlotMask buildings = get_buildings(state, color); buildings != 0; buildings &= buildings - 1) {
+        ports |= state.plot_ports[lowest_bit(buildings)];
+    }
+    if (resource != TILE_EMPTY && (ports & port_bit(resource)) != 0) {
+        return 2;
+    }
+    return (ports & UNIVERSAL_PORT) != 0 ? 3 : 4;
+}
+
+int StateEngine::get_road_length(const GameState &state, const player_color color) {
+    const StateTopology &topology = get_topology();
+    PathMask roads = state.get_roads(color);
+    PlotMask broken = get_buildings(state, COLOR_EMPTY) & ~get_buildings(state, color);
+
+    PlotMask starts = 0;
+    for (PathMask remaining = roads; remaining.any(); ) {
+        PathId path = remaining.first();
+        remaining ^= PathMask::bit(path);
+        starts |= topology.path_plots[path];
+    }
+    // A trail may start or end on a broken plot, it just can't pass through one
+    int best = 0;
+    for (; starts != 0; starts &= starts - 1) {
+        best = max(best, trail_from(lowest_bit(starts), roads, PathMask(), broken));
+    }
+    return best;
+}
+
+int StateEngine::trail_from(const PlotId plot, const PathMask &roads, const PathMask &used, const PlotMask broken) {
+    const StateTopology &topology = get_topology();
+    int best = 0;
+    PathMask options = topology.plot_paths[plot] & roads & ~used;
+    while (options.any()) {
+        PathId path = options.first();
+        options ^= PathMask::bit(path);
+
+        PlotId next = lowest_bit(topology.path_plots[path] & ~(PlotMask(1) << plot));
+        int length = 1;
+        if (((broken >> next) & 1) == 0) {
+            length += trail_from(next, roads, used | PathMask::bit(path), broken);
+        }
+        best = max(best, length);
+    }
+    return best;
+}
+
+PlotMask StateEngine::get_tile_plots(const TileId tile) {
+    return get_topology().tile_plots[tile];
+}
+
+PlotMask StateEngine::get_plot_plots(const PlotId plot) {
+    return get_topology().plot_plots[plot];
+}
+
+PathMask StateEngine::get_plot_paths(const PlotId plot) {
+    return get_topology().plot_paths[plot];
+}
+
+PlotMask StateEngine::get_path_plots(const PathId path) {
+    return get_topology().path_plots[path];
+}
+
+int StateEngine::get_tile_pips(const GameState &state, const TileId tile) {
+    int number = state.tile_numbers[tile];
+    if (number < 2 || number > 12 || number == 7) {
+        return 0;
+    }
+    return 6 - std::abs(7 - number);
+}
+
+int StateEngine::get_plot_pips(const GameState &state, const PlotId plot) {
+    const StateTopology &topology = get_topology();
+    int pips = 0;
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        if (((topology.tile_plots[tile] >> plot) & 1) != 0) {
+            pips += get_tile_pips(state, tile);
+        }
+    }
+    return pips;
+}
+
+void StateEngine::take_from_bank(GameState &state, const player_color color, const tile_type resource, const int amount) {
+    int taken = min<int>(amount, state.bank_resources[resource]);
+    state.bank_resources[resource] -= taken;
+    state.players[color].resources[resource] += taken;
+}
+
+void StateEngine::pay(GameState &state, const player_color color,
+    const int grain, const int wool, const int brick, const int ore, const int lumber) {
+    const int amounts[] = {grain, wool, brick, ore, lumber};
+    for (int i = 0; i < 5; i++) {
+        int paid = min<int>(amounts[i], state.players[color].resources[RESOURCE_TYPES[i]]);
+        state.players[color].resources[RESOURCE_TYPES[i]] -= paid;
+        state.bank_resources[RESOURCE_TYPES[i]] += paid;
+    }
+}
+
+void StateEngine::produce(GameState &state, const int roll) {
+    const StateTopology &topology = get_topology();
+    // Summed per color first, since the bank's limit applies to what a player gets from the whole roll
+    array<array<int, TILE_EMPTY>, GameState::PLAYER_COUNT> gains{};
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        if (state.tile_numbers[tile] != roll || tile == state.robber_tile) {
+            continue;
+        }
+        tile_type resource = static_cast<tile_type>(state.tile_types[tile]);
+        if (resource == DESERT || resource == TILE_EMPTY) {
+            continue;
+        }
+        for (PlotMask plots = topology.tile_plots[tile]; plots != 0; plots &= plots - 1) {
+            PlotId plot = lowest_bit(plots);
+            if (state.plot_owners[plot] != COLOR_EMPTY) {
+                gains[state.plot_owners[plot]][resource] += state.plot_cities[plot] ? 2 : 1;
+            }
+        }
+    }
+    for (int color = 0; color < state.player_count; color++) {
+        for (tile_type resource : RESOURCE_TYPES) {
+            if (gains[color][resource] > 0) {
+                take_from_bank(state, static_cast<player_color>(color), resource, gains[color][resource]);
+            }
+        }
+    }
+}
+
+void StateEngine::seven_rolled(GameState &state, GameRandom &random) {
+    for (int color = 0; color < state.player_count; color++) {
+        PlayerState &player = state.players[color];
+        int total = player.get_resource_count();
+        if (total <= 7) {
+            continue;
+        }
+        array<int, TILE_EMPTY> discard = StatePolicy::choose_discard(state, static_cast<player_color>(color), total / 2);
+        for (tile_type resource : RESOURCE_TYPES) {
+            int count = min<int>(discard[resource], player.resources[resource]);
+            player.resources[resource] -= count;
+            state.bank_resources[resource] += count;
+        }
+    }
+    move_robber(state, random);
+}
+
+void StateEngine::move_robber(GameState &state, GameRandom &random) {
+    player_color color = static_cast<player_color>(state.current_player);
+    TileId tile = StatePolicy::choose_robber_tile(state, color);
+    if (tile < 0 || tile >= StandardBoard::TILE_COUNT || tile == state.robber_tile) {
+        tile = state.robber_tile == 0 ? 1 : 0;
+    }
+    state.robber_tile = static_cast<std::int8_t>(tile);
+
+    PlotMask tile_plots = get_topology().tile_plots[tile];
+    std::uint8_t targets = 0;
+    for (int other = 0; other < state.player_count; other++) {
+        if (other != color && (get_buildings(state, other) & tile_plots) != 0) {
+            targets |= 1 << other;
+        }
+    }
+    if (targets == 0) {
+        return;
+    }
+    player_color target = StatePolicy::choose_steal_target(state, color, targets);
+    if (target >= GameState::PLAYER_COUNT || ((targets >> target) & 1) == 0) {
+        target = static_cast<player_color>(lowest_bit(targets));
+    }
+
+    // A random card from the target's hand, same as Player::get_random_resource
+    PlayerState &victim = state.players[target];
+    int hand = victim.get_resource_count();
+    if (hand == 0) {
+        return;
+    }
+    int card = random.next_int(hand);
+    for (tile_type resource : RESOURCE_TYPES) {
+        if (card < victim.resources[resource]) {
+            victim.resources[resource]--;
+            state.players[color].resources[resource]++;
+            return;
+        }
+        card -= victim.resources[resource];
+    }
+}
+
+void StateEngine::play_devcard(GameState &state, const devcard_type type, GameRandom &random) {
+    player_color color = static_cast<player_color>(state.current_player);
+    PlayerState &player = state.players[color];
+    if (player.devcards[type] == 0 || player.played_devcard) {
+        return;
+    }
+    player.devcards[type]--;
+    player.played_devcard = true;
+
+    switch (type) {
+        case KNIGHT:
+            player.knights++;
+            update_largest_army(state, color);
+            move_robber(state, random);
+            return;
+        case ROAD_BUILDING:
+            for (int i = 0; i < 2; i++) {
+                PathMask paths = get_buildable_paths(state, color);
+                if (player.roads_left == 0 || !paths.any()) {
+                    return;
+                }
+                PathId path = StatePolicy::choose_free_road(state, color, random);
+                if (path < 0 || path >= StandardBoard::PATH_COUNT || !paths.test(path)) {
+                    path = paths.first();
+                }
+                place_road(state, color, path);
+            }
+            return;
+        case YEAR_OF_PLENTY:
+            for (int i = 0; i < 2; i++) {
+                tile_type resource = StatePolicy::choose_resource(state, color, YEAR_OF_PLENTY);
+                if (resource < GRAIN || resource > LUMBER || state.bank_resources[resource] == 0) {
+                    resource = TILE_EMPTY;
+                    for (tile_type option : RESOURCE_TYPES) {
+                        if (resource == TILE_EMPTY && state.bank_resources[option] > 0) {
+                            resource = option;
+                        }
+                    }
+                }
+                if (resource == TILE_EMPTY) {
+                    return;
+                }
+                take_from_bank(state, color, resource, 1);
+            }
+            return;
+        case MONOPOLY: {
+            tile_type resource = StatePolicy::choose_resource(state, color, MONOPOLY);
+            if (resource < GRAIN || resource > LUMBER) {
+                resource = GRAIN;
+            }
+            for (int other = 0; other < state.player_count; other++) {
+                if (other != color) {
+                    player.resources[resource] += state.players[other].resources[resource];
+                    state.players[other].resources[resource] = 0;
+                }
+            }
+            return;
+        }
+        default:
+            return;
+    }
+}
+
+void StateEngine::place_road(GameState &state, const player_color color, const PathId path) {
+    state.path_owners[path] = color;
+    state.players[color].roads_left--;
+    update_road_lengths(state);
+}
+
+void StateEngine::update_road_lengths(GameState &state) {
+    for (int c = 0; c < state.player_count; c++) {
+        player_color color = static_cast<player_color>(c);
+        PlayerState &player = state.players[c];
+        int length = get_road_length(state, color);
+        if (length == player.road_length) {
+            continue;
+        }
+        player.road_length = length;
+
+        if (state.longest_road_holder == COLOR_EMPTY) {
+            if (length >= 5) {
+                state.longest_road_holder = color;
+            }
+        } else if (state.longest_road_holder != color && length > state.players[state.longest_road_holder].road_length) {
+            state.longest_road_holder = color;
+        }
+    }
+}
+
+void StateEngine::update_largest_army(GameState &state, const player_color color) {
+    int knights = state.players[color].knights;
+    if (state.largest_army_holder == COLOR_EMPTY) {
+        if (knights >= 3) {
+            state.largest_army_holder = color;
+        }
+    } else if (state.largest_army_holder != color && knights > state.players[state.largest_army_holder].knights) {
+        state.largest_army_holder = color;
+    }
+}
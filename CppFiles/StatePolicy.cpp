@@ -0,0 +1,352 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/StatePolicy.h"
+#include "../HeaderFiles/GameRandom.h"
+#include "../HeaderFiles/StateEngine.h"
+#include "../HeaderFiles/StandardBoard.h"
+#include "../HeaderFiles/ResourceVector.h"
+#include "../HeaderFiles/TradePlanner.h"
+#include "../HeaderFiles/Craftable.h"
+
+using std::array;
+
+// Extra score for each different resource a plot produces, and for a plot on a port
+static const int VARIETY_BONUS = 2;
+static const int PORT_BONUS = 1;
+
+// Players this close to winning aren't helped with trades
+static const int TRADE_POINTS_LIMIT = ScoreTracker::WINNING_POINTS - 2;
+
+/**
+* Requires: state, actions, action type
+* Modifies: nothing
+* Effects: returns the index of the action of the type on the plot with the best score, or -1 if there is none
+*/
+static int best_building(const GameState &state, const ActionList &actions, const action_type type) {
+    int best = -1;
+    int best_score = -1;
+    for (int i = 0; i < actions.size(); i++) {
+        if (actions[i].type != type) {
+            continue;
+        }
+        int score = StatePolicy::score_plot(state, actions[i].target);
+        if (score > best_score) {
+            best = i;
+            best_score = score;
+        }
+    }
+    return best;
+}
+
+/**
+* Requires: state, color, action to fill
+* Modifies: trade
+* Effects: fills the trade with the first of the cheapest maritime trades which would let the color build a
+* city, or failing that a settlement, and returns true. Returns false if no trades are needed or none would do
+*/
+static bool plan_build_trade(const GameState &state, const player_color color, Action &trade) {
+    const PlayerState &player = state.players[color];
+    bool city = player.cities_left > 0 && state.get_settlements(color) != 0;
+    bool settlement = player.settlements_left > 0 && StateEngine::get_buildable_plots(state, color, true) != 0;
+    if (!city && !settlement) {
+        return false;
+    }
+
+    ResourceVector hand;
+    ResourceVector bank;
+    ResourceVector rates;
+    for (tile_type resource : RESOURCE_TYPES) {
+        hand.set(resource, player.resources[resource]);
+        bank.set(resource, state.bank_resources[resource]);
+        rates.set(resource, StateEngine::get_trade_rate(state, color, resource));
+    }
+
+    // Rollouts ask for a plan every turn, so each thread keeps one list
+    thread_local ActionList trades;
+    if ((city && TradePlanner::plan(hand, rates, Craftable::CITY_RECIPE, bank, trades) > 0) ||
+        (settlement && TradePlanner::plan(hand, rates, Craftable::SETTLEMENT_RECIPE, bank, trades) > 0)) {
+        trade = trades[0];
+        return true;
+    }
+    return false;
+}
+
+Action StatePolicy::choose_action(const GameState &state, const ActionList &actions, GameRandom &random) {
+    player_color color = static_cast<player_color>(state.current_player);
+    const PlayerState &player = state.players[color];
+
+    for (action_type type : {BUILD_CITY, BUILD_SETTLEMENT}) {
+        int best = best_building(state, actions, type);
+        if (best != -1) {
+            return actions[best];
+        }
+    }
+
+    int roads = 0;
+    int road_index = -1;
+    for (int i = 0; i < actions.size(); i++) {
+        const Action &action = actions[i];
+        if (action.type == PLAY_DEVCARD && random.next_int(2) == 0) {
+            return action;
+        }
+        if (action.type == BUY_DEVCARD && random.next_int(2) == 0) {
+            return action;
+        }
+        if (action.type == BUILD_ROAD) {
+            roads++;
+            road_index = i;
+        }
+    }
+
+    // Roads only when there is nowhere left to put a settlement
+    if (roads > 0 && StateEngine::get_buildable_plots(state, color, true) == 0) {
+        PathId path = choose_free_road(state, color, random);
+        for (const Action &action : actions) {
+            if (action.type == BUILD_ROAD && action.target == path) {
+                return action;
+            }
+        }
+        return actions[road_index];
+    }
+
+    // Trade towards a city, or a settlement with somewhere to go, when the bank can make up what's missing
+    Action planned;
+    if (plan_build_trade(state, color, planned)) {
+        for (const Action &action : actions) {
+            if (action.type == MARITIME_TRADE && action.give == planned.give && action.receive == planned.receive) {
+                return action;
+            }
+        }
+    }
+
+    // Trade spare cards for a resource the player has none of. The new card can never pay for a trade
+    // back, so this can't go round in circles
+    for (const Action &action : actions) {
+        if (action.type == MARITIME_TRADE && player.resources[action.receive] == 0 &&
+            player.resources[action.give] > action.give_amount) {
+            return action;
+        }
+    }
+
+    return actions[actions.size() - 1];
+}
+
+int StatePolicy::score_plot(const GameState &state, const PlotId plot) {
+    int score = 0;
+    bool produces[TILE_EMPTY] = {};
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        if (((StateEngine::get_tile_plots(tile) >> plot) & 1) == 0) {
+            continue;
+        }
+        int pips = StateEngine::get_tile_pips(state, tile);
+        score += pips;
+        if (pips > 0 && !produces[state.tile_types[tile]]) {
+            produces[state.tile_types[tile]] = true;
+            score += VARIETY_BONUS;
+        }
+    }
+    if (state.plot_ports[plot] != 0) {
+        score += PORT_BONUS;
+    }
+    return score;
+}
+
+PlotId StatePolicy::choose_initial_settlement(const GameState &state, const player_color color) {
+    PlotId best = INVALID_ID;
+    int best_score = -1;
+    for (PlotMask plots = StateEngine::get_buildable_plots(state, color, false); plots != 0; plots &= plots - 1) {
+        PlotId plot = lowest_bit(plots);
+        int score = score_plot(state, plot);
+        if (score > best_score) {
+            best = plot;
+            best_score = score;
+        }
+    }
+    return best;
+}
+
+PathId StatePolicy::choose_initial_road(const GameState &state, const player_color color, const PlotId settlement) {
+    PlotMask buildable = StateEngine::get_buildable_plots(state, color, false);
+    PathId best = INVALID_ID;
+    int best_score = -1;
+    for (PathMask paths = StateEngine::get_plot_paths(settlement); paths.any(); ) {
+        PathId path = paths.first();
+        paths ^= PathMask::bit(path);
+        if (state.path_owners[path] != COLOR_EMPTY) {
+            continue;
+        }
+        // The best plot one more road away, past the other end of this one
+        PlotId far_end = lowest_bit(StateEngine::get_path_plots(path) & ~(PlotMask(1) << settlement));
+        int score = 0;
+        for (PlotMask next = StateEngine::get_plot_plots(far_end) & buildable; next != 0; next &= next - 1) {
+            score = std::max(score, score_plot(state, lowest_bit(next)));
+        }
+        if (score > best_score) {
+            best = path;
+            best_score = score;
+        }
+    }
+    return best;
+}
+
+PathId StatePolicy::choose_free_road(const GameState &state, const player_color color, GameRandom &random) {
+    PathMask paths = StateEngine::get_buildable_paths(state, color);
+    if (!paths.any()) {
+        return INVALID_ID;
+    }
+    PlotMask buildable = StateEngine::get_buildable_plots(state, color, false);
+    PathId best = INVALID_ID;
+    int best_score = 0;
+    for (PathMask remaining = paths; remaining.any(); ) {
+        PathId path = remaining.first();
+        remaining ^= PathMask::bit(path);
+        for (PlotMask ends = StateEngine::get_path_plots(path) & buildable; ends != 0; ends &= ends - 1) {
+            int score = score_plot(state, lowest_bit(ends));
+            if (score > best_score) {
+                best = path;
+                best_score = score;
+            }
+        }
+    }
+    if (best != INVALID_ID) {
+        return best;
+    }
+
+    int n = random.next_int(paths.count());
+    for (; n > 0; n--) {
+        paths ^= PathMask::bit(paths.first());
+    }
+    return paths.first();
+}
+
+array<int, TILE_EMPTY> StatePolicy::choose_discard(const GameState &state, const player_color color, const int number_of_resources) {
+    array<int, TILE_EMPTY> hand{};
+    for (tile_type resource : RESOURCE_TYPES) {
+        hand[resource] = state.players[color].resources[resource];
+    }
+    array<int, TILE_EMPTY> discard{};
+    for (int i = 0; i < number_of_resources; i++) {
+        tile_type biggest = GRAIN;
+        for (tile_type resource : RESOURCE_TYPES) {
+            if (hand[resource] > hand[biggest]) {
+                biggest = resource;
+            }
+        }
+        if (hand[biggest] == 0) {
+            break;
+        }
+        hand[biggest]--;
+        discard[biggest]++;
+    }
+    return discard;
+}
+
+TileId StatePolicy::choose_robber_tile(const GameState &state, const player_color color) {
+    TileId best = INVALID_ID;
+    int best_score = 0;
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        if (tile == state.robber_tile) {
+            continue;
+        }
+        int pips = StateEngine::get_tile_pips(state, tile);
+        int score = 0;
+        for (PlotMask plots = StateEngine::get_tile_plots(tile); plots != 0; plots &= plots - 1) {
+            PlotId plot = lowest_bit(plots);
+            int owner = state.plot_owners[plot];
+            if (owner == COLOR_EMPTY) {
+                continue;
+            }
+            int production = pips * (state.plot_cities[plot] ? 2 : 1);
+            if (owner == color) {
+                score -= production * ScoreTracker::WINNING_POINTS;
+            } else {
+                score += production * (1 + state.get_points(static_cast<player_color>(owner), false));
+            }
+        }
+        if (best == INVALID_ID || score > best_score) {
+            best = tile;
+            best_score = score;
+        }
+    }
+    return best;
+}
+
+player_color StatePolicy::choose_steal_target(const GameState &state, const player_color, const std::uint8_t targets) {
+    player_color best = COLOR_EMPTY;
+    for (int target = 0; target < GameState::PLAYER_COUNT; target++) {
+        if (((targets >> target) & 1) == 0) {
+            continue;
+        }
+        if (best == COLOR_EMPTY || state.players[target].get_resource_count() > state.players[best].get_resource_count()) {
+            best = static_cast<player_color>(target);
+        }
+    }
+    return best;
+}
+
+tile_type StatePolicy::choose_resource(const GameState &state, const player_color color, const devcard_type reason) {
+    tile_type best = TILE_EMPTY;
+    int best_count = 0;
+    for (tile_type resource : RESOURCE_TYPES) {
+        int count = 0;
+        if (reason == MONOPOLY) {
+            for (int other = 0; other < state.player_count; other++) {
+                if (other != color) {
+                    count += state.players[other].resources[resource];
+                }
+            }
+            if (best == TILE_EMPTY || count > best_count) {
+                best = resource;
+                best_count = count;
+            }
+        } else if (state.bank_resources[resource] > 0) {
+            count = state.players[color].resources[resource];
+            if (best == TILE_EMPTY || count < best_count) {
+                best = resource;
+                best_count = count;
+            }
+        }
+    }
+    return best;
+}
+
+bool StatePolicy::respond_to_trade(const GameState &state, const player_color color, const player_color proposer,
+    const array<int, TILE_EMPTY> &receive, const array<int, TILE_EMPTY> &give) {
+    if (proposer < GameState::PLAYER_COUNT && state.get_points(proposer, false) >= TRADE_POINTS_LIMIT) {
+        return false;
+    }
+    int received = 0;
+    int given = 0;
+    bool fills_gap = false;
+    for (tile_type resource : RESOURCE_TYPES) {
+        if (give[resource] > state.players[color].resources[resource]) {
+            return false;
+        }
+        received += receive[resource];
+        given += give[resource];
+        fills_gap = fills_gap || (receive[resource] > 0 && state.players[color].resources[resource] == 0);
+    }
+    return received > given || (received == given && received > 0 && fills_gap);
+}
+
+void StatePolicy::play_turn(GameState &state, GameRandom &random, ActionList &actions) {
+    StateEngine::start_turn(state, StateEngine::roll_dice(random), random);
+    for (int i = 0; i < StateEngine::MAX_ACTIONS_PER_TURN && state.winner == COLOR_EMPTY; i++) {
+        StateEngine::generate(state, actions);
+        Action action = choose_action(state, actions, random);
+        if (action.type == PASS_TURN) {
+            break;
+        }
+        StateEngine::apply_action(state, action, random);
+    }
+    StateEngine::end_turn(state);
+}
+
+void StatePolicy::play_out(GameState &state, GameRandom &random, const int max_turns) {
+    ActionList actions;
+    for (int turn = 0; turn < max_turns && state.winner == COLOR_EMPTY; turn++) {
+        play_turn(state, random, actions);
+    }
+}
@@ -4,10 +4,9 @@
 
 #include "../HeaderFiles/Tile.h"
 #include "../HeaderFiles/Board.h"
+#include "../HeaderFiles/OutputSink.h"
 
-#include <iostream>
 
-using std::cout, std::endl;
 using std::string, std::map, std::shared_ptr, std::to_string;
 
 Tile::Tile(
@@ -48,6 +47,14 @@ OrderedPair Tile::get_position_coordinate() const{
     return position_coordinate;
 }
 
+TileId Tile::get_id() const {
+    return id;
+}
+
+void Tile::set_id(const TileId _id) {
+    id = _id;
+}
+
 string Tile::get_position_id() const{
     return position_id;
 }
@@ -170,7 +177,7 @@ void Tile::produce_resource(const bool print) const {
     // For example, if a player gains 1 grain from two different tiles, it will just say 2 grain, not 1 grain twice.
     for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
 
-        map<tile_type, int> resource_gains = Player::get_base_resource_map();
+        ResourceVector resource_gains;
         shared_ptr<Player> current_player = nullptr;
 
         for (auto &pair : adjacent_plots) {
@@ -179,7 +186,7 @@ void Tile::produce_resource(const bool print) const {
             if (pair.second->get_inhabitant()->get_color() != color) {
                 continue; }
             current_player = pair.second->get_inhabitant()->get_owner();
-            resource_gains[type] += pair.second->get_inhabitant()->get_resource_production();
+            resource_gains.add(type, pair.second->get_inhabitant()->get_resource_production());
         }
 
         if (current_player == nullptr) {
@@ -198,28 +205,13 @@ void Tile::add_to_adjacent_paths(const int key, shared_ptr<Path> path) {
 
 // This sets the plot icon override, which is either nothing if it has a building, X if it is invalid, or its index if it is valid
 void Tile::override_plot_icons(const Board &board, const player_color color, const bool require_adjacent_road) {
+    PlotMask buildable_plots = board.get_bitboards().get_buildable_plots(color, require_adjacent_road);
     for (auto &pair : adjacent_plots) {
         if (pair.second->is_occupied()) {
             continue;
         }
 
-        bool conforms_to_road_rule = true;
-        if (require_adjacent_road) {
-            conforms_to_road_rule = false;
-            for (auto &adj : pair.second->get_adjacent_plots()) {
-                shared_ptr<Path> path = board.get_path(adj.second->get_position_coordinates(),
-                    pair.second->get_position_coordinates());
-                if (path == nullptr) {
-                    continue;
-                }
-
-                if (path->is_occupied() && path->get_inhabitant()->get_color() == color) {
-                    conforms_to_road_rule = true;
-                }
-            }
-        }
-
-        if (pair.second->next_to_building() || !conforms_to_road_rule) {
+        if ((buildable_plots >> pair.second->get_id() & 1) == 0) {
             pair.second->set_icon_override("X");
         } else {
             pair.second->set_icon_override("\033[1m" + to_string(pair.first) + "\033[1m");
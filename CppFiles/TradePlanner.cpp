@@ -0,0 +1,78 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/TradePlanner.h"
+#include "../HeaderFiles/Board.h"
+#include "../HeaderFiles/Player.h"
+#include "../HeaderFiles/GameBank.h"
+
+#include <algorithm>
+
+ResourceVector TradePlanner::get_trade_rates(const PortMask ports) {
+    ResourceVector rates = ResourceVector::filled((ports & UNIVERSAL_PORT) != 0 ? 3 : 4);
+    for (tile_type resource : RESOURCE_TYPES) {
+        if ((ports & port_bit(resource)) != 0) {
+            rates.set(resource, 2);
+        }
+    }
+    return rates;
+}
+
+int TradePlanner::plan(const ResourceVector &hand, const ResourceVector &rates, const ResourceVector &target,
+    const ResourceVector &bank, ActionList &trades) {
+
+    trades.clear();
+    ResourceVector missing = target - hand;
+    if (missing.is_empty()) {
+        return 0;
+    }
+    if (!bank.covers(missing)) {
+        return NO_PLAN;
+    }
+    ResourceVector spare = hand - target;
+
+    // How many trades each resource pays for, cheapest rates first
+    ResourceVector payments;
+    int trades_needed = missing.get_total();
+    int cost = 0;
+    for (int rate = 2; rate <= 4 && trades_needed > 0; rate++) {
+        for (tile_type resource : RESOURCE_TYPES) {
+            if (rates.get(resource) != rate) {
+                continue;
+            }
+            int count = std::min(spare.get(resource) / rate, trades_needed);
+            payments.set(resource, count);
+            trades_needed -= count;
+            cost += count * rate;
+        }
+    }
+    if (trades_needed > 0) {
+        return NO_PLAN;
+    }
+
+    // Pair each payment with a missing card
+    tile_type receive = GRAIN;
+    for (tile_type give : RESOURCE_TYPES) {
+        for (int i = 0; i < payments.get(give); i++) {
+            while (missing.get(receive) == 0) {
+                receive = static_cast<tile_type>(receive + 1);
+            }
+            missing.add(receive, -1);
+
+            Action trade;
+            trade.type = MARITIME_TRADE;
+            trade.give = give;
+            trade.give_amount = rates.get(give);
+            trade.receive = receive;
+            trades.push(trade);
+        }
+    }
+    return cost;
+}
+
+int TradePlanner::plan(const Board &board, const Player &player, const GameBank &bank, const ResourceVector &target,
+    ActionList &trades) {
+    ResourceVector rates = get_trade_rates(board.get_bitboards().get_port_access(player.get_color()));
+    return plan(player.get_resources(), rates, target, bank.get_available_resources(), trades);
+}
@@ -0,0 +1,66 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/TranspositionTable.h"
+
+#include <algorithm>
+#include <cstring>
+
+using std::uint64_t;
+
+// Slots are read and written with relaxed atomics: the XOR check catches torn slots, so no ordering is needed
+static const std::memory_order RELAXED = std::memory_order_relaxed;
+
+TranspositionTable::TranspositionTable(const int size_log2) {
+    std::size_t size = std::size_t(1) << std::clamp(size_log2, 0, 30);
+    slots = std::make_unique<Slot[]>(size);
+    mask = size - 1;
+}
+
+uint64_t TranspositionTable::pack(const TranspositionEntry &entry) {
+    uint64_t data;
+    std::memcpy(&data, &entry, sizeof(data));
+    return data;
+}
+
+TranspositionEntry TranspositionTable::unpack(const uint64_t data) {
+    TranspositionEntry entry;
+    std::memcpy(&entry, &data, sizeof(entry));
+    return entry;
+}
+
+void TranspositionTable::store(const uint64_t hash, const TranspositionEntry &entry) {
+    Slot &slot = slots[hash & mask];
+    uint64_t old_data = slot.data.load(RELAXED);
+    bool same_position = (slot.check.load(RELAXED) ^ old_data) == hash;
+    if (!same_position && old_data != 0 && unpack(old_data).depth > entry.depth) {
+        return;
+    }
+    uint64_t data = pack(entry);
+    slot.check.store(hash ^ data, RELAXED);
+    slot.data.store(data, RELAXED);
+}
+
+bool TranspositionTable::probe(const uint64_t hash, TranspositionEntry &entry) const {
+    const Slot &slot = slots[hash & mask];
+    uint64_t data = slot.data.load(RELAXED);
+    uint64_t check = slot.check.load(RELAXED);
+    // An all zero slot has never been stored into
+    if (data == 0 || (check ^ data) != hash) {
+        return false;
+    }
+    entry = unpack(data);
+    return true;
+}
+
+void TranspositionTable::clear() {
+    for (std::size_t i = 0; i <= mask; i++) {
+        slots[i].check.store(0, RELAXED);
+        slots[i].data.store(0, RELAXED);
+    }
+}
+
+std::size_t TranspositionTable::get_size() const {
+    return mask + 1;
+}
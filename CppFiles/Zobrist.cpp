@@ -0,0 +1,98 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#include "../HeaderFiles/Zobrist.h"
+#include "../HeaderFiles/GameRandom.h"
+
+#include <algorithm>
+
+using std::uint64_t;
+
+// Any fixed seed will do, as long as it never changes between runs
+static const uint64_t ZOBRIST_SEED = 0x5a0b1257ULL;
+
+ZobristKeys::ZobristKeys() {
+    GameRandom random(ZOBRIST_SEED);
+    auto fill_counts = [&random](CountKeys &keys) {
+        keys[0] = 0;
+        for (int count = 1; count < MAX_COUNT; count++) {
+            keys[count] = random.next();
+        }
+    };
+
+    for (auto &plot : plots) {
+        for (auto &color : plot) {
+            for (uint64_t &key : color) {
+                key = random.next();
+            }
+        }
+    }
+    for (auto &path : paths) {
+        for (uint64_t &key : path) {
+            key = random.next();
+        }
+    }
+    for (uint64_t &key : robber) {
+        key = random.next();
+    }
+    for (int color = 0; color < COLOR_COUNT; color++) {
+        for (CountKeys &keys : resources[color]) {
+            fill_counts(keys);
+        }
+        for (CountKeys &keys : devcards[color]) {
+            fill_counts(keys);
+        }
+        fill_counts(knights[color]);
+        turn[color] = random.next();
+    }
+    for (CountKeys &keys : deck) {
+        fill_counts(keys);
+    }
+    setup = random.next();
+}
+
+const ZobristKeys& ZobristKeys::get() {
+    static const ZobristKeys keys;
+    return keys;
+}
+
+uint64_t ZobristKeys::count_key(const CountKeys &keys, const int count) {
+    return keys[std::clamp(count, 0, MAX_COUNT - 1)];
+}
+
+uint64_t ZobristKeys::plot_key(const PlotId plot, const player_color color, const building_type type) const {
+    return plots[plot][color][type];
+}
+
+uint64_t ZobristKeys::path_key(const PathId path, const player_color color) const {
+    return paths[path][color];
+}
+
+uint64_t ZobristKeys::robber_key(const TileId tile) const {
+    return robber[tile];
+}
+
+uint64_t ZobristKeys::resource_key(const player_color color, const tile_type resource, const int count) const {
+    return count_key(resources[color][resource], count);
+}
+
+uint64_t ZobristKeys::devcard_key(const player_color color, const devcard_type type, const int count) const {
+    return count_key(devcards[color][type], count);
+}
+
+uint64_t ZobristKeys::knight_key(const player_color color, const int count) const {
+    return count_key(knights[color], count);
+}
+
+uint64_t ZobristKeys::deck_key(const devcard_type type, const int count) const {
+    return count_key(deck[type], count);
+}
+
+uint64_t ZobristKeys::turn_key(const player_color color) const {
+    return turn[color];
+}
+
+uint64_t ZobristKeys::setup_key() const {
+    return setup;
+}
@@ -0,0 +1,105 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef AGENT_H
+#define AGENT_H
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "Enums.h"
+#include "ResourceVector.h"
+#include "LegalActionGenerator.h"
+
+class Board;
+class Player;
+
+/*
+ * An Agent makes every decision for one player, and nothing else.
+ *
+ * The GameEngine owns the rules: it rolls the dice, moves resources, places pieces, and checks what the
+ * Agent chose against what is legal. Whenever the player has a choice to make, the engine asks the
+ * player's Agent. The console prompts are one Agent (ConsoleAgent), so a person can play, and automated
+ * agents (like RandomAgent) can play whole games without any input or output.
+ *
+ * The board is passed non-const only so console agents can highlight things while displaying it. Agents
+ * must not change the game through it.
+ */
+
+class Agent {
+
+    public:
+
+        virtual ~Agent() = default;
+
+        /**
+        * Requires: board, player
+        * Modifies: nothing
+        * Effects: returns the id of the plot to place an initial settlement on (no road needed)
+        */
+        virtual PlotId choose_initial_settlement(Board &board, const std::shared_ptr<Player> &player) = 0;
+
+        /**
+        * Requires: board, player, plot id of the settlement just placed
+        * Modifies: nothing
+        * Effects: returns the id of the path next to the settlement to place an initial road on
+        */
+        virtual PathId choose_initial_road(Board &board, const std::shared_ptr<Player> &player, const PlotId settlement) = 0;
+
+        /**
+        * Requires: board, player whose turn it is, legal actions (never empty, always has PASS_TURN)
+        * Modifies: nothing
+        * Effects: returns the action to take next. Passing ends the turn
+        */
+        virtual Action choose_action(Board &board, const std::shared_ptr<Player> &player, const ActionList &legal_actions) = 0;
+
+        /**
+        * Requires: board, player
+        * Modifies: nothing
+        * Effects: returns the id of the path to place a free road on, from playing Road Building
+        */
+        virtual PathId choose_free_road(Board &board, const std::shared_ptr<Player> &player) = 0;
+
+        /**
+        * Requires: board, player, number of resources to discard
+        * Modifies: nothing
+        * Effects: returns the resources to discard after a 7 was rolled, adding up to the number
+        */
+        virtual ResourceVector choose_discard(
+            Board &board, const std::shared_ptr<Player> &player, const int number_of_resources) = 0;
+
+        /**
+        * Requires: board, player
+        * Modifies: nothing
+        * Effects: returns the id of the tile to move the robber to, which can't be the tile it is on
+        */
+        virtual TileId choose_robber_tile(Board &board, const std::shared_ptr<Player> &player) = 0;
+
+        /**
+        * Requires: board, player, colors of the players with a building next to the robber (never empty)
+        * Modifies: nothing
+        * Effects: returns the color of the player to steal a random resource from
+        */
+        virtual player_color choose_steal_target(
+            Board &board, const std::shared_ptr<Player> &player, const std::vector<player_color> &targets) = 0;
+
+        /**
+        * Requires: board, player, the devcard the resource is for (YEAR_OF_PLENTY or MONOPOLY)
+        * Modifies: nothing
+        * Effects: returns the resource to take from the bank or from the other players
+        */
+        virtual tile_type choose_resource(Board &board, const std::shared_ptr<Player> &player, const devcard_type reason) = 0;
+
+        /**
+        * Requires: board, player the trade is offered to, proposer, what the proposer pays, what the player pays
+        * Modifies: nothing
+        * Effects: returns if the player accepts the trade
+        */
+        virtual bool respond_to_trade(
+            Board &board, const std::shared_ptr<Player> &player, const std::shared_ptr<Player> &proposer,
+            const ResourceVector &payment, const ResourceVector &gain) = 0;
+};
+
+#endif //AGENT_H
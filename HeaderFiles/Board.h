@@ -5,6 +5,7 @@
 #ifndef BOARD_H
 #define BOARD_H
 
+#include <array>
 #include <map>
 #include <memory>
 #include <vector>
@@ -15,8 +16,23 @@
 #include "Enums.h"
 #include "Plot.h"
 #include "Path.h"
+#include "BoardGraph.h"
+#include "CoordinateGrid.h"
+#include "StandardBoard.h"
 
+class BoardRenderer;
+class GameRandom;
 class Player;
+struct BalanceOptions;
+
+// Everything that makes one board different from another, in the order of StandardBoard's tiles and ports
+struct BoardLayout {
+	std::array<tile_type, StandardBoard::TILE_COUNT> tile_types{};
+	// -1 for the desert
+	std::array<int, StandardBoard::TILE_COUNT> tile_numbers{};
+	// The resource each port trades 2:1, or TILE_EMPTY for a 3:1 port
+	std::array<tile_type, StandardBoard::PORT_COUNT> port_types{};
+};
 
 class Board {
 
@@ -68,15 +84,34 @@ class Board {
         *                               O ----- O
         *
         *
-        * The map will store 3 maps, each containing all of their tiles
+        * Tiles are stored contiguously in the order they are created (ring a, then b, then c), so a tile's
+        * TileId is its index in the list. get_board_tiles() still hands out the 3 ring maps.
         *
          */
-        std::map<char, std::map<char, Tile>> board_tiles;
+        std::vector<Tile> board_tiles;
 
 		// These sets store all the plots and paths on the map
 		std::set<std::shared_ptr<Plot>> board_plots;
 		std::set<std::shared_ptr<Path>> board_paths;
 
+		// The same plots and paths, indexed by their PlotId and PathId
+		std::vector<std::shared_ptr<Plot>> plot_list;
+		std::vector<std::shared_ptr<Path>> path_list;
+
+		// Coordinate -> id lookups for plots and tiles. Paths are keyed by CoordinateGrid::edge_key of their endpoints
+		CoordinateGrid plot_grid;
+		CoordinateGrid path_grid;
+		CoordinateGrid tile_grid;
+
+		// Id based adjacency tables for plots, paths, and tiles, filled once in create_board
+		BoardGraph graph;
+
+		// Bit masks of what each player has built, shared with every plot and path on the board which update it
+		std::shared_ptr<BoardBitboards> bitboards;
+
+		// Id of the tile which currently has the robber
+		TileId robber_tile;
+
 		// List of the available numbers to choose from for board creation at the start
 		const std::vector<int> available_production_numbers = {2, 3, 3, 4, 4, 5, 5, 6, 6, 8, 8, 9, 9, 10, 10, 11, 11, 12};
 
@@ -111,110 +146,84 @@ class Board {
 
 		std::vector<PortPair> ports;
 
+		// Keeps the drawing of the board between displays, made the first time the board is displayed
+		mutable std::shared_ptr<BoardRenderer> renderer;
+
+		// Whether display_board redraws the board in place at the top of the terminal
+		bool display_pinned = false;
+
+		/**
+		 * Requires: coordinate
+		 * Modifies: nothing
+		 * Effects: returns a pointer to the tile at the coordinate, or nullptr if there isn't one
+		 */
+		const Tile* find_tile(const OrderedPair &position_coordinates) const;
+
     public:
 
 		/**
-		 * Requires: Nothing
+		 * Requires: the game's random numbers
+		 * Modifies: board_tiles, random
+		 * Effects: Calls create_board with a random layout
+		 */
+		explicit Board(GameRandom &random);
+
+		/**
+		 * Requires: the game's random numbers, how to look for a balanced board
+		 * Modifies: board_tiles, random
+		 * Effects: Calls create_board with the most balanced of many random layouts, see BoardBalancer
+		 */
+		Board(GameRandom &random, const BalanceOptions &balance);
+
+		/**
+		 * Requires: layout
 		 * Modifies: board_tiles
-		 * Effects: Calls create_board
+		 * Effects: Calls create_board with the layout, to make the same board again
 		 */
-		Board();
+		explicit Board(const BoardLayout &layout);
 
 		/**
-		 * Requires: map of available tiles types, vector of available production numbers
+		 * Requires: layout
 		 * Modifies: board_tiles
 		 * Effects: Creates the board and populates board_tiles with tiles
 		 */
-        void create_board(
-        	std::map<tile_type, int> _available_tile_types, std::vector<int> _available_production_numbers);
+        void create_board(const BoardLayout &layout);
 
 		/* Helper functions for create_board function */
 
 		/**
-		 * Requires: map of adjacent plots, position coordinates
-		 * Modifies: board_plots, tiles in board_tiles
-		 * Effects: fills the board_plots field with the plots on the board
-		 * and fills the tiles with their adjacent plots
+		 * Requires: map of available tiles types, vector of available production numbers, random numbers
+		 * Modifies: random
+		 * Effects: returns a random layout using the available tiles and numbers, with the ports in a random rotation
 		 */
-		void fill_adjacent_plots(
-			std::map<int, std::shared_ptr<Plot>> &adjacent_plots,
-			const OrderedPair &position_coordinates);
+		static BoardLayout get_random_layout(
+			std::map<tile_type, int> _available_tile_types, std::vector<int> _available_production_numbers,
+			GameRandom &random);
 
 		/**
-		 * Requires: coordinate
-		 * Modifies: nothing
-		 * Effects: returns the PortPair at the coordinate
-		 */
-		PortPair get_corresponding_portpair(const OrderedPair coord) const;
-
-		/**
-		 * Requires: nothing
+		 * Requires: layout
 		 * Modifies: ports
 		 * Effects: Fills the ports vector with PortPairs
 		 */
-		void populate_port_pairs();
-
-		/**
-		 * Requires: adjacent_paths, adjacent_plots, coordinate
-		 * Modifies: board_paths, tiles in board_tiles
-		 * Effects: fills the board_paths field with the paths on the board
-		 * and fills the tiles with their adjacent paths
-		 */
-		void fill_adjacent_paths(
-			std::map<int, std::shared_ptr<Path>>
-			&adjacent_paths,
-			const std::map<int,
-			std::shared_ptr<Plot>> &adjacent_plots,
-			const OrderedPair &position_coordinates);
+		void populate_port_pairs(const BoardLayout &layout);
 
 		/**
 		 * Requires: bool to show the tiles' ids, vector of tile_id strings of tiles to highlight
-		 * Modifies: nothing
-		 * Effects: Prints the board formatted properly
+		 * Modifies: renderer
+		 * Effects: Prints the board formatted properly, or only what changed since it was last shown if it is pinned
 		 */
         void display_board(
         	const bool show_tile_position_ids = false,
         	const std::vector<std::string> highlighted_tiles = {}) const;
 
-		/* Helper functions for display_board function */
-		// Each of these add some string to the print layers for displaying the board
-		// The path and plot functions do so while also making sure the path or plot hasn't been added already
-		/**
-		 * Requires: coordinate, print_layers, layer_index, plots already added, whether there should be a space after
-		 * Modifies: print_layers, added_plots
-		 * Effects: Add plot's icon to the print layer
-		 */
-		void append_plot_to_print_layer(
-			const OrderedPair &global_plot_coords,
-			std::map<int, std::string> &print_layers,
-			const int layer_index,
-			std::set<std::shared_ptr<Plot>> &added_plots,
-			const bool space_after) const;
-
 		/**
-		 * Requires: endpoint, direction, print_layers, layer_index, plots already added, whether there should be a space after
-		 * Modifies: print_layers, added_paths
-		 * Effects: Add path's icon to the print layer
+		 * Requires: whether to pin the board
+		 * Modifies: display_pinned, the terminal
+		 * Effects: if pinned, clears the screen and from then on display_board keeps the board at the top of
+		 * it, sending only the cells that changed, while everything else scrolls in the lines beneath. Unpinning
+		 * lets text scroll over the whole screen again
 		 */
-		void append_path_to_print_layer(
-			const std::shared_ptr<Plot> &endpoint,
-			const int &direction,
-			std::map<int, std::string> &print_layers,
-			const int layer_index,
-			std::set<std::shared_ptr<Path>> &added_paths,
-			const bool space_after) const;
-
-		/**
-		 * Requires: strint to add, print_layers, layer_index, whether there should be a space after
-		 * Modifies: print_layers
-		 * Effects: Adds the provided string to the given print layer
-		 */
-		void append_string_to_print_layer(
-			const std::string &to_add,
-			std::map<int, std::string> &print_layers,
-			const int layer_index,
-			const bool space_after) const;
-
+		void set_display_pinned(const bool pinned);
 
 		/**
 		 * Requires: nothing
@@ -222,15 +231,15 @@ class Board {
 		 * Effects: Fills the ports vector with PortPairs
 		 */
 		// provided the available tile types, returns a random one and removes it from the list of available ones
-	    tile_type get_random_tile_type(std::map<tile_type, int> &tile_types_remaining);
+	    static tile_type get_random_tile_type(std::map<tile_type, int> &tile_types_remaining, GameRandom &random);
 
 		/**
-		 * Requires: remaining production numbers
-		 * Modifies: remaining production numbers
+		 * Requires: remaining production numbers, random numbers
+		 * Modifies: remaining production numbers, random
 		 * Effects: returns a random number from production_numbers_remaining
 		 */
 		//provided the available production numbers, returns a random one and removes it from the list of available ones
-		int get_random_production_number(std::vector<int> &production_numbers_remaining);
+		static int get_random_production_number(std::vector<int> &production_numbers_remaining, GameRandom &random);
 
 		/* Getters */
 
@@ -246,14 +255,64 @@ class Board {
 		 * Modifies: nothing
 		 * Effects: returns board_plots
 		 */
-		std::set<std::shared_ptr<Plot>> get_board_plots() const;
+		const std::set<std::shared_ptr<Plot>>& get_board_plots() const;
 
 		/**
 		 * Requires: nothing
 		 * Modifies: nothing
 		 * Effects: returns board_paths
 		 */
-		std::set<std::shared_ptr<Path>> get_board_paths() const;
+		const std::set<std::shared_ptr<Path>>& get_board_paths() const;
+
+		/**
+		 * Requires: nothing
+		 * Modifies: nothing
+		 * Effects: returns the id based adjacency tables of the board
+		 */
+		const BoardGraph& get_graph() const;
+
+		/**
+		 * Requires: nothing
+		 * Modifies: nothing
+		 * Effects: returns the occupancy bitboards of the board
+		 */
+		const BoardBitboards& get_bitboards() const;
+
+		/**
+		 * Requires: nothing
+		 * Modifies: nothing
+		 * Effects: returns the board's layout, which makes the same board again
+		 */
+		BoardLayout get_layout() const;
+
+		/**
+		 * Requires: plot id
+		 * Modifies: nothing
+		 * Effects: returns the plot with the given id, if any
+		 */
+		std::shared_ptr<Plot> get_plot_by_id(const PlotId id) const;
+
+		/**
+		 * Requires: path id
+		 * Modifies: nothing
+		 * Effects: returns the path with the given id, if any
+		 */
+		std::shared_ptr<Path> get_path_by_id(const PathId id) const;
+
+		/**
+		 * Requires: tile id
+		 * Modifies: nothing
+		 * Effects: returns reference to the tile with the given id
+		 */
+		Tile& get_tile_by_id(const TileId id);
+		const Tile& get_tile_by_id(const TileId id) const;
+
+		/**
+		 * Requires: position_id string
+		 * Modifies: nothing
+		 * Effects: returns the id of the tile with the given ID string, or INVALID_ID
+		 */
+		TileId get_tile_id(const std::string &position_id) const;
 
 		/**
 		 * Requires: coordinate
@@ -318,6 +377,14 @@ class Board {
 		 */
 		bool can_place_road(const std::shared_ptr<Player> player) const;
 
+		/**
+		 * Requires: print_on_longest (optional)
+		 * Modifies: the length of road of players with roads on the board
+		 * Effects: passes every road owner's current longest road length to Player::set_length_of_road,
+		 * but only for players whose length changed
+		 */
+		void report_road_lengths(const bool print_on_longest = true) const;
+
 		// Will return the position coordinate of a tile given its position ID
 
 		/**
@@ -377,11 +444,12 @@ class Board {
 		bool has_tile(const std::string position_id) const;
 
 		/**
-		 * Requires: die roll result (production number)
-		 * Modifies: nothing
-		 * Effects: prompts all tiles with the given production number to generate resources.
+		 * Requires: die roll result (production number), print (optional)
+		 * Modifies: resources of the players who produce something
+		 * Effects: gives every player what the production table lists for the roll. If print, the gains
+		 * are printed and the board is displayed with the producing tiles highlighted
 		 */
-		void generate_resources(const int die_result) const;
+		void generate_resources(const int die_result, const bool print = true) const;
 
 		/**
 		 * Requires: nothing
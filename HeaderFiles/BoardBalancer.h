@@ -0,0 +1,94 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef BOARDBALANCER_H
+#define BOARDBALANCER_H
+
+#include <map>
+#include <vector>
+
+#include "Board.h"
+#include "Enums.h"
+
+class GameRandom;
+
+/*
+ * The BoardBalancer picks a fair board: it deals many random layouts from the same tiles and numbers a normal
+ * board uses, scores how unbalanced each one is, and keeps the best.
+ *
+ * A score adds up four penalties, each with its own weight:
+ *  - resource pips: how far each resource's pips are from its share, so ore isn't stuck on 2, 3 and 12
+ *  - red adjacency: pairs of 6s and 8s on neighbouring tiles
+ *  - plot pip variance: how uneven the pips of the intersections are, so there aren't a few spots worth
+ *    far more than the rest
+ *  - port coupling: pips of a 2:1 port's own resource on the tiles next to it, which make it too strong
+ * Lower is better, and 0 is as fair as a board can be.
+ *
+ * Candidates are dealt and scored on every core at once until the time budget or the candidate limit runs
+ * out. Candidate i is always dealt from the same numbers, and ties go to the lowest i, so with only a
+ * candidate limit the same seed gives the same board on any number of threads.
+ */
+
+struct BalanceWeights {
+    double resource_pips = 1.0;
+    double red_adjacency = 10.0;
+    double plot_pip_variance = 1.0;
+    double port_coupling = 1.0;
+};
+
+struct BalanceOptions {
+    // Time to look for a board, in milliseconds, 0 for no limit
+    int time_ms = 50;
+    // Threads dealing candidates, 0 for one per core
+    int threads = 0;
+    // Stops after this many candidates, 0 for no limit. Only one candidate is dealt if there is no limit at all
+    int max_candidates = 0;
+    BalanceWeights weights;
+};
+
+struct BalanceScore {
+    // Each penalty before it is weighted
+    double resource_pips = 0;
+    double red_adjacency = 0;
+    double plot_pip_variance = 0;
+    double port_coupling = 0;
+    // The weighted sum of the penalties
+    double total = 0;
+};
+
+struct BalanceResult {
+    BoardLayout layout;
+    BalanceScore score;
+    // How many candidates were scored
+    int candidates = 0;
+};
+
+class BoardBalancer {
+
+    public:
+
+        /**
+        * Requires: production number, or -1 for the desert
+        * Modifies: nothing
+        * Effects: returns how many of the 36 dice rolls roll the number
+        */
+        static int get_pips(const int number);
+
+        /**
+        * Requires: layout, weights
+        * Modifies: nothing
+        * Effects: returns each penalty of the layout and their weighted total
+        */
+        static BalanceScore score(const BoardLayout &layout, const BalanceWeights &weights);
+
+        /**
+        * Requires: tile types and production numbers to deal, options, random numbers
+        * Modifies: random
+        * Effects: deals candidate layouts as Board::get_random_layout does and returns the best scoring one
+        */
+        static BalanceResult generate(const std::map<tile_type, int> &tile_types, const std::vector<int> &production_numbers,
+            const BalanceOptions &options, GameRandom &random);
+};
+
+#endif //BOARDBALANCER_H
@@ -0,0 +1,324 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef BOARDBITBOARDS_H
+#define BOARDBITBOARDS_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "BoardGraph.h"
+#include "Enums.h"
+
+/*
+ * The BoardBitboards class tracks what is built on the board as bit masks, one bit per plot or path id.
+ *
+ * The standard board has 54 plots and 72 paths, so every set of plots fits in one 64 bit PlotMask and every
+ * set of paths fits in a 128 bit PathMask. Each player has a mask of their settlements, cities and roads,
+ * and there are global occupancy masks. Neighbour masks are precomputed from the BoardGraph, so placement
+ * rules like "not next to a building" or "next to one of my roads" are a couple of AND/OR operations.
+ *
+ * Plots and paths keep their board's bitboards up to date whenever something is built on them.
+ */
+
+typedef std::uint64_t PlotMask;
+
+/**
+* Requires: mask
+* Modifies: nothing
+* Effects: returns the number of set bits in the mask
+*/
+inline int count_bits(std::uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(mask);
+#else
+    int count = 0;
+    while (mask != 0) {
+        mask &= mask - 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/**
+* Requires: non-zero mask
+* Modifies: nothing
+* Effects: returns the index of the lowest set bit in the mask
+*/
+inline int lowest_bit(std::uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(mask);
+#else
+    int index = 0;
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+// Set of the ports a player can trade through. Bit t is a 2:1 port for tile_type t, UNIVERSAL_PORT is a 3:1 port
+typedef std::uint8_t PortMask;
+const PortMask UNIVERSAL_PORT = PortMask(1) << TILE_EMPTY;
+
+/**
+* Requires: resource type
+* Modifies: nothing
+* Effects: returns the port mask bit of the resource's 2:1 port
+*/
+inline PortMask port_bit(const tile_type type) {
+    return PortMask(1) << type;
+}
+
+// 128 bit set of path ids. Bits 0-63 are in low, 64-127 are in high
+struct PathMask {
+    std::uint64_t low = 0;
+    std::uint64_t high = 0;
+
+    PathMask() = default;
+    PathMask(const std::uint64_t _low, const std::uint64_t _high) : low(_low), high(_high) {}
+
+    static PathMask bit(const PathId path) {
+        return path < 64 ? PathMask(std::uint64_t(1) << path, 0) : PathMask(0, std::uint64_t(1) << (path - 64));
+    }
+
+    bool test(const PathId path) const {
+        return path < 64 ? (low >> path) & 1 : (high >> (path - 64)) & 1;
+    }
+    bool any() const { return (low | high) != 0; }
+    int count() const { return count_bits(low) + count_bits(high); }
+    // Lowest path id in the mask. The mask must not be empty
+    PathId first() const { return low != 0 ? lowest_bit(low) : 64 + lowest_bit(high); }
+
+    PathMask operator&(const PathMask &other) const { return {low & other.low, high & other.high}; }
+    PathMask operator|(const PathMask &other) const { return {low | other.low, high | other.high}; }
+    PathMask operator^(const PathMask &other) const { return {low ^ other.low, high ^ other.high}; }
+    PathMask operator~() const { return {~low, ~high}; }
+    PathMask& operator&=(const PathMask &other) { low &= other.low; high &= other.high; return *this; }
+    PathMask& operator|=(const PathMask &other) { low |= other.low; high |= other.high; return *this; }
+    PathMask& operator^=(const PathMask &other) { low ^= other.low; high ^= other.high; return *this; }
+    bool operator==(const PathMask &other) const { return low == other.low && high == other.high; }
+    bool operator!=(const PathMask &other) const { return !(*this == other); }
+};
+
+class LongestRoadEngine;
+class ProductionTable;
+
+class BoardBitboards {
+
+    public:
+        // Number of player colors that can own things on the board (COLOR_EMPTY is not one of them)
+        static const int COLOR_COUNT = 4;
+        static const int MAX_PLOTS = 64;
+        static const int MAX_PATHS = 128;
+
+    private:
+        // Precomputed neighbour masks, indexed by id
+        std::vector<PlotMask> plot_neighbour_plots;
+        std::vector<PathMask> plot_incident_paths;
+        std::vector<PlotMask> path_endpoint_plots;
+        std::vector<PathMask> path_neighbour_paths;
+        // The port on each plot, if any
+        std::vector<PortMask> plot_ports;
+
+        // Every plot / path on the board
+        PlotMask all_plots = 0;
+        PathMask all_paths;
+
+        // What each player has built
+        std::array<PlotMask, COLOR_COUNT> settlements{};
+        std::array<PlotMask, COLOR_COUNT> cities{};
+        std::array<PathMask, COLOR_COUNT> roads{};
+
+        // Paths touching one of the player's roads, including the roads themselves
+        std::array<PathMask, COLOR_COUNT> road_frontier{};
+        // Plots at either end of one of the player's roads
+        std::array<PlotMask, COLOR_COUNT> road_plots{};
+        // Ports the player has a building on
+        std::array<PortMask, COLOR_COUNT> port_access{};
+
+        // Global occupancy. blocked_plots is every occupied plot plus every plot next to one
+        PlotMask occupied_plots = 0;
+        PlotMask blocked_plots = 0;
+        PathMask occupied_paths;
+
+        // Kept up to date with every road and building placed
+        std::shared_ptr<LongestRoadEngine> road_engine;
+        // Kept up to date with every building placed
+        std::shared_ptr<ProductionTable> production;
+
+        // Zobrist hash of the buildings, roads and robber
+        std::uint64_t hash = 0;
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns if the color owns things on the board (it isn't COLOR_EMPTY)
+        */
+        static bool is_player_color(const player_color color);
+
+    public:
+
+        /**
+        * Requires: board graph with at most 64 plots and 128 paths
+        * Modifies: neighbour masks
+        * Effects: Constructor for BoardBitboards. Precomputes the neighbour masks from the graph. Nothing is built yet
+        */
+        explicit BoardBitboards(const BoardGraph &graph);
+
+        /* Updates */
+
+        /**
+        * Requires: plot id, port type (TILE_EMPTY for none), is universal port
+        * Modifies: plot_ports
+        * Effects: records the port on the plot. Done once when the board is created, before anything is built
+        */
+        void set_plot_port(const PlotId plot, const tile_type port_type, const bool universal_port);
+
+        /**
+        * Requires: plot id, owner color, building type
+        * Modifies: settlements, cities, occupied_plots, blocked_plots, port_access, road_engine, production, hash
+        * Effects: records a building of the color on the plot, replacing whatever was recorded there before.
+        * Road lengths broken by the building are measured again
+        */
+        void place_building(const PlotId plot, const player_color color, const building_type type);
+
+        /**
+        * Requires: path id, owner color
+        * Modifies: roads, road_frontier, road_plots, occupied_paths, road_engine, hash
+        * Effects: records a road of the color on the path and updates the color's road length
+        */
+        void place_road(const PathId path, const player_color color);
+
+        /**
+        * Requires: tile id
+        * Modifies: production, hash
+        * Effects: records the robber moving onto the tile
+        */
+        void move_robber(const TileId tile);
+
+        /* Getters */
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns the mask of the player's settlements, cities, both, or roads respectively
+        */
+        PlotMask get_settlements(const player_color color) const;
+        PlotMask get_cities(const player_color color) const;
+        PlotMask get_buildings(const player_color color) const;
+        PathMask get_roads(const player_color color) const;
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns the mask of ports the player has a building on
+        */
+        PortMask get_port_access(const player_color color) const;
+
+        /**
+        * Requires: plot id
+        * Modifies: nothing
+        * Effects: returns the port the plot is on, as a PortMask with at most one bit set
+        */
+        PortMask get_plot_port(const PlotId plot) const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the Zobrist hash of everything on the board (see Zobrist.h)
+        */
+        std::uint64_t get_hash() const;
+
+        /**
+        * Requires: color, resource
+        * Modifies: nothing
+        * Effects: returns how many of the resource the player pays the bank for 1 resource
+        * (2 with a matching port, 3 with a universal port, 4 otherwise)
+        */
+        int get_trade_rate(const player_color color, const tile_type resource) const;
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns the length of the color's longest road
+        */
+        int get_road_length(const player_color color) const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the engine tracking every player's longest road
+        */
+        const LongestRoadEngine& get_road_engine() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the table of what each roll produces. The board sets up its tiles and robber through it
+        */
+        ProductionTable& get_production_table();
+        const ProductionTable& get_production_table() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the mask of every occupied plot or path respectively
+        */
+        PlotMask get_occupied_plots() const;
+        PathMask get_occupied_paths() const;
+
+        /**
+        * Requires: valid id
+        * Modifies: nothing
+        * Effects: returns the precomputed neighbour masks
+        */
+        PlotMask get_plot_neighbours(const PlotId plot) const;
+        PathMask get_plot_paths(const PlotId plot) const;
+        PlotMask get_path_plots(const PathId path) const;
+        PathMask get_path_neighbours(const PathId path) const;
+
+        /* Placement rules */
+
+        /**
+        * Requires: plot id
+        * Modifies: nothing
+        * Effects: returns if any plot next to the plot has a building
+        */
+        bool next_to_building(const PlotId plot) const;
+
+        /**
+        * Requires: path id, color
+        * Modifies: nothing
+        * Effects: returns if any path next to the path has a road of the color
+        */
+        bool has_adjacent_road(const PathId path, const player_color color) const;
+
+        /**
+        * Requires: color, whether the plot must touch one of the player's roads
+        * Modifies: nothing
+        * Effects: returns the mask of plots the player could put a settlement on
+        */
+        PlotMask get_buildable_plots(const player_color color, const bool require_adjacent_road) const;
+
+        /**
+        * Requires: color, whether the path must touch one of the player's roads
+        * Modifies: nothing
+        * Effects: returns the mask of paths the player could put a road on
+        */
+        PathMask get_buildable_paths(const player_color color, const bool require_adjacent_road) const;
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns if the player has anywhere to put a road next to one of their roads
+        */
+        bool can_place_road(const player_color color) const;
+};
+
+#endif //BOARDBITBOARDS_H
@@ -0,0 +1,156 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef BOARDGRAPH_H
+#define BOARDGRAPH_H
+
+#include <array>
+#include <vector>
+
+/*
+ * The BoardGraph class stores the board's topology as dense integer ids instead of pointers.
+ * Plots, paths and tiles are numbered 0..n-1 in the order the board creates them, and every
+ * relation between them (plot -> plots, plot -> paths, path -> paths, tile -> plots/paths, ...)
+ * is kept in a fixed width row of ids, padded with INVALID_ID where a slot is unused.
+ *
+ * The tables are filled once when the board is created, so every lookup afterwards is just an index.
+ */
+
+typedef int PlotId;
+typedef int PathId;
+typedef int TileId;
+
+const int INVALID_ID = -1;
+
+class BoardGraph {
+
+    public:
+        // A plot touches at most 3 plots, 3 paths and 3 tiles
+        static const int PLOT_DEGREE = 3;
+        // A path touches at most 4 other paths
+        static const int PATH_DEGREE = 4;
+        // A tile is surrounded by 6 plots and 6 paths
+        static const int TILE_DEGREE = 6;
+
+    private:
+        std::vector<std::array<PlotId, PLOT_DEGREE>> plot_plots;
+        std::vector<std::array<PathId, PLOT_DEGREE>> plot_paths;
+        std::vector<std::array<TileId, PLOT_DEGREE>> plot_tiles;
+
+        std::vector<std::array<PlotId, 2>> path_plots;
+        std::vector<std::array<PathId, PATH_DEGREE>> path_paths;
+
+        std::vector<std::array<PlotId, TILE_DEGREE>> tile_plots;
+        std::vector<std::array<PathId, TILE_DEGREE>> tile_paths;
+
+        /**
+        * Requires: row of ids, id
+        * Modifies: row
+        * Effects: puts the id in the first free slot of the row, unless it is already there
+        */
+        template <std::size_t N>
+        static void add_to_row(std::array<int, N> &row, const int id);
+
+    public:
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: Constructor for BoardGraph. Creates an empty graph
+        */
+        BoardGraph();
+
+        /* Building the graph */
+
+        /**
+        * Requires: nothing
+        * Modifies: plot tables
+        * Effects: adds a plot with no relations and returns its id
+        */
+        PlotId add_plot();
+
+        /**
+        * Requires: two valid plot ids
+        * Modifies: path tables, plot_paths
+        * Effects: adds a path between the two plots and returns its id
+        */
+        PathId add_path(const PlotId plot_a, const PlotId plot_b);
+
+        /**
+        * Requires: nothing
+        * Modifies: tile tables
+        * Effects: adds a tile with no relations and returns its id
+        */
+        TileId add_tile();
+
+        /**
+        * Requires: plot id, slot (0-2), adjacent plot id
+        * Modifies: plot_plots
+        * Effects: stores the adjacent plot in the given slot of the plot
+        */
+        void set_adjacent_plot(const PlotId plot, const int slot, const PlotId adjacent);
+
+        /**
+        * Requires: tile id, slot (0-5), plot id
+        * Modifies: tile_plots, plot_tiles
+        * Effects: links the tile and the plot in both directions
+        */
+        void link_tile_plot(const TileId tile, const int slot, const PlotId plot);
+
+        /**
+        * Requires: tile id, slot (0-5), path id
+        * Modifies: tile_paths
+        * Effects: stores the path in the given slot of the tile
+        */
+        void link_tile_path(const TileId tile, const int slot, const PathId path);
+
+        /**
+        * Requires: nothing
+        * Modifies: path_paths
+        * Effects: fills path -> path adjacency from the plot -> path incidence. Called once every path exists
+        */
+        void build_path_adjacency();
+
+        /* Getters */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the number of plots, paths, or tiles respectively
+        */
+        int get_plot_count() const;
+        int get_path_count() const;
+        int get_tile_count() const;
+
+        /**
+        * Requires: valid ids
+        * Modifies: nothing
+        * Effects: returns the row of related ids, padded with INVALID_ID
+        */
+        const std::array<PlotId, PLOT_DEGREE>& get_adjacent_plots(const PlotId plot) const;
+        const std::array<PathId, PLOT_DEGREE>& get_plot_paths(const PlotId plot) const;
+        const std::array<TileId, PLOT_DEGREE>& get_plot_tiles(const PlotId plot) const;
+        const std::array<PlotId, 2>& get_path_plots(const PathId path) const;
+        const std::array<PathId, PATH_DEGREE>& get_adjacent_paths(const PathId path) const;
+        const std::array<PlotId, TILE_DEGREE>& get_tile_plots(const TileId tile) const;
+        const std::array<PathId, TILE_DEGREE>& get_tile_paths(const TileId tile) const;
+
+        /**
+        * Requires: two plot ids
+        * Modifies: nothing
+        * Effects: returns the id of the path between the two plots, or INVALID_ID if there isn't one
+        */
+        PathId find_path(const PlotId plot_a, const PlotId plot_b) const;
+
+        /**
+        * Requires: id
+        * Modifies: nothing
+        * Effects: returns if the id is a valid plot, path, or tile id respectively
+        */
+        bool is_plot(const PlotId plot) const;
+        bool is_path(const PathId path) const;
+        bool is_tile(const TileId tile) const;
+};
+
+#endif //BOARDGRAPH_H
@@ -0,0 +1,169 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef BOARDRENDERER_H
+#define BOARDRENDERER_H
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "BoardBitboards.h"
+#include "StandardBoard.h"
+
+class Board;
+
+/*
+ * The BoardRenderer keeps the drawing of a board as a grid of characters, each with a style (the ANSI
+ * codes it is printed with), so the board doesn't have to be laid out again every time it is shown.
+ *
+ * Where every plot, path and tile row goes in the grid is worked out once, when the renderer is made.
+ * update compares the board with how it was at the last update (each player's buildings and roads, the icon
+ * overrides, the robber, the highlighted tiles and if tile ids are shown) and repaints only the cells of the
+ * plots, paths and tiles that changed.
+ *
+ * draw prints the whole grid, one line per row. draw_changes prints only the cells that changed since the
+ * terminal was last sent them, each run of them after an ANSI code moving the cursor there, for a board that
+ * stays in one place on the screen. That is a few dozen bytes for a placement instead of the whole board.
+ */
+
+struct RenderCell {
+    char glyph = ' ';
+    // Index into the renderer's styles, 0 for plain text
+    std::uint8_t style = 0;
+
+    bool operator==(const RenderCell &other) const { return glyph == other.glyph && style == other.style; }
+    bool operator!=(const RenderCell &other) const { return !(*this == other); }
+};
+
+class BoardRenderer {
+
+    public:
+        static const int ROWS = 21;
+
+    private:
+        // Where an icon goes in the grid and how many characters it has there
+        struct Slot {
+            int row = -1;
+            int column = 0;
+            int width = 0;
+        };
+
+        std::vector<std::vector<RenderCell>> grid;
+        // What the terminal was last sent of each row, compared with the grid by draw_changes
+        std::vector<std::vector<RenderCell>> shown;
+        // Bit i is set if row i of the grid has changed since the terminal was last sent it
+        std::uint32_t dirty_rows = 0;
+
+        // The ANSI codes of each style. Style 0 is plain text
+        std::vector<std::string> styles;
+
+        std::array<Slot, StandardBoard::PLOT_COUNT> plot_slots{};
+        std::array<Slot, StandardBoard::PATH_COUNT> path_slots{};
+        std::array<Slot, StandardBoard::TILE_COUNT> tile_top_slots{};
+        std::array<Slot, StandardBoard::TILE_COUNT> tile_main_slots{};
+        std::array<Slot, StandardBoard::TILE_COUNT> tile_robber_slots{};
+
+        // The board as it was at the last update
+        bool updated = false;
+        std::array<PlotMask, BoardBitboards::COLOR_COUNT> settlements{};
+        std::array<PlotMask, BoardBitboards::COLOR_COUNT> cities{};
+        std::array<PathMask, BoardBitboards::COLOR_COUNT> roads{};
+        std::array<std::string, StandardBoard::PLOT_COUNT> plot_overrides;
+        std::array<std::string, StandardBoard::PATH_COUNT> path_overrides;
+        std::uint32_t robber_tiles = 0;
+        std::uint32_t lowlit_tiles = 0;
+        bool tile_ids_shown = false;
+
+        /**
+        * Requires: board
+        * Modifies: grid, shown, every slot
+        * Effects: works out where every plot, path and tile row goes, and writes the spacing between them
+        */
+        void lay_out(const Board &board);
+
+        /**
+        * Requires: slot, text which may have ANSI codes in it
+        * Modifies: grid, styles, dirty_rows
+        * Effects: writes the text's characters into the slot, with the styles its codes give them, padded
+        * with spaces or cut to the slot's width
+        */
+        void paint(const Slot &slot, const std::string &text);
+
+        /**
+        * Requires: ANSI codes
+        * Modifies: styles
+        * Effects: returns the index of the style with the codes, adding it if it is new
+        */
+        std::uint8_t get_style(const std::string &codes);
+
+        /**
+        * Requires: row, first and last column, output stream
+        * Modifies: the stream
+        * Effects: writes the cells, starting and ending in plain text
+        */
+        void write_cells(const int row, const int first, const int last, std::ostream &out) const;
+
+    public:
+
+        /**
+        * Requires: board
+        * Modifies: grid, every slot
+        * Effects: Constructor for BoardRenderer, lays out the board. Nothing is painted until update
+        */
+        explicit BoardRenderer(const Board &board);
+
+        /**
+        * Requires: board the renderer was made from, whether to show tile ids, ids of the tiles to highlight
+        * Modifies: grid, dirty_rows, the board as it was at the last update
+        * Effects: repaints the plots, paths and tiles that changed since the last update. If any tiles are
+        * highlighted, the rest are greyed out
+        */
+        void update(
+            const Board &board,
+            const bool show_tile_position_ids = false,
+            const std::vector<std::string> &highlighted_tiles = {});
+
+        /**
+        * Requires: output stream
+        * Modifies: the stream, shown, dirty_rows
+        * Effects: writes every row of the grid, each on its own line
+        */
+        void draw(std::ostream &out);
+
+        /**
+        * Requires: output stream, terminal row of the grid's first row (the top of the screen is 1)
+        * Modifies: the stream, shown, dirty_rows
+        * Effects: writes the cells that changed since the terminal was last sent them, moving the cursor to
+        * each run of them. The cursor is saved first and put back after
+        */
+        void draw_changes(std::ostream &out, const int first_row);
+
+        /**
+        * Requires: nothing
+        * Modifies: shown, dirty_rows
+        * Effects: forgets what the terminal was sent, so the next draw_changes sends every cell
+        */
+        void forget_shown();
+
+        /* Getters */
+
+        /**
+        * Requires: row
+        * Modifies: nothing
+        * Effects: returns the row's characters, without their styles
+        */
+        std::string get_row_text(const int row) const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns if any cell has changed since the terminal was last sent it
+        */
+        bool has_changes() const;
+};
+
+#endif //BOARDRENDERER_H
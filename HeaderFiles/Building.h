@@ -78,7 +78,7 @@ class Building : public Construct {
 		 * Modifies: nothing
 		 * Effects: Returns recipe which is different based on building type
 		 */
-		std::map<tile_type, int> get_recipe() const override;
+		ResourceVector get_recipe() const override;
 
 		/**
 		 * Requires: nothing
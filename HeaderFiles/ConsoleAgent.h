@@ -0,0 +1,49 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef CONSOLEAGENT_H
+#define CONSOLEAGENT_H
+
+#include "Agent.h"
+
+/*
+ * The ConsoleAgent asks a person at the terminal, through the prompts in InputFunctions.
+ *
+ * Trades with other players are worked out in the trade prompt between the people at the terminal, and
+ * happen right away. Everything else is returned to the engine, which checks and applies it.
+ */
+
+class ConsoleAgent : public Agent {
+
+    public:
+
+        PlotId choose_initial_settlement(Board &board, const std::shared_ptr<Player> &player) override;
+
+        PathId choose_initial_road(Board &board, const std::shared_ptr<Player> &player, const PlotId settlement) override;
+
+        /**
+        * Requires: board, player, legal actions
+        * Modifies: nothing
+        * Effects: shows the [Pass] [Trade] [Craft] [Devcard] [Info] menu until the player chooses an action
+        */
+        Action choose_action(Board &board, const std::shared_ptr<Player> &player, const ActionList &legal_actions) override;
+
+        PathId choose_free_road(Board &board, const std::shared_ptr<Player> &player) override;
+
+        ResourceVector choose_discard(
+            Board &board, const std::shared_ptr<Player> &player, const int number_of_resources) override;
+
+        TileId choose_robber_tile(Board &board, const std::shared_ptr<Player> &player) override;
+
+        player_color choose_steal_target(
+            Board &board, const std::shared_ptr<Player> &player, const std::vector<player_color> &targets) override;
+
+        tile_type choose_resource(Board &board, const std::shared_ptr<Player> &player, const devcard_type reason) override;
+
+        bool respond_to_trade(
+            Board &board, const std::shared_ptr<Player> &player, const std::shared_ptr<Player> &proposer,
+            const ResourceVector &payment, const ResourceVector &gain) override;
+};
+
+#endif //CONSOLEAGENT_H
@@ -7,7 +7,6 @@
 
 #include <memory>
 #include <string>
-#include <map>
 #include "Craftable.h"
 #include "Player.h"
 #include "Enums.h"
@@ -37,7 +36,7 @@ class Construct : public Craftable {
 		 * Modifies: owner, color
 		 * Effects: Constructor for Construct, sets color and owner
 		 */
-        Construct(std::shared_ptr<Player> _owner, std::map<tile_type, int> _recipe);
+        Construct(std::shared_ptr<Player> _owner, ResourceVector _recipe);
 		/**
 		 * Requires: owner
 		 * Modifies: owner, color
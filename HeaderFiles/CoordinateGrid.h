@@ -0,0 +1,77 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef COORDINATEGRID_H
+#define COORDINATEGRID_H
+
+#include <vector>
+
+#include "OrderedPair.h"
+#include "BoardGraph.h"
+
+/*
+ * The CoordinateGrid class maps board coordinates straight to entity ids (PlotId, PathId or TileId).
+ * It is a dense 2D array covering the bounding box of every coordinate stored so far, so a lookup is a
+ * bounds check and one index no matter how many tiles the board has. The box grows when a coordinate
+ * outside of it is stored, which only happens while the board is being created.
+ */
+
+class CoordinateGrid {
+
+    private:
+        // Bounding box of the grid. cells is row major, width * height long
+        int min_x = 0;
+        int min_y = 0;
+        int width = 0;
+        int height = 0;
+        std::vector<int> cells;
+
+        /**
+        * Requires: coordinate
+        * Modifies: min_x, min_y, width, height, cells
+        * Effects: grows the bounding box so it contains the coordinate, keeping the stored ids
+        */
+        void expand_to(const OrderedPair &position);
+
+    public:
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: Constructor for CoordinateGrid. Creates an empty grid
+        */
+        CoordinateGrid();
+
+        /**
+        * Requires: coordinate, id
+        * Modifies: cells
+        * Effects: stores the id at the coordinate, growing the grid if needed
+        */
+        void set(const OrderedPair &position, const int id);
+
+        /**
+        * Requires: coordinate
+        * Modifies: nothing
+        * Effects: returns the id stored at the coordinate, or INVALID_ID if there isn't one
+        */
+        int get(const OrderedPair &position) const;
+
+        /**
+        * Requires: coordinate
+        * Modifies: nothing
+        * Effects: returns if an id is stored at the coordinate
+        */
+        bool contains(const OrderedPair &position) const;
+
+        /**
+        * Requires: two plot coordinates
+        * Modifies: nothing
+        * Effects: packs the two endpoints of a path into one coordinate key. The key is the sum of the
+        *          endpoints, which is the same no matter the order they are given in. Neighbouring plots
+        *          are always (0, 1) or (2, 0) apart, so no two paths on the board share a key
+        */
+        static OrderedPair edge_key(const OrderedPair &endpoint_a, const OrderedPair &endpoint_b);
+};
+
+#endif //COORDINATEGRID_H
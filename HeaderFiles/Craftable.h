@@ -5,9 +5,9 @@
 #ifndef CRAFTABLE_H
 #define CRAFTABLE_H
 
-#include <map>
 #include <string>
 #include "Enums.h"
+#include "ResourceVector.h"
 
 /*
 *
@@ -24,15 +24,21 @@
 class Craftable{
 
     private:
-        std::map<tile_type, int> recipe;
+        ResourceVector recipe;
 
 	public:
+		// The costs above, for checking and paying without building a Craftable
+		static constexpr ResourceVector SETTLEMENT_RECIPE = {{GRAIN, 1}, {WOOL, 1}, {BRICK, 1}, {LUMBER, 1}};
+		static constexpr ResourceVector CITY_RECIPE = {{GRAIN, 2}, {ORE, 3}};
+		static constexpr ResourceVector ROAD_RECIPE = {{BRICK, 1}, {LUMBER, 1}};
+		static constexpr ResourceVector DEVCARD_RECIPE = {{GRAIN, 1}, {WOOL, 1}, {ORE, 1}};
+
 		/**
 		 * Requires: recipe
 		 * Modifies: recipe
 		 * Effects: Constructor for Craftable, sets recipe
 		 */
-		Craftable(std::map<tile_type, int> _recipe);
+		Craftable(ResourceVector _recipe);
 
 		/**
 		 * Requires: nothing
@@ -46,21 +52,21 @@ class Craftable{
 		 * Modifies: nothing
 		 * Effects: returns the recipe of the given item
 		 */
-		static std::map<tile_type, int> get_recipe(std::string craftable_thing);
+		static ResourceVector get_recipe(std::string craftable_thing);
 
 		/**
 		 * Requires: nothing
 		 * Modifies: nothing
 		 * Effects: returns the recipe of the current craftable
 		 */
-		virtual std::map<tile_type, int> get_recipe() const;
+		virtual ResourceVector get_recipe() const;
 
 		/**
 		 * Requires: recipe
 		 * Modifies: recipe
 		 * Effects: sets the recipe to the provided recipe
 		 */
-		void set_recipe(std::map<tile_type, int> _recipe);
+		void set_recipe(ResourceVector _recipe);
 };
 
 #endif //CRAFTABLE_H
@@ -29,28 +29,6 @@ tile_type resource_choice_prompt(
     const std::vector<tile_type> &exclusions = {},
     const std::string main_message_override = "");
 
-/** FORWARD DEFINITION
-* Requires: board, player, requires_adjacent_road, can_quit, spend_resources
-* Modifies: nothing
-* Effects: prompts the player to place a road
-*/
-void place_road(
-    Board &board,
-    const std::shared_ptr<Player> &player,
-    const bool requires_adjacent_road = true,
-    const bool can_quit = true,
-    const bool spend_resources = true);
-
-/** FORWARD DEFINITION
-* Requires: board, player, steal_resource
-* Modifies: nothing
-* Effects: prompts user to move the robber to chosen tile
-*/
-void robber_movement_prompt(
-    const Board &board,
-    std::shared_ptr<Player> &player,
-    const bool steal_resource);
-
 class DevCard : public Craftable {
     private:
         devcard_type type;
@@ -73,13 +51,6 @@ class DevCard : public Craftable {
          */
         DevCard();
 
-        /**
-         * Requires: board, player
-         * Modifies: depends on effect...
-         * Effects: performs card effect based on type.
-         */
-        void play(Board &board, std::shared_ptr<Player> player);
-
         /**
          * Requires: board, player
          * Modifies: nothing
@@ -120,7 +91,7 @@ class DevCard : public Craftable {
          * Modifies: nothing
          * Effects: returns recipe
          */
-        std::map<tile_type, int> get_recipe() const override;
+        ResourceVector get_recipe() const override;
 
         /** STATIC
          * Requires: type
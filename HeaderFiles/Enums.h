@@ -19,6 +19,9 @@ enum devcard_type {KNIGHT, ROAD_BUILDING, YEAR_OF_PLENTY, MONOPOLY, VICTORY_POIN
 // The types that a tile can be and the types of resources that exist
 enum tile_type{DESERT, GRAIN, WOOL, BRICK, ORE, LUMBER, TILE_EMPTY};
 
+// Things a player can do on their turn
+enum action_type{PASS_TURN, BUILD_SETTLEMENT, BUILD_CITY, BUILD_ROAD, BUY_DEVCARD, PLAY_DEVCARD, MARITIME_TRADE};
+
 /**
 * Requires: color
 * Modifies: nothing
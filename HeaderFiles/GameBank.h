@@ -5,62 +5,67 @@
 #ifndef GAMEBANK_H
 #define GAMEBANK_H
 
+#include <array>
+#include <cstdint>
 #include <map>
 #include <vector>
-#include <memory>
 #include "Enums.h"
-#include "Player.h"
-
-/** FORWARD DEFINITION
-* Requires: nothing
-* Modifies: nothing
-* Effects: returns number of players chosen by player
-*/
-int player_count_prompt();
+#include "ResourceVector.h"
 
 class DevCard;
+class GameRandom;
+
+/*
+ * The GameBank is a game's supply: the resource piles and the deck of devcards. Each game's GameContext has
+ * its own.
+ */
 
 class GameBank {
 	private:
-    	std::map<tile_type, int> available_resources;
+    	ResourceVector available_resources;
         const std::map<devcard_type, int> base_devcards;
         std::vector<devcard_type> available_devcards;
 
-		std::map<int, std::shared_ptr<Player>> players;
-		int player_count = 0;
+		// How many of each resource have left and come back to the piles
+		std::array<int, TILE_EMPTY> resources_drawn{};
+		std::array<int, TILE_EMPTY> resources_returned{};
+
+		static constexpr int MAX_RESOURCE_COUNT = 19;
 
-		const int MAX_RESOURCE_COUNT = 19;
+		// Zobrist hash of the number of each devcard left in the deck
+		std::uint64_t deck_hash = 0;
 
 		/**
-		 * Requires: player_count (optional)
-		 * Modifies: player_count, base_devcards, available_resources
-		 * Effects: Constructor for GameBank, sets player_count and card decks to default decks
+		 * Requires: devcard type, change to its count
+		 * Modifies: deck_hash
+		 * Effects: updates deck_hash for a card of the type which is about to be added to (change = 1) or
+		 * taken from (change = -1) the deck
 		 */
-		GameBank(const int _player_count = 0);
+		void hash_deck_change(const devcard_type type, const int change);
 
     public:
 
 		/**
-		 * Requires: player_count_override (optional)
-		 * Modifies: internal static gamebank object
-		 * Effects: Creates a gamebank static to this function. There can only be one gamebank.
-		 * This returns that static gamebank if it is already a thing.
+		 * Requires: nothing
+		 * Modifies: base_devcards, available_resources, available_devcards
+		 * Effects: Constructor for GameBank, sets the piles and deck to full default decks
 		 */
-		static GameBank& instance(const int player_count_override = 0);
+		GameBank();
 
 		/**
-		 * Requires: nothing
-		 * Modifies: internal static gamebank object
-		 * Effects: Resets gamebank for testing.
+		 * Requires: random numbers to shuffle with
+		 * Modifies: available_devcards, random
+		 * Effects: Returns a random devcard from the deck and removes it
 		 */
-		static void reset();
+        DevCard draw_devcard(GameRandom &random);
 
 		/**
-		 * Requires: nothing
+		 * Requires: devcard type
 		 * Modifies: available_devcards
-		 * Effects: Returns a random devcard from the deck and removes it
+		 * Effects: removes a devcard of the type from the deck and returns it, or an empty card if the deck has
+		 * none. Used to replay a draw which is already known
 		 */
-        DevCard draw_devcard();
+        DevCard take_devcard(const devcard_type type);
 
 		/**
 		 * Requires: nothing
@@ -91,81 +96,61 @@ class GameBank {
         void draw_resource(const tile_type _type);
 
 		/**
-		 * Requires: type
-		 * Modifies: nothing
-		 * Effects: returns if there are any resources of the given type left
-		 */
-        bool has_resource(const tile_type _type) const;
-
-		/**
-		 * Requires: type
-		 * Modifies: nothing
-		 * Effects: Returns if any resources of the given type exist
-		 */
-        bool resource_exists(const tile_type _type) const;
-
-		/**
-		 * Requires: nothing
-		 * Modifies: nothing
-		 * Effects: returns players
+		 * Requires: resources
+		 * Modifies: available_resources
+		 * Effects: puts the resources back into the piles, none of which go over the number they started with
 		 */
-		std::map<int, std::shared_ptr<Player>> get_players() const;
+        void return_resources(const ResourceVector &resources);
 
 		/**
-		 * Requires: color string
-		 * Modifies: nothing
-		 * Effects: returns player with color from given string
+		 * Requires: resources, no more of any than the piles have
+		 * Modifies: available_resources
+		 * Effects: removes the resources from the piles
 		 */
-		std::shared_ptr<Player> get_player(std::string color) const;
+        void draw_resources(const ResourceVector &resources);
 
 		/**
-		 * Requires: color
+		 * Requires: type
 		 * Modifies: nothing
-		 * Effects: returns player with given color
+		 * Effects: returns if there are any resources of the given type left
 		 */
-		std::shared_ptr<Player> get_player(const player_color color) const;
+        bool has_resource(const tile_type _type) const;
 
 		/**
-		 * Requires: index
+		 * Requires: type
 		 * Modifies: nothing
-		 * Effects: returns player with given index
+		 * Effects: Returns if any resources of the given type exist
 		 */
-		std::shared_ptr<Player> get_player(const int player_index) const;
+        bool resource_exists(const tile_type _type) const;
 
 		/**
 		 * Requires: nothing
 		 * Modifies: nothing
-		 * Effects: returns player with longest road
+		 * Effects: returns remaining available resources
 		 */
-		std::shared_ptr<Player> get_longest_road_player() const;
+		const ResourceVector& get_available_resources() const;
 
 		/**
 		 * Requires: nothing
 		 * Modifies: nothing
-		 * Effects: returns player with largest army
-		 */
-		std::shared_ptr<Player> get_largest_army_player() const;
-
-		/**
-		 * Requires: players, player_count, whether it should print
-		 * Modifies: players
-		 * Effects: creates players and puts them in map
+		 * Effects: returns how many of each resource were taken from or put back in the piles, indexed by tile_type
 		 */
-		void setup_players(std::map<int, std::shared_ptr<Player>> &player_map, const int player_count, const bool print = true);
+		const std::array<int, TILE_EMPTY>& get_resources_drawn() const;
+		const std::array<int, TILE_EMPTY>& get_resources_returned() const;
 
 		/**
 		 * Requires: nothing
 		 * Modifies: nothing
-		 * Effects: returns remaining available resources
+		 * Effects: returns remaining available devcards
 		 */
-		std::map<tile_type, int> get_available_resources() const;
+		std::vector<devcard_type> get_available_devcards() const;
 
 		/**
 		 * Requires: nothing
 		 * Modifies: nothing
-		 * Effects: returns remaining available devcards
+		 * Effects: returns the Zobrist hash of the deck (see Zobrist.h)
 		 */
-		std::vector<devcard_type> get_available_devcards() const;
+		std::uint64_t get_hash() const;
 };
 
 #endif //GAMEBANK_H
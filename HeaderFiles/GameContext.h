@@ -0,0 +1,216 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef GAMECONTEXT_H
+#define GAMECONTEXT_H
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "Enums.h"
+#include "GameBank.h"
+#include "GameRandom.h"
+#include "ScoreTracker.h"
+
+class GameLogWriter;
+class Player;
+
+/** FORWARD DEFINITION
+* Requires: nothing
+* Modifies: nothing
+* Effects: returns number of players chosen by player
+*/
+int player_count_prompt();
+
+/*
+ * A GameContext is everything one game has that isn't on the board: the bank (resource piles and devcard
+ * deck), the players, their scores and titles, and the game's random numbers.
+ *
+ * The seed is split into separate streams for the board, the dice, the devcard deck and everything else
+ * (steals and agents' choices). What the players do never uses up the board's, dice's or deck's numbers, so
+ * a seed always gives the same board, the same rolls and the same devcard order.
+ *
+ * Each game makes its own, and its players keep a pointer back to it, so any number of games can be run
+ * side by side (on any number of threads) without sharing anything. The players point at it, so it can't
+ * be copied or moved.
+ */
+
+class GameContext {
+
+    private:
+        std::uint64_t seed;
+        GameRandom random;
+        GameRandom board_random;
+        GameRandom dice_random;
+        GameRandom deck_random;
+        GameBank bank;
+
+        std::map<int, std::shared_ptr<Player>> players;
+        // The same players, indexed by color so title holders can be looked up directly
+        std::array<std::shared_ptr<Player>, ScoreTracker::COLOR_COUNT> players_by_color;
+        int player_count = 0;
+
+        ScoreTracker score_tracker;
+
+        // Zobrist hash of the players' hands and knights
+        std::uint64_t hand_hash = 0;
+
+        // Where the game's events are recorded, if anywhere
+        GameLogWriter *log = nullptr;
+
+        /**
+        * Requires: whether it should print
+        * Modifies: players, players_by_color
+        * Effects: creates player_count players, coloured in order, and puts them in the maps
+        */
+        void setup_players(const bool print);
+
+    public:
+
+        /**
+        * Requires: player_count (optional), seed (optional)
+        * Modifies: player_count, players, random
+        * Effects: Constructor for GameContext. Creates the players, prompting for how many if player_count
+        * is 0, and splits the seed into the game's random streams
+        */
+        explicit GameContext(const int _player_count = 0, const std::uint64_t _seed = 0);
+
+        GameContext(const GameContext &) = delete;
+        GameContext& operator=(const GameContext &) = delete;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the game's bank
+        */
+        GameBank& get_bank();
+        const GameBank& get_bank() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the game's random numbers for anything without its own stream (steals, agents)
+        */
+        GameRandom& get_random();
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the random numbers the board is generated from
+        */
+        GameRandom& get_board_random();
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the random numbers the dice are rolled with
+        */
+        GameRandom& get_dice_random();
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the random numbers devcards are drawn with
+        */
+        GameRandom& get_deck_random();
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the seed the game's random numbers came from
+        */
+        std::uint64_t get_seed() const;
+
+        /**
+        * Requires: log to record the game's events in, or nullptr to stop recording
+        * Modifies: log
+        * Effects: makes the engine and the players record everything that happens in the log (see GameLog.h).
+        * The log isn't owned, and has to outlive the game or be unset
+        */
+        void set_log(GameLogWriter *_log);
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the log the game is recorded in, or nullptr
+        */
+        GameLogWriter* get_log() const;
+
+        /**
+        * Requires: Zobrist keys of what stopped and started being true about a player
+        * Modifies: hand_hash
+        * Effects: XORs the keys into the hash. Players call this whenever their hand or knights change
+        */
+        void toggle_hand_hash(const std::uint64_t keys);
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the Zobrist hash of the players' hands and knights and the devcard deck
+        * (see Zobrist.h). The board and the turn are hashed by BoardBitboards and GameEngine
+        */
+        std::uint64_t get_hash() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the tracker of every player's victory points and titles
+        */
+        ScoreTracker& get_score_tracker();
+        const ScoreTracker& get_score_tracker() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns players, by their number
+        */
+        const std::map<int, std::shared_ptr<Player>>& get_players() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the number of players
+        */
+        int get_player_count() const;
+
+        /**
+        * Requires: color string
+        * Modifies: nothing
+        * Effects: returns player with color from given string
+        */
+        std::shared_ptr<Player> get_player(std::string color) const;
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns player with given color
+        */
+        std::shared_ptr<Player> get_player(const player_color color) const;
+
+        /**
+        * Requires: index
+        * Modifies: nothing
+        * Effects: returns player with given index
+        */
+        std::shared_ptr<Player> get_player(const int player_index) const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns player with longest road
+        */
+        std::shared_ptr<Player> get_longest_road_player() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns player with largest army
+        */
+        std::shared_ptr<Player> get_largest_army_player() const;
+};
+
+#endif //GAMECONTEXT_H
@@ -0,0 +1,218 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef GAMEENGINE_H
+#define GAMEENGINE_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "Agent.h"
+#include "Enums.h"
+#include "GameLog.h"
+#include "GameState.h"
+#include "LegalActionGenerator.h"
+
+class Board;
+class GameContext;
+class Player;
+
+/*
+ * The GameEngine runs a game by the rules, asking each player's Agent whenever there is a choice.
+ *
+ * It does the initial placements, rolls the dice, handles 7s (discards, the robber, stealing), produces
+ * resources, and applies each action an Agent picks from the LegalActionGenerator's list until the player
+ * passes. Choices are checked before they are applied: an action which isn't legal is ignored, and any
+ * other illegal choice is replaced by the first legal one, so a broken Agent can't break the game.
+ *
+ * Nothing is printed unless print is true, so games between automated agents don't touch the console.
+ */
+
+class GameEngine {
+
+    public:
+        // Stops a turn whose agent never passes
+        static const int MAX_ACTIONS_PER_TURN = 200;
+
+    private:
+        Board &board;
+        GameContext &context;
+        std::map<player_color, std::shared_ptr<Agent>> agents;
+        bool print;
+
+        std::vector<std::shared_ptr<Player>> turn_order;
+        int turn_index = 0;
+        int turn_count = 0;
+        bool setup_done = false;
+        player_color winner = COLOR_EMPTY;
+
+        // Reused for every action, so listing the legal actions never allocates
+        ActionList legal_actions;
+
+        /**
+        * Requires: player
+        * Modifies: nothing
+        * Effects: returns the player's agent
+        */
+        Agent& get_agent(const std::shared_ptr<Player> &player) const;
+
+        /**
+        * Requires: player, gain_adjacent_resources
+        * Modifies: board, player
+        * Effects: places one initial settlement and the road next to it, giving the player one of each
+        * resource around the settlement if gain_adjacent_resources = true
+        */
+        void place_initial(const std::shared_ptr<Player> &player, const bool gain_adjacent_resources);
+
+        /**
+        * Requires: player whose turn it is
+        * Modifies: every player's resources, the robber, bank
+        * Effects: makes everyone with more than 7 resources discard half (rounded down), then moves the robber
+        */
+        void seven_rolled(const std::shared_ptr<Player> &player);
+
+        /**
+        * Requires: player who moves the robber
+        * Modifies: the robber, player's and the robbed player's resources
+        * Effects: moves the robber where the agent chooses and steals a resource from a player next to it
+        */
+        void move_robber(const std::shared_ptr<Player> &player);
+
+        /**
+        * Requires: player, playable devcard type
+        * Modifies: player's devcards, and whatever the card affects
+        * Effects: plays the card and applies its effect
+        */
+        void play_devcard(const std::shared_ptr<Player> &player, const devcard_type type);
+
+        /**
+        * Requires: player, path id the road may go on, if it is one of the initial roads
+        * Modifies: board, player
+        * Effects: places one of the player's roads, without paying for it
+        */
+        void place_road(const std::shared_ptr<Player> &player, const PathId path, const bool initial = false);
+
+        /**
+        * Requires: action
+        * Modifies: nothing
+        * Effects: returns if the action is in legal_actions
+        */
+        bool is_legal(const Action &action) const;
+
+        /**
+        * Requires: player
+        * Modifies: winner
+        * Effects: makes the player the winner if they have enough points
+        */
+        void check_winner(const std::shared_ptr<Player> &player);
+
+        /**
+        * Requires: event type, color, target
+        * Modifies: the context's log
+        * Effects: adds the event to the game's log, if it is being logged
+        */
+        void record(const game_event_type type, const player_color color, const int target) const;
+
+    public:
+
+        /**
+        * Requires: board, the game's context, an agent for every player's color, print (optional)
+        * Modifies: board, context, turn_order
+        * Effects: Constructor for GameEngine. Turns go in the order of the context's players
+        */
+        GameEngine(
+            Board &_board, GameContext &_context,
+            const std::map<player_color, std::shared_ptr<Agent>> &_agents,
+            const bool _print = false);
+
+        /**
+        * Requires: nothing
+        * Modifies: board, players, bank
+        * Effects: each player places a settlement and road in turn order, then again in reverse order,
+        * gaining the resources around their second settlement
+        */
+        void setup();
+
+        /**
+        * Requires: state the board and context were restored from (see GameSave), saved between turns
+        * Modifies: turn_index, turn_count, setup_done, winner
+        * Effects: carries on the saved game: the state's current player is the next to play
+        */
+        void resume(const GameState &state);
+
+        /**
+        * Requires: roll_override (optional, 2-12)
+        * Modifies: board, players, bank, turn_index, turn_count, winner
+        * Effects: plays the current player's turn: rolls the dice (or uses roll_override), then applies
+        * the player's actions until they pass or win. Moves on to the next player
+        */
+        void play_turn(const int roll_override = -1);
+
+        /**
+        * Requires: max_turns
+        * Modifies: board, players, bank, turn_index, turn_count, winner
+        * Effects: does the setup if it hasn't been done, and plays turns until someone wins or max_turns
+        * turns have been played. Returns the winner's color, or COLOR_EMPTY if nobody won
+        */
+        player_color play_game(const int max_turns);
+
+        /**
+        * Requires: player whose turn it is, action
+        * Modifies: board, player, bank, winner
+        * Effects: applies the action if it is legal right now. Returns if it was applied
+        */
+        bool apply_action(const std::shared_ptr<Player> &player, const Action &action);
+
+        /**
+        * Requires: proposer, target, what the proposer pays, what the target pays
+        * Modifies: proposer's and target's resources
+        * Effects: offers the trade to the target's agent, and swaps the resources if both can afford it
+        * and the target accepts. Returns if the trade happened
+        */
+        bool offer_trade(
+            const std::shared_ptr<Player> &proposer, const std::shared_ptr<Player> &target,
+            const ResourceVector &payment, const ResourceVector &gain);
+
+        /* Getters */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns a flat copy of the game as it is now, including whose turn it is
+        */
+        GameState get_state() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the Zobrist hash of the game as it is now (see Zobrist.h), kept up to date as the
+        * game is played. It equals get_state().hash()
+        */
+        std::uint64_t get_hash() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the player whose turn is next
+        */
+        std::shared_ptr<Player> get_current_player() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the number of turns played, not counting the setup
+        */
+        int get_turn_count() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the winner's color, or COLOR_EMPTY if nobody has won yet
+        */
+        player_color get_winner() const;
+};
+
+#endif //GAMEENGINE_H
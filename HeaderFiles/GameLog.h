@@ -0,0 +1,306 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef GAMELOG_H
+#define GAMELOG_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Enums.h"
+#include "StandardBoard.h"
+
+class Board;
+class GameContext;
+struct BoardLayout;
+
+/*
+ * A game log is a binary file of everything that happened in one game, for going over a game afterwards
+ * and for playing a bug back exactly.
+ *
+ * The file starts with a 64 byte header: the magic "HXLG", the format version, the number of players, the
+ * game's seed and the board's layout (tiles, numbers and ports). The rest is a list of 4 byte events (type, color, target,
+ * amount), one for each thing that changed the game: turns, rolls, pieces placed, devcards bought and played,
+ * the robber moving, and every resource moving between the bank and the players. Every field is a single
+ * byte or written little endian, so logs read the same on any machine.
+ *
+ * The GameEngine and the players record into the GameContext's GameLogWriter while the game is played.
+ * The GameLogReader maps a log into memory, and the GameLogReplayer applies its events one by one to a
+ * Board made from the logged layout and a GameContext made from the same seed, which ends up in the same
+ * state as the recorded game. The layout is logged rather than made again from the seed, so games on a board
+ * picked by the BoardBalancer replay too.
+ */
+
+enum game_event_type {
+    // target: nothing
+    EVENT_TURN_START,
+    // target: the roll
+    EVENT_ROLL,
+    // target: plot id. Initial placements cost nothing
+    EVENT_SETUP_SETTLEMENT,
+    // target: path id
+    EVENT_SETUP_ROAD,
+    // target: plot id, or path id for roads. What they cost is recorded as resource events
+    EVENT_SETTLEMENT,
+    EVENT_CITY,
+    EVENT_ROAD,
+    // target: devcard_type drawn or played
+    EVENT_BUY_DEVCARD,
+    EVENT_PLAY_DEVCARD,
+    // target: tile id
+    EVENT_ROBBER,
+    // target: tile_type, amount: how many. Resources from or to the bank, or from or to another player
+    EVENT_GAIN_FROM_BANK,
+    EVENT_GAIN,
+    EVENT_RETURN_TO_BANK,
+    EVENT_LOSE,
+    // color: the winner
+    EVENT_WINNER,
+    EVENT_TYPE_COUNT
+};
+
+struct GameEvent {
+    std::uint8_t type;
+    std::uint8_t color;
+    std::uint8_t target;
+    std::uint8_t amount;
+};
+
+static_assert(sizeof(GameEvent) == 4, "events are written as 4 bytes");
+
+struct GameLogHeader {
+    static const int SIZE = 64;
+    static const std::uint16_t VERSION = 2;
+
+    std::uint16_t version = VERSION;
+    std::uint8_t player_count = 0;
+    std::uint64_t seed = 0;
+    std::array<std::uint8_t, StandardBoard::TILE_COUNT> tile_types{};
+    std::array<std::int8_t, StandardBoard::TILE_COUNT> tile_numbers{};
+    std::array<std::uint8_t, StandardBoard::PORT_COUNT> port_types{};
+
+    /**
+    * Requires: board, the game's context
+    * Modifies: nothing
+    * Effects: returns the header of a log of the game
+    */
+    static GameLogHeader describe(const Board &board, const GameContext &context);
+
+    /**
+    * Requires: SIZE bytes
+    * Modifies: bytes
+    * Effects: writes the header into the bytes
+    */
+    void encode(std::uint8_t *bytes) const;
+
+    /**
+    * Requires: SIZE bytes
+    * Modifies: every field
+    * Effects: reads the header from the bytes. Returns false if they aren't a log header of this version, or
+    * the layout has something other than tiles and ports in it
+    */
+    bool decode(const std::uint8_t *bytes);
+
+    /**
+    * Requires: board
+    * Modifies: nothing
+    * Effects: returns if the board has the same tiles, numbers and ports as the logged game's
+    */
+    bool matches(const Board &board) const;
+
+    /**
+    * Requires: nothing
+    * Modifies: nothing
+    * Effects: returns the logged game's board layout, which makes the same board again
+    */
+    BoardLayout get_layout() const;
+};
+
+class GameLogWriter {
+
+    public:
+        // Events are written to the file this many bytes at a time
+        static const std::size_t BUFFER_SIZE = 1 << 16;
+
+    private:
+        std::FILE *file = nullptr;
+        std::vector<std::uint8_t> buffer;
+        std::size_t event_count = 0;
+        bool failed = false;
+
+    public:
+
+        /**
+        * Requires: nothing
+        * Modifies: buffer
+        * Effects: Constructor for GameLogWriter, with no file open
+        */
+        GameLogWriter();
+
+        /**
+        * Requires: nothing
+        * Modifies: file
+        * Effects: Destructor for GameLogWriter, writes what is left in the buffer and closes the file
+        */
+        ~GameLogWriter();
+
+        GameLogWriter(const GameLogWriter &) = delete;
+        GameLogWriter& operator=(const GameLogWriter &) = delete;
+
+        /**
+        * Requires: path, header of the game
+        * Modifies: file, buffer, event_count
+        * Effects: creates (or empties) the file and writes the header. Returns false if it can't
+        */
+        bool open(const std::string &path, const GameLogHeader &header);
+
+        /**
+        * Requires: event type, color, target, amount (optional)
+        * Modifies: buffer, event_count
+        * Effects: adds the event to the log. Nothing is written to the file until the buffer is full
+        */
+        void append(const game_event_type type, const player_color color, const int target, const int amount = 0);
+
+        /**
+        * Requires: nothing
+        * Modifies: buffer, file
+        * Effects: writes the buffered events to the file. Returns false if anything failed to write since the
+        * log was opened
+        */
+        bool flush();
+
+        /**
+        * Requires: nothing
+        * Modifies: buffer, file
+        * Effects: flushes and closes the file. Returns false if anything failed to write
+        */
+        bool close();
+
+        /* Getters */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns if a file is open
+        */
+        bool is_open() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns how many events have been appended since the log was opened
+        */
+        std::size_t get_event_count() const;
+};
+
+class GameLogReader {
+
+    private:
+        const std::uint8_t *data = nullptr;
+        std::size_t size = 0;
+        GameLogHeader header;
+
+        // What the platform needs to unmap the file
+        void *mapping = nullptr;
+
+    public:
+
+        GameLogReader() = default;
+
+        /**
+        * Requires: nothing
+        * Modifies: data
+        * Effects: Destructor for GameLogReader, unmaps the file
+        */
+        ~GameLogReader();
+
+        GameLogReader(const GameLogReader &) = delete;
+        GameLogReader& operator=(const GameLogReader &) = delete;
+
+        /**
+        * Requires: path of a log
+        * Modifies: data, size, header, mapping
+        * Effects: maps the file into memory and reads its header. Returns false if it can't be mapped or
+        * isn't a log of this version
+        */
+        bool open(const std::string &path);
+
+        /**
+        * Requires: nothing
+        * Modifies: data, size, mapping
+        * Effects: unmaps the file
+        */
+        void close();
+
+        /* Getters */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the log's header
+        */
+        const GameLogHeader& get_header() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns how many whole events the log holds (a write cut short can leave part of one)
+        */
+        std::size_t get_event_count() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: iterators over the events, read straight from the mapped file
+        */
+        const GameEvent* begin() const;
+        const GameEvent* end() const;
+};
+
+class GameLogReplayer {
+
+    private:
+        Board &board;
+        GameContext &context;
+        player_color winner = COLOR_EMPTY;
+
+    public:
+
+        /**
+        * Requires: board made from the log header's layout and context made from its seed and player count,
+        * before anything happened
+        * Modifies: board, context
+        * Effects: Constructor for GameLogReplayer
+        */
+        GameLogReplayer(Board &_board, GameContext &_context);
+
+        /**
+        * Requires: event
+        * Modifies: board, context, winner
+        * Effects: applies the event to the game. Returns false, changing nothing, if the event isn't valid
+        */
+        bool apply(const GameEvent &event);
+
+        /**
+        * Requires: reader of an open log
+        * Modifies: board, context, winner
+        * Effects: applies every event of the log, stopping at the first invalid one. Returns how many were applied
+        */
+        std::size_t replay(const GameLogReader &reader);
+
+        /* Getters */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the winner recorded so far, or COLOR_EMPTY
+        */
+        player_color get_winner() const;
+};
+
+#endif //GAMELOG_H
@@ -0,0 +1,73 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef GAMERANDOM_H
+#define GAMERANDOM_H
+
+#include <array>
+#include <cstdint>
+
+/*
+ * Random numbers for board generation, dice, devcard draws, steals and automated agents.
+ *
+ * The generator is xoshiro256**: 32 bytes of state, a few shifts and rotates per number, and a jump which
+ * moves the state 2^128 numbers ahead. split() uses the jump to hand out streams which can never overlap, so
+ * one seed can give every part of a game (or every game of a simulation) its own independent numbers.
+ *
+ * A seed always gives the same numbers, on every platform, so anything made from a seed can be made again.
+ */
+
+class GameRandom {
+
+    private:
+        std::array<std::uint64_t, 4> state;
+
+        /**
+        * Requires: nothing
+        * Modifies: state
+        * Effects: moves the state 2^128 numbers ahead
+        */
+        void jump();
+
+    public:
+
+        /**
+        * Requires: seed (optional)
+        * Modifies: state
+        * Effects: Constructor for GameRandom, starts the numbers from the seed
+        */
+        explicit GameRandom(const std::uint64_t seed = 0);
+
+        /**
+        * Requires: seed
+        * Modifies: state
+        * Effects: restarts the numbers from the seed. The state is filled with splitmix64, so nearby seeds
+        * give unrelated numbers
+        */
+        void seed(const std::uint64_t seed);
+
+        /**
+        * Requires: nothing
+        * Modifies: state
+        * Effects: returns the next 64 random bits
+        */
+        std::uint64_t next();
+
+        /**
+        * Requires: bound > 0
+        * Modifies: state
+        * Effects: returns a random int from 0 to bound - 1. Every value is equally likely
+        */
+        int next_int(const int bound);
+
+        /**
+        * Requires: nothing
+        * Modifies: state
+        * Effects: returns a generator which continues from this one's numbers, and jumps this one 2^128 numbers
+        * ahead. Each split gives a stream which won't overlap this one or any other split from it
+        */
+        GameRandom split();
+};
+
+#endif //GAMERANDOM_H
@@ -0,0 +1,113 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef GAMESAVE_H
+#define GAMESAVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Board.h"
+#include "GameState.h"
+
+class GameContext;
+
+/*
+ * A saved game is a GameState and the seed the game's random numbers were made from: the tiles, numbers,
+ * ports and robber, every piece on the board, every hand (with which devcards were bought this turn), the
+ * bank, the deck, who holds the titles and whose turn it is.
+ *
+ * There are two formats of the same fields. The binary one starts with the magic "HXSV" and the format
+ * version, then every field as single bytes (the turn count as two, little endian), about 400 bytes in all.
+ * The text one starts with "hexsettlers-save" and the version, then puts one field on each line as its name
+ * and numbers, so two saves can be compared with diff. load reads either.
+ *
+ * To carry on a saved game, make a Board from get_layout(state), a GameContext from the player count and
+ * seed, restore the state into them and resume a GameEngine on them. The random numbers start again from
+ * the seed, so the dice after a load don't follow the ones the saved game would have rolled.
+ */
+
+enum save_format {
+    SAVE_BINARY,
+    SAVE_TEXT
+};
+
+struct SavedGame {
+    std::uint64_t seed = 0;
+    GameState state{};
+};
+
+class GameSave {
+
+    public:
+        static const std::uint16_t VERSION = 1;
+
+        /**
+        * Requires: game
+        * Modifies: nothing
+        * Effects: returns the game in the binary format
+        */
+        static std::vector<std::uint8_t> encode_binary(const SavedGame &game);
+
+        /**
+        * Requires: bytes, how many there are, game to fill
+        * Modifies: game
+        * Effects: reads a game in the binary format. Returns false if the bytes aren't a valid save of this version
+        */
+        static bool decode_binary(const std::uint8_t *bytes, const std::size_t size, SavedGame &game);
+
+        /**
+        * Requires: game
+        * Modifies: nothing
+        * Effects: returns the game in the text format
+        */
+        static std::string encode_text(const SavedGame &game);
+
+        /**
+        * Requires: text, game to fill
+        * Modifies: game
+        * Effects: reads a game in the text format. Returns false if the text isn't a valid save of this version
+        */
+        static bool decode_text(const std::string &text, SavedGame &game);
+
+        /**
+        * Requires: path, game, format
+        * Modifies: the file at path
+        * Effects: writes the game to the file. Returns false if it can't
+        */
+        static bool save(const std::string &path, const SavedGame &game, const save_format format);
+
+        /**
+        * Requires: path, game to fill
+        * Modifies: game
+        * Effects: reads a game saved in either format. Returns false if the file can't be read or isn't a valid save
+        */
+        static bool load(const std::string &path, SavedGame &game);
+
+        /**
+        * Requires: state
+        * Modifies: nothing
+        * Effects: returns if every field of the state is in range and the pieces, cards and resources add up
+        */
+        static bool is_valid(const GameState &state);
+
+        /**
+        * Requires: state
+        * Modifies: nothing
+        * Effects: returns the layout of the state's board
+        */
+        static BoardLayout get_layout(const GameState &state);
+
+        /**
+        * Requires: valid state, board made from its layout and context made for its players, both unplayed
+        * Modifies: board, context
+        * Effects: puts the robber, the pieces, the hands, the bank, the deck and the titles where the state has
+        * them. Returns false if the state doesn't fit the board or context
+        */
+        static bool restore(const GameState &state, Board &board, GameContext &context);
+};
+
+#endif //GAMESAVE_H
@@ -0,0 +1,131 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef GAMESTATE_H
+#define GAMESTATE_H
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "BoardBitboards.h"
+#include "Enums.h"
+#include "ScoreTracker.h"
+#include "StandardBoard.h"
+
+class Board;
+class GameContext;
+
+/*
+ * A GameState is a whole game as plain numbers: who owns each plot and path, what every tile is, every
+ * player's hand, the bank, the devcard deck and whose turn it is.
+ *
+ * The Board, its pieces and the GameContext are a web of shared_ptrs which can't be copied, but a GameState
+ * holds no pointers at all, so copying one (a memcpy of a few hundred bytes) gives a completely separate game
+ * to try moves on. What doesn't change during a game, the layout of plots, paths and tiles, is left out and
+ * read from StandardBoard::TOPOLOGY, which every state shares.
+ *
+ * Ids are the same ones the BoardGraph uses, and every array indexed by a color, tile_type or devcard_type
+ * is indexed by the enum's value.
+ */
+
+struct PlayerState {
+    // Resources in hand, indexed by tile_type (DESERT is always 0)
+    std::array<std::uint8_t, TILE_EMPTY> resources;
+
+    // Devcards in hand which could be played, and ones bought this turn which can't yet
+    std::array<std::uint8_t, CARD_EMPTY> devcards;
+    std::array<std::uint8_t, CARD_EMPTY> new_devcards;
+    bool played_devcard;
+
+    std::uint8_t knights;
+    std::uint8_t road_length;
+
+    // Pieces not yet on the board
+    std::uint8_t roads_left;
+    std::uint8_t settlements_left;
+    std::uint8_t cities_left;
+
+    /**
+    * Requires: nothing
+    * Modifies: nothing
+    * Effects: returns how many resources are in hand
+    */
+    int get_resource_count() const;
+
+    /**
+    * Requires: nothing
+    * Modifies: nothing
+    * Effects: returns how many victory point cards are in hand
+    */
+    int get_victory_point_cards() const;
+};
+
+struct GameState {
+    static const int PLAYER_COUNT = ScoreTracker::COLOR_COUNT;
+
+    // The layout of this game's board. Ports are PortMasks, tile numbers are -1 for the desert
+    std::array<std::uint8_t, StandardBoard::TILE_COUNT> tile_types;
+    std::array<std::int8_t, StandardBoard::TILE_COUNT> tile_numbers;
+    std::array<PortMask, StandardBoard::PLOT_COUNT> plot_ports;
+
+    // The pieces on the board, by the color of their owner (COLOR_EMPTY when there is none)
+    std::array<std::uint8_t, StandardBoard::PLOT_COUNT> plot_owners;
+    std::array<bool, StandardBoard::PLOT_COUNT> plot_cities;
+    std::array<std::uint8_t, StandardBoard::PATH_COUNT> path_owners;
+    std::int8_t robber_tile;
+
+    // The supply
+    std::array<std::uint8_t, TILE_EMPTY> bank_resources;
+    std::array<std::uint8_t, CARD_EMPTY> deck;
+
+    // Players are indexed by color. Only the first player_count are in the game
+    std::array<PlayerState, PLAYER_COUNT> players;
+    std::uint8_t player_count;
+
+    std::uint8_t longest_road_holder;
+    std::uint8_t largest_army_holder;
+
+    std::uint8_t current_player;
+    bool in_setup;
+    std::uint8_t winner;
+    std::uint16_t turn_count;
+
+    /**
+    * Requires: board, the game's context
+    * Modifies: nothing
+    * Effects: returns the state of the game on the board, with RED to play on turn 0
+    */
+    static GameState capture(const Board &board, const GameContext &context);
+
+    /**
+    * Requires: nothing
+    * Modifies: nothing
+    * Effects: returns the Zobrist hash of the state (see Zobrist.h), worked out from scratch. It is the same
+    * as GameEngine::get_hash for the game the state was taken from. The layout, the bank's resources, whether
+    * a devcard was played this turn and the turn count aren't hashed
+    */
+    std::uint64_t hash() const;
+
+    /**
+    * Requires: color
+    * Modifies: nothing
+    * Effects: returns the player's settlements, cities or roads as masks
+    */
+    PlotMask get_settlements(const player_color color) const;
+    PlotMask get_cities(const player_color color) const;
+    PathMask get_roads(const player_color color) const;
+
+    /**
+    * Requires: color, is_private (optional)
+    * Modifies: nothing
+    * Effects: returns the player's victory points, including victory point cards if is_private = true
+    */
+    int get_points(const player_color color, const bool is_private = true) const;
+};
+
+static_assert(std::is_trivially_copyable<GameState>::value, "a GameState has to be copyable with memcpy");
+static_assert(sizeof(GameState) <= 512, "a GameState should stay a few hundred bytes");
+
+#endif //GAMESTATE_H
@@ -13,9 +13,11 @@
 #include <memory>
 
 #include "Enums.h"
+#include "ResourceVector.h"
 #include "Plot.h"
 #include "OrderedPair.h"
 #include "Board.h"
+#include "LegalActionGenerator.h"
 
 class Player;
 
@@ -126,27 +128,40 @@ std::shared_ptr<Path> placement_path_prompt(
 int player_count_prompt();
 
 /**
-* Requires: board, player, steal_resource
+* Requires: number of players
 * Modifies: nothing
-* Effects: prompts user to move the robber to chosen tile
+* Effects: returns how many of the players the computer should play, chosen by the user
 */
-void robber_movement_prompt(
-	Board &board, std::shared_ptr<Player> &player, const bool steal_resource);
+int computer_player_count_prompt(const int player_count);
 
 /**
-* Requires: board, player, tile_id
+* Requires: nothing
+* Modifies: nothing
+* Effects: asks the user whether to carry on the saved game or start a new one. Returns true to carry on
+*/
+bool continue_saved_game_prompt();
+
+/**
+* Requires: board, player
+* Modifies: nothing
+* Effects: prompts the user to choose a tile without the robber to move the robber to, and returns its id
+*/
+TileId robber_tile_prompt(Board &board, const std::shared_ptr<Player> &player);
+
+/**
+* Requires: player, colors of the players who can be stolen from
 * Modifies: nothing
-* Effects: prompts the user to choose a player adjacent to given tile to steal from
+* Effects: prompts the user to choose a player to steal from. Returns COLOR_EMPTY if there are none
 */
-void adjacent_resource_theft_prompt(
-	Board &board, std::shared_ptr<Player> &player, const std::string tile_id);
+player_color steal_target_prompt(
+	const std::shared_ptr<Player> &player, const std::vector<player_color> &targets);
 
 /**
 * Requires: player, number
 * Modifies: nothing
-* Effects: prompts the user to discard the given number of resources
+* Effects: prompts the user to choose the given number of resources from their hand to discard, and returns them
 */
-void discard_resources_prompt(std::shared_ptr<Player> player, int number_of_resources);
+ResourceVector discard_resources_prompt(const std::shared_ptr<Player> &player, int number_of_resources);
 
 /**
 * Requires: player, consider_bank, consider_hand, can_quit, excluded resources, main_message_override
@@ -162,30 +177,39 @@ tile_type resource_choice_prompt(
 	const std::string main_message_override);
 
 /**
-* Requires: board, player
-* Modifies: nothing
-* Effects: prompts the player to choose something to craft
+* Requires: board, player, craft
+* Modifies: craft
+* Effects: prompts the player to choose something to craft and where. Returns false if they chose nothing
 */
-void craft_something_prompt(Board &board, const std::shared_ptr<Player> &player);
+bool craft_something_prompt(Board &board, const std::shared_ptr<Player> &player, Action &craft);
 
 /**
-* Requires: board, player, players
-* Modifies: nothing
-* Effects: prompts the player to choose a type of trading
+* Requires: board, player, players, bank_trade
+* Modifies: bank_trade
+* Effects: prompts the player to choose a type of trading. Trades with other players happen right away,
+* trades with the bank are returned in bank_trade. Returns true if a bank trade was chosen
 */
-void trade_prompt(
+bool trade_prompt(
 	const Board &board,
 	const std::shared_ptr<Player> &subject_player,
-	const std::map<int,std::shared_ptr<Player>> &players);
+	const std::map<int,std::shared_ptr<Player>> &players,
+	Action &bank_trade);
+
+/**
+* Requires: board, player, trade
+* Modifies: trade
+* Effects: prompts the user to choose a resource to trade with the bank, at the rates the player's ports give.
+* Returns false if they quit
+*/
+bool maritime_trade(const Board &board, const std::shared_ptr<Player> &subject_player, Action &trade);
 
 /**
-* Requires: player, ports, universal_port?
+* Requires: board, player
 * Modifies: nothing
-* Effects: prompts the user to choose a resource to trade with the bank
+* Effects: prompts the user to choose something to craft, then prints the cheapest bank trades which would
+* let them afford it
 */
-void maritime_trade(const std::shared_ptr<Player> &subject_player,
-	const std::vector<tile_type> &typed_ports = {},
-	const bool with_universal_port = false);
+void suggest_trade_prompt(const Board &board, const std::shared_ptr<Player> &player);
 
 /**
 * Requires: player, payment, gain
@@ -194,8 +218,8 @@ void maritime_trade(const std::shared_ptr<Player> &subject_player,
 */
 void modify_trade_prompt(
 	const std::shared_ptr<Player> &proposer,
-	std::map<tile_type, int> &payment,
-	std::map<tile_type, int> &gain);
+	ResourceVector &payment,
+	ResourceVector &gain);
 
 /**
 * Requires: side, change, target_aspect, resource, amount
@@ -203,7 +227,7 @@ void modify_trade_prompt(
 * Effects: changes the side of the trade
 */
 void modify_trade_side(
-	std::map<tile_type, int> &side,
+	ResourceVector &side,
 	const std::string change,
 	const std::string target_aspect,
 	const tile_type resource,
@@ -217,8 +241,19 @@ void modify_trade_side(
 bool trade_confirm_prompt(
 	const std::shared_ptr<Player> &proposer,
 	const std::shared_ptr<Player> &target_player,
-	const std::map<tile_type, int> &proposers_payment,
-	const std::map<tile_type, int> &targets_payment);
+	const ResourceVector &proposers_payment,
+	const ResourceVector &targets_payment);
+
+/**
+* Requires: proposer, target, payments
+* Modifies: nothing
+* Effects: shows the target the trade and returns if they accept it and can afford it
+*/
+bool trade_response_prompt(
+	const std::shared_ptr<Player> &proposer,
+	const std::shared_ptr<Player> &target_player,
+	const ResourceVector &proposers_payment,
+	const ResourceVector &targets_payment);
 
 /**
 * Requires: proposer, target, payment, gain
@@ -228,8 +263,8 @@ bool trade_confirm_prompt(
 void display_trade(
 	const std::shared_ptr<Player> &proposer,
 	const std::shared_ptr<Player> &target_player,
-	const std::map<tile_type, int> &payment,
-	const std::map<tile_type, int> &gain);
+	const ResourceVector &payment,
+	const ResourceVector &gain);
 
 /**
 * Requires: payment
@@ -237,7 +272,7 @@ void display_trade(
 * Effects: returns if the side of the trade is valid
 */
 bool valid_trade_side(
-	const std::map<tile_type, int> &payment);
+	const ResourceVector &payment);
 
 /**
 * Requires: board, player,
@@ -267,69 +302,48 @@ void request_info_prompt(
 void request_board_info_prompt(const Board &board);
 
 /**
-* Requires: board, player, require_adjacent_road, can_quit, spend_resources
+* Requires: board, player, require_adjacent_road, can_quit
 * Modifies: nothing
-* Effects: prompts the player to place a building
+* Effects: prompts the player to choose where to place a settlement. Returns nullptr if they quit
 */
-OrderedPair place_building(
+std::shared_ptr<Plot> settlement_location_prompt(
 	Board &board,
 	const std::shared_ptr<Player> &player,
 	const bool require_adjacent_road = true,
-	const bool can_quit = true,
-	const bool spend_resources = true);
+	const bool can_quit = true);
 
 /**
 * Requires: board, player, can_quit
 * Modifies: nothing
-* Effects: prompts the player to upgrade a building
+* Effects: prompts the player to choose a settlement to upgrade to a city. Returns nullptr if they quit
 */
-OrderedPair upgrade_building(
+std::shared_ptr<Plot> city_location_prompt(
 	Board &board,
 	const std::shared_ptr<Player> &player,
 	const bool can_quit);
 
 /**
-* Requires: board, player, requires_adjacent_road, can_quit, spend_resources
+* Requires: board, player, requires_adjacent_road, can_quit
 * Modifies: nothing
-* Effects: prompts the player to place a road
+* Effects: prompts the player to choose where to place a road. Returns nullptr if they quit
 */
-void place_road(
+std::shared_ptr<Path> road_location_prompt(
 	Board &board,
 	const std::shared_ptr<Player> &player,
 	const bool requires_adjacent_road,
-	const bool can_quit,
-	const bool spend_resources);
-
-/**
-* Requires: board, player, building_position
-* Modifies: nothing
-* Effects: prompts the player to place their initial roads
-*/
-void initial_road_placement(
-	const Board &board,
-	const std::shared_ptr<Player> &player,
-	const OrderedPair building_position);
+	const bool can_quit);
 
 /**
 * Requires: board, player, can_quit
 * Modifies: nothing
-* Effects: prompts the player to play a devcard
+* Effects: prompts the player to choose a devcard to play. Returns CARD_EMPTY if they quit or the card
+* can't be played right now
 */
-void play_devcard(
+devcard_type devcard_choice_prompt(
 	Board &board,
 	const std::shared_ptr<Player> &player,
 	const bool can_quit);
 
-/**
-* Requires: board, player, gain_adjacent_resources
-* Modifies: nothing
-* Effects: Handles player board setup
-*/
-void initial_player_setup(
-	Board &board,
-	const std::shared_ptr<Player> &player,
-	const bool gain_adjacent_resources);
-
 /**
 * Requires: nothing
 * Modifies: nothing
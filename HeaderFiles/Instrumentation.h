@@ -0,0 +1,171 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+/*
+ * Instrumentation counts how often the hot parts of the game are called and how long they take, so a slow
+ * turn can be picked apart without a profiler. It is compiled in when HEXSETTLERS_INSTRUMENT is defined (the
+ * CMake option of the same name), and the macros below compile to nothing otherwise.
+ *
+ * INSTRUMENT_COUNT(name) counts the calls of where it is written. INSTRUMENT_SCOPE(name) also times the rest
+ * of the enclosing block and counts the allocations made on the thread in that time. Times are measured with
+ * the CPU's time stamp counter where there is one (x86), and std::chrono::steady_clock otherwise.
+ *
+ * Each thread counts into its own records, which only it writes, so threads don't contend over the counters.
+ * report adds up every thread's records, including threads which have finished.
+ */
+
+struct InstrumentStats {
+    std::uint64_t calls = 0;
+    std::uint64_t ticks = 0;
+    std::uint64_t allocations = 0;
+};
+
+class InstrumentSite {
+
+    private:
+        const char *name;
+        bool timed;
+        // Index of the site's records, or -1 if there are already MAX_SITES sites
+        int index;
+
+    public:
+        static const int MAX_SITES = 128;
+
+        /**
+        * Requires: name which lives as long as the program, whether the site is timed
+        * Modifies: the list of sites
+        * Effects: Constructor for InstrumentSite, adds it to the list of sites
+        */
+        InstrumentSite(const char *_name, const bool _timed);
+
+        /**
+        * Requires: calls, ticks and allocations to add
+        * Modifies: this thread's records of the site
+        * Effects: adds them to the site's records
+        */
+        void record(const std::uint64_t calls, const std::uint64_t ticks = 0, const std::uint64_t allocations = 0) const;
+
+        /* Getters */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the site's name
+        */
+        const char* get_name() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns if the site is timed, or only counted
+        */
+        bool is_timed() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the index of the site's records, -1 if it has none
+        */
+        int get_index() const;
+};
+
+class ScopedTimer {
+
+    private:
+        const InstrumentSite &site;
+        std::uint64_t start;
+        std::uint64_t start_allocations;
+
+    public:
+
+        /**
+        * Requires: site
+        * Modifies: nothing
+        * Effects: Constructor for ScopedTimer, starts timing
+        */
+        explicit ScopedTimer(const InstrumentSite &_site);
+
+        /**
+        * Requires: nothing
+        * Modifies: this thread's records of the site
+        * Effects: Destructor for ScopedTimer, records the call, the time since it was made and the allocations
+        */
+        ~ScopedTimer();
+
+        ScopedTimer(const ScopedTimer &) = delete;
+        ScopedTimer& operator=(const ScopedTimer &) = delete;
+};
+
+namespace Instrumentation {
+
+    /**
+    * Requires: nothing
+    * Modifies: nothing
+    * Effects: returns if the game was compiled with instrumentation
+    */
+    bool is_compiled_in();
+
+    /**
+    * Requires: nothing
+    * Modifies: nothing
+    * Effects: returns the current time in ticks
+    */
+    std::uint64_t now();
+
+    /**
+    * Requires: ticks
+    * Modifies: nothing
+    * Effects: returns how many nanoseconds the ticks are
+    */
+    double ticks_to_ns(const std::uint64_t ticks);
+
+    /**
+    * Requires: nothing
+    * Modifies: nothing
+    * Effects: returns how many times operator new has been called on this thread. Always 0 without instrumentation
+    */
+    std::uint64_t get_thread_allocations();
+
+    /**
+    * Requires: name of a site
+    * Modifies: nothing
+    * Effects: returns the site's records added up over every thread, all 0 if there is no such site
+    */
+    InstrumentStats get_stats(const std::string &name);
+
+    /**
+    * Requires: output stream
+    * Modifies: the stream
+    * Effects: writes a table of every site that was called: its calls, and the total and mean time and
+    * allocations of timed ones, slowest first
+    */
+    void report(std::ostream &out);
+}
+
+#define INSTRUMENT_CONCAT_INNER(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_INNER(a, b)
+
+#ifdef HEXSETTLERS_INSTRUMENT
+#define INSTRUMENT_COUNT(name) \
+    do { \
+        static const InstrumentSite instrument_site(name, false); \
+        instrument_site.record(1); \
+    } while (false)
+#define INSTRUMENT_SCOPE(name) \
+    static const InstrumentSite INSTRUMENT_CONCAT(instrument_site_, __LINE__)(name, true); \
+    ScopedTimer INSTRUMENT_CONCAT(instrument_timer_, __LINE__)(INSTRUMENT_CONCAT(instrument_site_, __LINE__))
+#else
+#define INSTRUMENT_COUNT(name) do {} while (false)
+#define INSTRUMENT_SCOPE(name) do {} while (false)
+#endif
+
+#endif //INSTRUMENTATION_H
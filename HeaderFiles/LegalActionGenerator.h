@@ -0,0 +1,143 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef LEGALACTIONGENERATOR_H
+#define LEGALACTIONGENERATOR_H
+
+#include <array>
+
+#include "Enums.h"
+#include "BoardGraph.h"
+
+class Board;
+class Player;
+class GameBank;
+
+/*
+ * The LegalActionGenerator answers "what can this player legally do right now" without any prompts.
+ *
+ * It lists every settlement, city and road placement, development card purchase and play, maritime
+ * (bank or port) trade, and passing the turn. The rules are the same ones the prompts enforce, but read
+ * from the board's bitboards and the player's hand directly. Actions are written into a fixed size
+ * ActionList, so enumerating moves never allocates and the same list can be reused for every call.
+ *
+ * Trades between players are open ended offers, so they are not listed.
+ */
+
+struct Action {
+    action_type type = PASS_TURN;
+    // Plot id for settlements and cities, path id for roads, devcard_type for devcard plays. INVALID_ID otherwise
+    int target = INVALID_ID;
+    // For maritime trades: the resource paid, how many of it are paid, and the resource received
+    tile_type give = TILE_EMPTY;
+    int give_amount = 0;
+    tile_type receive = TILE_EMPTY;
+};
+
+class ActionList {
+
+    public:
+        // 54 settlements + 5 cities + 72 roads + 1 purchase + 4 devcard plays + 20 trades + pass fits easily
+        static const int CAPACITY = 192;
+
+    private:
+        std::array<Action, CAPACITY> actions;
+        int count = 0;
+
+    public:
+
+        /**
+        * Requires: nothing
+        * Modifies: count
+        * Effects: empties the list without freeing anything
+        */
+        void clear();
+
+        /**
+        * Requires: action
+        * Modifies: actions, count
+        * Effects: adds the action to the end of the list. Ignored if the list is full
+        */
+        void push(const Action &action);
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the number of actions in the list
+        */
+        int size() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns if the list has no actions
+        */
+        bool empty() const;
+
+        /**
+        * Requires: index less than size()
+        * Modifies: nothing
+        * Effects: returns the action at the index
+        */
+        const Action& operator[](const int index) const;
+
+        /**
+        * Requires: action type
+        * Modifies: nothing
+        * Effects: returns how many actions of the type are in the list
+        */
+        int count_of(const action_type type) const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: iterators over the actions in the list, for range based for loops
+        */
+        const Action* begin() const;
+        const Action* end() const;
+};
+
+class LegalActionGenerator {
+
+    public:
+
+        /**
+        * Requires: board, the player whose turn it is, the game bank, list to fill
+        * Modifies: actions
+        * Effects: clears the list and fills it with every legal action for the player. Passing is always legal
+        */
+        static void generate(const Board &board, const Player &player, const GameBank &bank, ActionList &actions);
+
+        /**
+        * Requires: board, player, resource
+        * Modifies: nothing
+        * Effects: returns how many of the resource the player pays the bank for 1 resource (4, 3 with a universal port, or 2 with a matching port)
+        */
+        static int get_trade_rate(const Board &board, const Player &player, const tile_type resource);
+
+    private:
+
+        /**
+        * Requires: board, player, list to add to
+        * Modifies: actions
+        * Effects: adds every settlement, city, and road the player can afford, has pieces for, and has a place for
+        */
+        static void add_builds(const Board &board, const Player &player, ActionList &actions);
+
+        /**
+        * Requires: board, player, game bank, list to add to
+        * Modifies: actions
+        * Effects: adds buying a devcard if possible, and one play action per type of devcard which can be played
+        */
+        static void add_devcards(const Board &board, const Player &player, const GameBank &bank, ActionList &actions);
+
+        /**
+        * Requires: board, player, game bank, list to add to
+        * Modifies: actions
+        * Effects: adds every maritime trade the player can pay for which the bank can give
+        */
+        static void add_trades(const Board &board, const Player &player, const GameBank &bank, ActionList &actions);
+};
+
+#endif //LEGALACTIONGENERATOR_H
@@ -0,0 +1,103 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef LONGESTROADENGINE_H
+#define LONGESTROADENGINE_H
+
+#include <array>
+#include <vector>
+
+#include "BoardBitboards.h"
+
+/*
+ * The LongestRoadEngine keeps every player's longest road up to date as things are built.
+ *
+ * Each player's roads are split into connected components. Two roads are connected if they share a plot
+ * that has no opponent building on it, since an opponent's settlement or city breaks a road in two. Each
+ * component caches the length of its longest trail (a walk which never uses the same road twice), found
+ * with a depth first search over a mask of used paths.
+ *
+ * When a road is placed, only the components touching it are merged and searched again. When a building
+ * is placed, only the components running through that plot are split and searched again. Everything else
+ * keeps its cached length.
+ */
+
+struct RoadComponent {
+    PathMask roads;
+    int length = 0;
+};
+
+class LongestRoadEngine {
+
+    private:
+        std::array<std::vector<RoadComponent>, BoardBitboards::COLOR_COUNT> components;
+        std::array<int, BoardBitboards::COLOR_COUNT> lengths{};
+
+        /**
+        * Requires: bitboards, color, mask of paths which changed
+        * Modifies: components, lengths
+        * Effects: replaces every component of the color touching the changed paths with freshly split and
+        * measured components, then updates the color's length
+        */
+        void rebuild(const BoardBitboards &bitboards, const player_color color, const PathMask &changed);
+
+        /**
+        * Requires: bitboards, color
+        * Modifies: nothing
+        * Effects: returns the plots a road of the color can't continue through (plots with an opponent building)
+        */
+        static PlotMask get_broken_plots(const BoardBitboards &bitboards, const player_color color);
+
+        /**
+        * Requires: bitboards, plot the trail is at, roads it may use, roads already used, broken plots
+        * Modifies: nothing
+        * Effects: returns the length of the longest trail starting at the plot
+        */
+        static int trail_from(
+            const BoardBitboards &bitboards, const PlotId plot,
+            const PathMask &roads, const PathMask &used, const PlotMask broken);
+
+    public:
+
+        /* Updates */
+
+        /**
+        * Requires: bitboards which already have the road, path id, owner color
+        * Modifies: components, lengths
+        * Effects: merges the new road into the components it touches and measures the result
+        */
+        void road_placed(const BoardBitboards &bitboards, const PathId path, const player_color color);
+
+        /**
+        * Requires: bitboards which already have the building, plot id
+        * Modifies: components, lengths
+        * Effects: splits and measures again every component running through the plot
+        */
+        void building_placed(const BoardBitboards &bitboards, const PlotId plot);
+
+        /* Getters */
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns the length of the color's longest road, 0 for COLOR_EMPTY
+        */
+        int get_length(const player_color color) const;
+
+        /**
+        * Requires: color of a player
+        * Modifies: nothing
+        * Effects: returns the color's road components
+        */
+        const std::vector<RoadComponent>& get_components(const player_color color) const;
+
+        /**
+        * Requires: bitboards, roads of the color, color
+        * Modifies: nothing
+        * Effects: returns the length of the longest trail through the roads, not passing through opponent buildings
+        */
+        static int longest_trail(const BoardBitboards &bitboards, const PathMask &roads, const player_color color);
+};
+
+#endif //LONGESTROADENGINE_H
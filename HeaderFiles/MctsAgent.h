@@ -0,0 +1,128 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef MCTSAGENT_H
+#define MCTSAGENT_H
+
+#include <cstdint>
+
+#include "Agent.h"
+#include "GameState.h"
+
+class GameRandom;
+
+/*
+ * The MctsAgent picks its actions with Monte Carlo tree search over GameStates.
+ *
+ * Each decision grows a tree from the current state. A playout walks down the tree picking actions by UCT
+ * (every player picks what has worked best for them), adds one new action at the bottom, then plays the
+ * game on with the StatePolicy for a few dozen turns and scores it: 1 to the winner, or each player's share
+ * of the points if nobody won yet. Dice rolls and devcard draws are chance nodes: the outcome is rolled
+ * every playout and each outcome gets its own subtree, so the tree never assumes a roll it can't control.
+ * Opponents' devcards are hidden, so each playout deals them again from the cards the agent can't see.
+ *
+ * The search runs on every core at once over one shared tree. A thread walking through a node counts a
+ * virtual loss there until its playout is scored, which steers the other threads down different branches.
+ * The search stops when the time budget for the decision runs out.
+ *
+ * The same position is often reached by doing the same things in a different order (a road then a
+ * settlement, or the settlement first). The threads share a TranspositionTable keyed by GameState::hash, which
+ * each node on a playout's path updates with its mean reward, and a new node whose position is already in the
+ * table starts with a few visits' worth of what was found there. Opponents' devcards are dealt again every
+ * playout and are part of the hash, so positions only meet reliably while the opponents hold none.
+ *
+ * Choices the engine asks for in the middle of an action (discards, the robber, free roads...) and the
+ * initial placements are made by the StatePolicy without searching.
+ */
+
+struct MctsOptions {
+    // Time to think about each action, in milliseconds
+    int time_ms = 150;
+    // Threads searching each decision, 0 for one per core
+    int threads = 0;
+    // Stops the search after this many playouts, 0 for no limit
+    int max_playouts = 0;
+    // Turns a playout plays past the tree before it is scored on points
+    int playout_turns = 30;
+    // How much UCT favours trying less visited actions
+    double exploration = 0.7;
+    // log2 of the slots in the search's TranspositionTable, 0 for no table
+    int transposition_log2 = 16;
+};
+
+struct MctsResult {
+    Action action;
+    int playouts = 0;
+    // How many playouts went through the chosen action
+    int visits = 0;
+    // How many new nodes started from a position already in the TranspositionTable
+    int transpositions = 0;
+};
+
+class MctsAgent : public Agent {
+
+    private:
+        MctsOptions options;
+
+        /**
+        * Requires: board, player
+        * Modifies: nothing
+        * Effects: returns the game as the player sees it, with the player to move
+        */
+        static GameState observe(const Board &board, const std::shared_ptr<Player> &player);
+
+    public:
+
+        /**
+        * Requires: options (optional)
+        * Modifies: options
+        * Effects: Constructor for MctsAgent
+        */
+        explicit MctsAgent(const MctsOptions &_options = MctsOptions());
+
+        /**
+        * Requires: state with the searching player to move (not in the setup), seed for the playouts
+        * Modifies: nothing
+        * Effects: searches the state for the options' time and returns the action with the most playouts
+        */
+        MctsResult search(const GameState &state, const std::uint64_t seed) const;
+
+        PlotId choose_initial_settlement(Board &board, const std::shared_ptr<Player> &player) override;
+
+        PathId choose_initial_road(Board &board, const std::shared_ptr<Player> &player, const PlotId settlement) override;
+
+        /**
+        * Requires: board, player whose turn it is, legal actions
+        * Modifies: the player's game's random numbers
+        * Effects: returns the only legal action, or searches for the best one
+        */
+        Action choose_action(Board &board, const std::shared_ptr<Player> &player, const ActionList &legal_actions) override;
+
+        PathId choose_free_road(Board &board, const std::shared_ptr<Player> &player) override;
+
+        ResourceVector choose_discard(
+            Board &board, const std::shared_ptr<Player> &player, const int number_of_resources) override;
+
+        TileId choose_robber_tile(Board &board, const std::shared_ptr<Player> &player) override;
+
+        player_color choose_steal_target(
+            Board &board, const std::shared_ptr<Player> &player, const std::vector<player_color> &targets) override;
+
+        tile_type choose_resource(Board &board, const std::shared_ptr<Player> &player, const devcard_type reason) override;
+
+        bool respond_to_trade(
+            Board &board, const std::shared_ptr<Player> &player, const std::shared_ptr<Player> &proposer,
+            const ResourceVector &payment, const ResourceVector &gain) override;
+
+        /* Getters */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the agent's options
+        */
+        const MctsOptions& get_options() const;
+};
+
+#endif //MCTSAGENT_H
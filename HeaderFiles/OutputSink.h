@@ -0,0 +1,146 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef OUTPUTSINK_H
+#define OUTPUTSINK_H
+
+#include <cstddef>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+/*
+ * Everything the game prints goes to game_output(), the stream of the current OutputSink, instead of straight
+ * to std::cout. The sink keeps the text until it is flushed: at the end of each turn, after the board is
+ * displayed, when its buffer fills up, and before input is read if std::cin is tied to it. That is one write
+ * to the terminal for a whole turn's messages instead of one for every line.
+ *
+ * A sink with no target is silent: it counts what is written to it and throws it away, for games nobody is
+ * watching. Every sink counts the lines and bytes written to it and how many times it wrote to its target.
+ *
+ * Each thread has its own current sink, so games on different threads never share a buffer. Until a thread
+ * sets one, its current sink is a default one writing to std::cout.
+ */
+
+class OutputSink : public std::streambuf {
+
+    public:
+        // The buffered text is written out once there is this much of it
+        static const std::size_t BUFFER_SIZE = 1 << 14;
+
+    private:
+        std::ostream *target;
+        std::vector<char> buffer;
+        std::ostream stream;
+
+        std::size_t line_count = 0;
+        std::size_t byte_count = 0;
+        std::size_t flush_count = 0;
+
+    protected:
+
+        /**
+        * Requires: character
+        * Modifies: buffer, counts
+        * Effects: adds the character to the buffer
+        */
+        int_type overflow(int_type character) override;
+
+        /**
+        * Requires: characters, how many there are
+        * Modifies: buffer, counts
+        * Effects: adds the characters to the buffer
+        */
+        std::streamsize xsputn(const char *characters, std::streamsize count) override;
+
+        /**
+        * Requires: nothing
+        * Modifies: buffer, target
+        * Effects: flushes the sink, for std::flush and std::endl
+        */
+        int sync() override;
+
+    public:
+
+        /**
+        * Requires: stream to write to, or nullptr for a silent sink
+        * Modifies: target, buffer
+        * Effects: Constructor for OutputSink
+        */
+        explicit OutputSink(std::ostream *_target);
+
+        /**
+        * Requires: nothing
+        * Modifies: target
+        * Effects: Destructor for OutputSink, flushes what is left in the buffer
+        */
+        ~OutputSink() override;
+
+        OutputSink(const OutputSink &) = delete;
+        OutputSink& operator=(const OutputSink &) = delete;
+
+        /**
+        * Requires: nothing
+        * Modifies: buffer, target, flush_count
+        * Effects: writes the buffered text to the target and flushes it
+        */
+        void flush();
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the stream which writes to the sink
+        */
+        std::ostream& get_stream();
+
+        /* Getters */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns if the sink throws away what is written to it
+        */
+        bool is_silent() const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns how many lines, bytes and writes to the target there have been since the sink was made
+        */
+        std::size_t get_line_count() const;
+        std::size_t get_byte_count() const;
+        std::size_t get_flush_count() const;
+
+        /* Current sink */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns this thread's current sink
+        */
+        static OutputSink& get_current();
+
+        /**
+        * Requires: sink which outlives its use, or nullptr for the thread's default sink
+        * Modifies: this thread's current sink
+        * Effects: flushes the current sink and makes the given one current
+        */
+        static void set_current(OutputSink *sink);
+};
+
+/**
+* Requires: nothing
+* Modifies: nothing
+* Effects: returns the stream of this thread's current sink, which everything the game prints is written to
+*/
+std::ostream& game_output();
+
+/**
+* Requires: nothing
+* Modifies: this thread's current sink
+* Effects: flushes this thread's current sink, at the end of a turn or a frame
+*/
+void flush_game_output();
+
+#endif //OUTPUTSINK_H
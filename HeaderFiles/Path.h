@@ -34,6 +34,12 @@ class Path : public std::enable_shared_from_this<Path>{
 
 		std::set<std::shared_ptr<Path>> adjacent_paths;
 
+		// Index of the path in its board's path list and BoardGraph, INVALID_ID if it is not on a board
+		PathId id = INVALID_ID;
+
+		// Bitboards of the board this path is on, kept up to date when a road is placed. nullptr if it is not on a board
+		std::shared_ptr<BoardBitboards> bitboards;
+
     public:
 		/**
 		* Requires: endpoints, anchor_tile coordinates
@@ -42,6 +48,14 @@ class Path : public std::enable_shared_from_this<Path>{
 		*/
         Path(const EndpointPair _endpoints, const OrderedPair anchor_tile_coords);
 
+		/**
+		* Requires: endpoints, direction (-1, 0, or 1)
+		* Modifies: endpoints, direction
+		* Effects: Constructor for Path, sets endpoints and direction. Used when the direction is already
+		* known, like from the standard board tables
+		*/
+		Path(const EndpointPair _endpoints, const int _direction);
+
 		/**
 		* Requires: nothing
 		* Modifies: endpoints, direction
@@ -109,6 +123,13 @@ class Path : public std::enable_shared_from_this<Path>{
 		*/
 		bool has_adjacent_matching_road(const player_color color) const;
 
+		/**
+		* Requires: nothing
+		* Modifies: nothing
+		* Effects: returns the path's id on its board
+		*/
+		PathId get_id() const;
+
 		// Seperate function to calculate direction and store in direction field, as the direction never changes and the
 		// function is a tad heavy. This is called once in the constructor to initialize the field 'direction'
 		// It doesn't matter which adjacent tile the anchor_tile is because a path only has one direction no matter how you calculate it
@@ -146,6 +167,20 @@ class Path : public std::enable_shared_from_this<Path>{
 		*/
 		void add_to_adjacent_paths(std::shared_ptr<Path> &new_path);
 
+		/**
+		* Requires: id
+		* Modifies: id
+		* Effects: sets the path's id on its board
+		*/
+		void set_id(const PathId _id);
+
+		/**
+		* Requires: bitboards of the board the path is on
+		* Modifies: bitboards
+		* Effects: sets the bitboards which are updated when a road is placed on the path
+		*/
+		void set_bitboards(const std::shared_ptr<BoardBitboards> &_bitboards);
+
 };
 
 #endif //PATH_H
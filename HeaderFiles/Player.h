@@ -5,24 +5,20 @@
 #ifndef PLAYER_H
 #define PLAYER_H
 
+#include <cstdint>
 #include <set>
 #include <memory>
 #include <map>
 #include <vector>
 #include "Enums.h"
+#include "ResourceVector.h"
 #include "DevCard.h"
 #include "OrderedPair.h"
 
 class Board;
+class GameContext;
 class Path;
 
-/** FORWARD DEFINITION
-* Requires: player, number
-* Modifies: nothing
-* Effects: prompts the user to discard the given number of resources
-*/
-void discard_resources_prompt(std::shared_ptr<Player> player, int number_of_resources);
-
 /*
  * Player class stores all the info about a particular player
  */
@@ -33,11 +29,14 @@ class Player : public std::enable_shared_from_this<Player>{
         int ID;
         player_color color;
 
+        // The game this player is in, which owns it
+        GameContext *context;
+
         bool longest_road;
         bool largest_army;
 
         std::vector<DevCard> devcards;
-        std::map<tile_type, int> resource_cards;
+        ResourceVector resource_cards;
 
         // Paths stored as endpoint positions to avoid circular include nonsense.
         std::pair<OrderedPair, OrderedPair> first_road_path;
@@ -56,24 +55,49 @@ class Player : public std::enable_shared_from_this<Player>{
         const int MAX_SETTLEMENTS = 5;
         const int MAX_CITIES = 4;
 
+        /**
+        * Requires: resource, devcard type, change in how many the player holds
+        * Modifies: the game's hash
+        * Effects: hashes the change into the game's hash of the players' hands (see Zobrist.h), if the player
+        * is in a game. Called before the count changes
+        */
+        void hash_resource_change(const tile_type resource, const int change) const;
+        void hash_devcard_change(const devcard_type type, const int change) const;
+        void hash_knight_change(const int change) const;
+
+        /**
+        * Requires: devcard type
+        * Modifies: nothing
+        * Effects: returns how many cards of the type are in hand
+        */
+        int count_devcards(const devcard_type type) const;
+
     public:
 
         /**
-        * Requires: ID, color
-        * Modifies: ID, color, longest_road, largest_army, player_devcard_this_turn, number_of_knights,
+        * Requires: ID, color, the game the player is in
+        * Modifies: ID, color, context, longest_road, largest_army, player_devcard_this_turn, number_of_knights,
         * length_of_road, remaining_cities, remaining_settlements, remaining_roads
-        * Effects: Constructor for Player. Sets ID and color. Defaults everything else. resets resources
+        * Effects: Constructor for Player. Sets ID, color and game. Defaults everything else. resets resources
         */
-        Player(const int _ID, const player_color color);
+        Player(const int _ID, const player_color color, GameContext &_context);
 
         /**
         * Requires: nothing
         * Modifies: ID, color, longest_road, largest_army, player_devcard_this_turn, number_of_knights,
         * length_of_road, remaining_cities, remaining_settlements, remaining_roads
-        * Effects: Constructor for Player. Defaults everything. resets resources
+        * Effects: Constructor for Player. Defaults everything. resets resources. The player isn't in a game,
+        * so only its own fields may be used
         */
         Player();
 
+        /**
+        * Requires: the player is in a game
+        * Modifies: nothing
+        * Effects: returns the game the player is in
+        */
+        GameContext& get_context() const;
+
         /**
         * Requires: board, is_private
         * Modifies: nothing
@@ -133,7 +157,8 @@ class Player : public std::enable_shared_from_this<Player>{
         /**
         * Requires: board
         * Modifies: nothing
-        * Effects: calculates and returns the length of the road
+        * Effects: returns the length of the player's longest road on the board, from any of their road
+        * networks. Roads are broken by opponent buildings
         */
         int calculate_length_of_road(const Board &board);
 
@@ -144,32 +169,6 @@ class Player : public std::enable_shared_from_this<Player>{
         */
         int get_number_of_placed_roads(const Board &board) const;
 
-        /**
-        * Requires: path, excluded paths
-        * Modifies: nothing
-        * Effects: returns a set of valid paths (is occupied by a road of this players color)
-        */
-        std::set<std::shared_ptr<Path>> get_valid_adjacent_road_paths(
-            const std::shared_ptr<Path> path,
-            const std::set<std::shared_ptr<Path>> &exclude = {}) const;
-
-        /**
-        * Requires: start_path
-        * Modifies: nothing
-        * Effects: runs a pathfinding algorithm to return the length of the longest
-        * route between all paths connected to start_path
-        */
-        int road_length_helper(const std::shared_ptr<Path> start_path);
-
-        /**
-        * Requires: vector, path
-        * Modifies: nothing
-        * Effects: returns if the vector has the path in it
-        */
-        bool vector_has_path(
-            const std::vector<std::shared_ptr<Path>> &vec,
-            const std::shared_ptr<Path> &path) const;
-
         /**
         * Requires: length
         * Modifies: length_of_road
@@ -223,11 +222,12 @@ class Player : public std::enable_shared_from_this<Player>{
         void set_largest_army(const bool _largest_army);
 
         /**
-        * Requires: nothing
-        * Modifies: number_of_knights
-        * Effects: increments number_of_knights
+        * Requires: print (optional)
+        * Modifies: number_of_knights, largest army holders
+        * Effects: increments number_of_knights and takes the Largest Army if the player now has it,
+        * printing about it if print = true
         */
-        void gain_knight();
+        void gain_knight(const bool print = true);
 
         /**
         * Requires: nothing
@@ -237,11 +237,12 @@ class Player : public std::enable_shared_from_this<Player>{
         int get_number_of_knights() const;
 
         /**
-        * Requires: board, index
-        * Modifies: devcards
-        * Effects: plays devcard at index and removes it
+        * Requires: devcard type
+        * Modifies: devcards, played_devcard_this_turn
+        * Effects: removes a card of the type which wasn't bought this turn and marks a devcard as played.
+        * Returns false, changing nothing, if no such card can be played. The card's effect is up to the game engine
         */
-        void play_devcard(Board &board, const int index);
+        bool play_devcard(const devcard_type type);
 
         /**
         * Requires: devcard
@@ -290,7 +291,7 @@ class Player : public std::enable_shared_from_this<Player>{
         * Modifies: nothing
         * Effects: returns vector of devcards in hand
         */
-        std::vector<DevCard> get_devcards() const;
+        const std::vector<DevCard>& get_devcards() const;
 
          /**
         * Requires: nothing
@@ -307,13 +308,6 @@ class Player : public std::enable_shared_from_this<Player>{
         */
         void reset_resources();
 
-        /**
-        * Requires: nothing
-        * Modifies: nothing
-        * Effects: returns a map of the default resources in hand (0 of all)
-        */
-        static std::map<tile_type, int> get_base_resource_map();
-
         /**
         * Requires: resource
         * Modifies: resource_cards
@@ -328,8 +322,7 @@ class Player : public std::enable_shared_from_this<Player>{
         * bank if from_bank = true. Prints stuff id print is true
         */
         void gain_many_resources(
-            const std::map<tile_type,
-            int> resources,
+            const ResourceVector resources,
             const bool from_bank,
             const bool print = true);
 
@@ -338,7 +331,7 @@ class Player : public std::enable_shared_from_this<Player>{
         * Modifies: nothing
         * Effects: returns resource_cards
         */
-        std::map<tile_type, int> get_resources() const;
+        ResourceVector get_resources() const;
 
         /**
         * Requires: nothing
@@ -368,7 +361,7 @@ class Player : public std::enable_shared_from_this<Player>{
         * puts them in bank if to_bank = true
         */
         void discard_many_resources(
-            const std::map<tile_type, int> resources,
+            const ResourceVector resources,
             const std::string purpose,
             const bool to_bank,
             const bool print = true);
@@ -390,7 +383,7 @@ class Player : public std::enable_shared_from_this<Player>{
         /**
         * Requires: resource
         * Modifies: nothing
-        * Effects: returns if resource exists in players hand (is in map)
+        * Effects: returns if the resource is one a player can hold
         */
         bool resource_exists(const tile_type resource) const;
 
@@ -400,7 +393,7 @@ class Player : public std::enable_shared_from_this<Player>{
         * Effects: returns if the player can afford the provided
         * recipe and prints about it if print = true
         */
-        bool can_afford(std::map<tile_type, int> recipe, const bool print) const;
+        bool can_afford(const ResourceVector &recipe, const bool print) const;
 
         /**
         * Requires: color
@@ -451,14 +444,6 @@ class Player : public std::enable_shared_from_this<Player>{
         */
         int get_settlement_pieces() const;
 
-        /**
-        * Requires: nothing
-        * Modifies: nothing
-        * Effects: handles resources when a seven is rolled, prompting player to
-        * discard half of them rounded up if they have more than 7
-        */
-        void seven_rolled();
-
         /* Info Prints */
         /**
         * Requires: nothing
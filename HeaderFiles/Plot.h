@@ -11,6 +11,8 @@
 #include <set>
 #include "Building.h"
 #include "OrderedPair.h"
+#include "BoardGraph.h"
+#include "BoardBitboards.h"
 
 /*
 *
@@ -33,7 +35,13 @@ class Plot{
 		std::set<OrderedPair> adjacent_tile_coords;
 
 		tile_type port_type = TILE_EMPTY;
-		bool universal_port;
+		bool universal_port = false;
+
+		// Index of the plot in its board's plot list and BoardGraph, INVALID_ID if it is not on a board
+		PlotId id = INVALID_ID;
+
+		// Bitboards of the board this plot is on, kept up to date when a building is placed. nullptr if it is not on a board
+		std::shared_ptr<BoardBitboards> bitboards;
 
     public:
 		/**
@@ -130,6 +138,13 @@ class Plot{
 		*/
 		std::map<int, std::shared_ptr<Plot>> get_adjacent_plots() const;
 
+		/**
+		* Requires: nothing
+		* Modifies: nothing
+		* Effects: returns the plot's id on its board
+		*/
+		PlotId get_id() const;
+
         /* Setters */
 		/**
 		* Requires: new building
@@ -138,6 +153,13 @@ class Plot{
 		*/
         void set_inhabitant(Building new_inhabitant);
 
+		/**
+		* Requires: a settlement on the plot
+		* Modifies: inhabitant, bitboards
+		* Effects: upgrades the settlement on the plot to a city
+		*/
+		void upgrade_inhabitant();
+
 		/**
 		* Requires: icon_override string
 		* Modifies: icon_override
@@ -159,6 +181,20 @@ class Plot{
 		*/
 		void add_to_adjacent_tiles(const OrderedPair coords);
 
+		/**
+		* Requires: id
+		* Modifies: id
+		* Effects: sets the plot's id on its board
+		*/
+		void set_id(const PlotId _id);
+
+		/**
+		* Requires: bitboards of the board the plot is on
+		* Modifies: bitboards
+		* Effects: sets the bitboards which are updated when a building is placed on the plot
+		*/
+		void set_bitboards(const std::shared_ptr<BoardBitboards> &_bitboards);
+
 };
 
 #endif //PLOT_H
@@ -0,0 +1,153 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef PRODUCTIONTABLE_H
+#define PRODUCTIONTABLE_H
+
+#include <array>
+#include <vector>
+
+#include "BoardGraph.h"
+#include "Enums.h"
+
+/*
+ * The ProductionTable lists, for every dice roll, what each player receives when it is rolled.
+ *
+ * A roll used to check every tile's number and then every tile's plots for every color. Instead, each roll
+ * keeps a short list of (color, resource, amount) entries, already summed over every producing tile. The
+ * table is kept up to date as things change: a settlement or city adds its production to the rolls of the
+ * tiles around it, and moving the robber takes a tile's production off its roll and puts the previous
+ * tile's back. Producing resources for a roll is then one pass over its list.
+ */
+
+struct ProductionEntry {
+    player_color color = COLOR_EMPTY;
+    tile_type resource = TILE_EMPTY;
+    int amount = 0;
+};
+
+class ProductionTable {
+
+    public:
+        static const int COLOR_COUNT = 4;
+        static const int MIN_ROLL = 2;
+        static const int MAX_ROLL = 12;
+
+    private:
+        static const int ROLL_COUNT = MAX_ROLL - MIN_ROLL + 1;
+        static const int RESOURCE_COUNT = TILE_EMPTY;
+
+        // What each color gets from each resource on each roll, and the same thing as a list of the non-zero amounts
+        std::array<std::array<std::array<int, RESOURCE_COUNT>, COLOR_COUNT>, ROLL_COUNT> amounts{};
+        std::array<std::vector<ProductionEntry>, ROLL_COUNT> entries;
+        // Tiles with each number, robbed or not
+        std::array<std::vector<TileId>, ROLL_COUNT> roll_tiles;
+
+        // Tile info, indexed by tile id
+        std::vector<tile_type> tile_types;
+        std::vector<int> tile_numbers;
+        std::vector<std::array<PlotId, BoardGraph::TILE_DEGREE>> tile_plots;
+
+        // Building info, indexed by plot id
+        std::vector<player_color> plot_colors;
+        std::vector<int> plot_production;
+        std::vector<std::vector<TileId>> plot_tiles;
+
+        TileId robber_tile = INVALID_ID;
+
+        /**
+        * Requires: number
+        * Modifies: nothing
+        * Effects: returns if a tile with the number can produce anything (2-12, but not 7)
+        */
+        static bool is_production_number(const int number);
+
+        /**
+        * Requires: tile id
+        * Modifies: nothing
+        * Effects: returns if the tile currently produces: it has a resource and a number, and no robber
+        */
+        bool is_producing(const TileId tile) const;
+
+        /**
+        * Requires: producing tile id, color, amount to add (negative to take away)
+        * Modifies: amounts
+        * Effects: adds the amount of the tile's resource to what the color gets on the tile's roll
+        */
+        void add_amount(const TileId tile, const player_color color, const int amount);
+
+        /**
+        * Requires: tile id, 1 to add the tile's production or -1 to take it away
+        * Modifies: amounts, entries
+        * Effects: adds or takes away everything the buildings around the tile get from it
+        */
+        void apply_tile(const TileId tile, const int sign);
+
+        /**
+        * Requires: roll
+        * Modifies: entries
+        * Effects: rebuilds the roll's list from its amounts
+        */
+        void rebuild_entries(const int roll);
+
+    public:
+
+        /**
+        * Requires: number of plots on the board
+        * Modifies: plot info
+        * Effects: Constructor for ProductionTable. No tiles or buildings yet, so every roll produces nothing
+        */
+        explicit ProductionTable(const int plot_count);
+
+        /* Updates */
+
+        /**
+        * Requires: tile id, tile type, production number, the tile's plots
+        * Modifies: tile info, plot_tiles, amounts, entries, roll_tiles
+        * Effects: records the tile, replacing what was recorded for it if it was set before. Done once for each
+        * tile when the board is created
+        */
+        void set_tile(
+            const TileId tile, const tile_type type, const int number,
+            const std::array<PlotId, BoardGraph::TILE_DEGREE> &plots);
+
+        /**
+        * Requires: plot id, owner color, building type
+        * Modifies: plot_colors, plot_production, amounts, entries
+        * Effects: replaces the production of whatever was on the plot with that of the new building
+        */
+        void building_placed(const PlotId plot, const player_color color, const building_type type);
+
+        /**
+        * Requires: tile id the robber moved to
+        * Modifies: robber_tile, amounts, entries
+        * Effects: the previous robber tile produces again, and the new one stops producing
+        */
+        void robber_moved(const TileId tile);
+
+        /* Getters */
+
+        /**
+        * Requires: roll
+        * Modifies: nothing
+        * Effects: returns what every color gets on the roll, ordered by color then resource. Empty for 7 or invalid rolls
+        */
+        const std::vector<ProductionEntry>& get_production(const int roll) const;
+
+        /**
+        * Requires: roll
+        * Modifies: nothing
+        * Effects: returns the ids of the tiles with the roll as their number, including one with the robber
+        */
+        const std::vector<TileId>& get_tiles(const int roll) const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the id of the tile with the robber, or INVALID_ID
+        */
+        TileId get_robber_tile() const;
+};
+
+#endif //PRODUCTIONTABLE_H
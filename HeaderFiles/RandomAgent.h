@@ -0,0 +1,64 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef RANDOMAGENT_H
+#define RANDOMAGENT_H
+
+#include <cstdint>
+
+#include "Agent.h"
+
+class GameRandom;
+struct PathMask;
+
+/*
+ * The RandomAgent picks uniformly at random (with the random numbers of the player's game) from whatever is
+ * legal. It prints nothing and never waits on input, so games between RandomAgents run as fast as the engine
+ * can apply them. It keeps no state, so one can play in any number of games at once. It is the baseline for
+ * automated play and what the tests use to play whole games.
+ */
+
+class RandomAgent : public Agent {
+
+    private:
+
+        /**
+        * Requires: random numbers, mask
+        * Modifies: random
+        * Effects: returns the index of a random set bit of the mask, or INVALID_ID if none are set
+        */
+        static int random_bit(GameRandom &random, std::uint64_t mask);
+        static int random_bit(GameRandom &random, const PathMask &mask);
+
+    public:
+
+        PlotId choose_initial_settlement(Board &board, const std::shared_ptr<Player> &player) override;
+
+        PathId choose_initial_road(Board &board, const std::shared_ptr<Player> &player, const PlotId settlement) override;
+
+        Action choose_action(Board &board, const std::shared_ptr<Player> &player, const ActionList &legal_actions) override;
+
+        PathId choose_free_road(Board &board, const std::shared_ptr<Player> &player) override;
+
+        ResourceVector choose_discard(
+            Board &board, const std::shared_ptr<Player> &player, const int number_of_resources) override;
+
+        TileId choose_robber_tile(Board &board, const std::shared_ptr<Player> &player) override;
+
+        player_color choose_steal_target(
+            Board &board, const std::shared_ptr<Player> &player, const std::vector<player_color> &targets) override;
+
+        tile_type choose_resource(Board &board, const std::shared_ptr<Player> &player, const devcard_type reason) override;
+
+        /**
+        * Requires: board, player, proposer, payment, gain
+        * Modifies: nothing
+        * Effects: accepts half of the trades the player can afford
+        */
+        bool respond_to_trade(
+            Board &board, const std::shared_ptr<Player> &player, const std::shared_ptr<Player> &proposer,
+            const ResourceVector &payment, const ResourceVector &gain) override;
+};
+
+#endif //RANDOMAGENT_H
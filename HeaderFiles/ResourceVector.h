@@ -0,0 +1,172 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef RESOURCEVECTOR_H
+#define RESOURCEVECTOR_H
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+#include "Enums.h"
+
+/*
+ * A ResourceVector is an amount of each of the five resources: a hand, the bank's piles, a recipe or one side
+ * of a trade. The amounts are packed into one 64 bit word, one byte lane per resource, so adding, taking away,
+ * comparing and totalling them are a few integer operations on the whole word instead of a walk over a map.
+ *
+ * Amounts are between 0 and MAX_AMOUNT. Keeping the top bit of each lane clear lets covers and capped_at compare
+ * every lane at once: with it set before a subtraction, a lane can't borrow from the one above, and whether it
+ * is still set afterwards says which side was bigger.
+ */
+
+class ResourceVector {
+
+    public:
+        static constexpr int LANE_COUNT = 5;
+        // There are only 19 of each resource, so this is never reached in a game
+        static constexpr int MAX_AMOUNT = 127;
+
+    private:
+        // Lane i (bits 8i to 8i + 7) is the amount of the resource i + GRAIN. Bits 40-63 are always 0
+        std::uint64_t lanes = 0;
+
+        static constexpr std::uint64_t LANE_ONES = 0x0101010101;
+        static constexpr std::uint64_t LANE_HIGH_BITS = 0x8080808080;
+
+        explicit constexpr ResourceVector(const std::uint64_t _lanes) : lanes(_lanes) {}
+
+        static constexpr int lane_shift(const tile_type type) { return 8 * (type - GRAIN); }
+
+        // Lanes where this amount is at least the other's
+        constexpr std::uint64_t lanes_at_least(const ResourceVector &other) const {
+            return ((lanes | LANE_HIGH_BITS) - other.lanes) & LANE_HIGH_BITS;
+        }
+
+    public:
+        constexpr ResourceVector() = default;
+
+        /**
+        * Requires: resources and their amounts. Anything that isn't a resource is left out
+        * Modifies: lanes
+        * Effects: Constructor for ResourceVector, so {{BRICK, 1}, {LUMBER, 1}} is a road's recipe
+        */
+        constexpr ResourceVector(std::initializer_list<std::pair<tile_type, int>> amounts) {
+            for (const std::pair<tile_type, int> &amount : amounts) {
+                add(amount.first, amount.second);
+            }
+        }
+
+        /**
+        * Requires: amount
+        * Modifies: nothing
+        * Effects: returns a vector with the amount of every resource
+        */
+        static constexpr ResourceVector filled(const int amount) {
+            return ResourceVector(LANE_ONES * static_cast<std::uint64_t>(clamp_amount(amount)));
+        }
+
+        /**
+        * Requires: type
+        * Modifies: nothing
+        * Effects: returns if the type is a resource, with a lane of its own
+        */
+        static constexpr bool is_resource(const tile_type type) { return type >= GRAIN && type <= LUMBER; }
+
+        /**
+        * Requires: amount
+        * Modifies: nothing
+        * Effects: returns the amount brought into 0 to MAX_AMOUNT
+        */
+        static constexpr int clamp_amount(const int amount) { return amount < 0 ? 0 : amount > MAX_AMOUNT ? MAX_AMOUNT : amount; }
+
+        /**
+        * Requires: type
+        * Modifies: nothing
+        * Effects: returns the amount of the resource, 0 if the type isn't a resource
+        */
+        constexpr int get(const tile_type type) const {
+            return is_resource(type) ? static_cast<int>((lanes >> lane_shift(type)) & 0xFF) : 0;
+        }
+
+        /**
+        * Requires: type, amount
+        * Modifies: lanes
+        * Effects: sets the amount of the resource, kept between 0 and MAX_AMOUNT. Does nothing if the type
+        * isn't a resource
+        */
+        constexpr void set(const tile_type type, const int amount) {
+            if (!is_resource(type)) {
+                return;
+            }
+            int shift = lane_shift(type);
+            lanes = (lanes & ~(std::uint64_t(0xFF) << shift)) | (static_cast<std::uint64_t>(clamp_amount(amount)) << shift);
+        }
+
+        /**
+        * Requires: type, change (may be negative)
+        * Modifies: lanes
+        * Effects: changes the amount of the resource, kept between 0 and MAX_AMOUNT
+        */
+        constexpr void add(const tile_type type, const int change) { set(type, get(type) + change); }
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the amounts added up
+        */
+        constexpr int get_total() const {
+            // Add neighbouring lanes into 16 bit lanes, then all of those into the top one with a multiply
+            std::uint64_t pairs = (lanes & 0x00FF00FF00FF) + ((lanes >> 8) & 0x00FF00FF00FF);
+            return static_cast<int>(((pairs * 0x000100010001) >> 32) & 0xFFFF);
+        }
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns if every amount is 0
+        */
+        constexpr bool is_empty() const { return lanes == 0; }
+
+        /**
+        * Requires: other vector
+        * Modifies: nothing
+        * Effects: returns if every amount is at least the other's, so a hand covers a recipe it can afford
+        */
+        constexpr bool covers(const ResourceVector &other) const { return lanes_at_least(other) == LANE_HIGH_BITS; }
+
+        /**
+        * Requires: cap
+        * Modifies: nothing
+        * Effects: returns the smaller of this and the cap's amount of each resource
+        */
+        constexpr ResourceVector capped_at(const ResourceVector &cap) const {
+            // Widen each lane's compare bit into a whole lane of 1s, then pick the cap's lane where it's set
+            std::uint64_t take_cap = (lanes_at_least(cap) >> 7) * 0xFF;
+            return ResourceVector((cap.lanes & take_cap) | (lanes & ~take_cap));
+        }
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the packed lanes, the amount of resource i + GRAIN in bits 8i to 8i + 7
+        */
+        constexpr std::uint64_t get_lanes() const { return lanes; }
+
+        // Amounts must stay at most MAX_AMOUNT when added. Taking away stops each amount at 0
+        constexpr ResourceVector operator+(const ResourceVector &other) const { return ResourceVector(lanes + other.lanes); }
+        constexpr ResourceVector operator-(const ResourceVector &other) const {
+            return ResourceVector(lanes - capped_at(other).lanes);
+        }
+        constexpr ResourceVector& operator+=(const ResourceVector &other) { lanes += other.lanes; return *this; }
+        constexpr ResourceVector& operator-=(const ResourceVector &other) { lanes -= capped_at(other).lanes; return *this; }
+        constexpr bool operator==(const ResourceVector &other) const { return lanes == other.lanes; }
+        constexpr bool operator!=(const ResourceVector &other) const { return lanes != other.lanes; }
+};
+
+// The resources, in the order of their lanes
+const std::array<tile_type, ResourceVector::LANE_COUNT> RESOURCE_TYPES = {GRAIN, WOOL, BRICK, ORE, LUMBER};
+
+#endif //RESOURCEVECTOR_H
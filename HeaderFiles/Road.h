@@ -48,7 +48,7 @@ class Road : public Construct{
 		* Modifies: nothing
 		* Effects: returns the recipe for a road
 		*/
-		std::map<tile_type, int> get_recipe() const override;
+		ResourceVector get_recipe() const override;
 
 		/**
 		* Requires: icon_override (optional)
@@ -0,0 +1,110 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef SCORETRACKER_H
+#define SCORETRACKER_H
+
+#include <array>
+
+#include "Enums.h"
+
+class BoardBitboards;
+
+/*
+ * The ScoreTracker keeps everything victory points are made of, so scores are read instead of counted.
+ *
+ * Settlements and cities are already kept per color in the board's bitboards, so their points are two
+ * popcounts. Victory point cards and the Longest Road / Largest Army holders are updated here when a card
+ * is gained or a title changes hands, so neither the players' hands nor the list of players is scanned.
+ */
+
+class ScoreTracker {
+
+    public:
+        static const int COLOR_COUNT = 4;
+
+        static const int SETTLEMENT_POINTS = 1;
+        static const int CITY_POINTS = 2;
+        static const int TITLE_POINTS = 2;
+        static const int WINNING_POINTS = 10;
+
+    private:
+        std::array<int, COLOR_COUNT> victory_point_cards{};
+
+        player_color longest_road_holder = COLOR_EMPTY;
+        player_color largest_army_holder = COLOR_EMPTY;
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns if the color belongs to a player (it isn't COLOR_EMPTY)
+        */
+        static bool is_player_color(const player_color color);
+
+    public:
+
+        /* Updates */
+
+        /**
+        * Requires: color
+        * Modifies: victory_point_cards
+        * Effects: counts one more victory point card in the color's hand
+        */
+        void add_victory_point_card(const player_color color);
+
+        /**
+        * Requires: color, whether the color holds the title
+        * Modifies: longest_road_holder / largest_army_holder
+        * Effects: makes the color the holder of the title, or clears the title if the color gave it up
+        */
+        void set_longest_road(const player_color color, const bool holds);
+        void set_largest_army(const player_color color, const bool holds);
+
+        /**
+        * Requires: nothing
+        * Modifies: victory_point_cards, longest_road_holder, largest_army_holder
+        * Effects: forgets every card and title
+        */
+        void reset();
+
+        /* Getters */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the color holding the title, or COLOR_EMPTY if nobody has it
+        */
+        player_color get_longest_road_holder() const;
+        player_color get_largest_army_holder() const;
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns the number of victory point cards in the color's hand
+        */
+        int get_victory_point_cards(const player_color color) const;
+
+        /**
+        * Requires: board bitboards, color
+        * Modifies: nothing
+        * Effects: returns the points from the color's settlements and cities
+        */
+        static int get_building_points(const BoardBitboards &bitboards, const player_color color);
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns the points from the titles the color holds
+        */
+        int get_title_points(const player_color color) const;
+
+        /**
+        * Requires: board bitboards, color, is_private
+        * Modifies: nothing
+        * Effects: returns the color's victory points, including victory point cards if is_private = true
+        */
+        int get_points(const BoardBitboards &bitboards, const player_color color, const bool is_private = true) const;
+};
+
+#endif //SCORETRACKER_H
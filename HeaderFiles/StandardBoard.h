@@ -0,0 +1,208 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef STANDARDBOARD_H
+#define STANDARDBOARD_H
+
+#include <array>
+
+/*
+ * StandardBoard holds the topology of the standard 19 tile board as constexpr tables.
+ *
+ * The layout of tiles, plots and paths is the same every game, so instead of walking the hex grid when a
+ * board is created, everything is generated once by the compiler: coordinates, which plots and paths
+ * surround each tile, plot -> plot adjacency, path endpoints and directions, and which plots share a port.
+ * Ids match the order Board has always created things in (tiles ring by ring, plots and paths the first
+ * time a tile touches them), so they line up with the ids in BoardGraph.
+ */
+
+namespace StandardBoard {
+
+    // Plain coordinate, because OrderedPair can't be used in a constant expression
+    struct Point {
+        int x;
+        int y;
+    };
+
+    constexpr int TILE_COUNT = 19;
+    constexpr int PLOT_COUNT = 54;
+    constexpr int PATH_COUNT = 72;
+    constexpr int PORT_COUNT = 9;
+
+    constexpr int NO_PORT = -1;
+
+    // Ring 'a' has 1 tile, 'b' has 6, 'c' has 12. Tiles in a ring are numbered from RING_OFFSETS
+    constexpr std::array<int, 3> RING_SIZES = {1, 6, 12};
+    constexpr std::array<int, 3> RING_OFFSETS = {0, 1, 7};
+
+    // Tile coordinates in creation order: a,a, then b,a -> b,f, then c,a -> c,l (clockwise from the top)
+    constexpr std::array<Point, TILE_COUNT> TILE_COORDINATES = {{
+        {0, 0},
+        {0, 2}, {2, 1}, {2, -1}, {0, -2}, {-2, -1}, {-2, 1},
+        {0, 4}, {2, 3}, {4, 2}, {4, 0}, {4, -2}, {2, -3},
+        {0, -4}, {-2, -3}, {-4, -2}, {-4, 0}, {-4, 2}, {-2, 3}}};
+
+    // Offsets from a tile to its 6 plots. Path i of a tile runs from plot i to plot (i + 1) % 6
+    constexpr std::array<Point, 6> TILE_PLOT_OFFSETS = {{{-1, 1}, {1, 1}, {1, 0}, {1, -1}, {-1, -1}, {-1, 0}}};
+
+    // The plots on either side of each port
+    constexpr std::array<std::array<Point, 2>, PORT_COUNT> PORT_PLOT_COORDINATES = {{
+        {{{-1, 5}, {1, 5}}},
+        {{{3, 3}, {3, 4}}},
+        {{{5, 1}, {5, 0}}},
+        {{{5, -2}, {5, -3}}},
+        {{{1, -4}, {3, -4}}},
+        {{{-1, -4}, {-3, -4}}},
+        {{{-5, -2}, {-5, -3}}},
+        {{{-5, 0}, {-5, 1}}},
+        {{{-3, 3}, {-3, 4}}}}};
+
+    struct Topology {
+        std::array<Point, PLOT_COUNT> plot_coordinates{};
+        // Slot 0 is the plot above, slot 1 the plot below, slot 2 the plot to the side. -1 if there is none
+        std::array<std::array<int, 3>, PLOT_COUNT> plot_plots{};
+        // Index into PORT_PLOT_COORDINATES of the port the plot is on, or NO_PORT
+        std::array<int, PLOT_COUNT> plot_port{};
+
+        std::array<std::array<int, 2>, PATH_COUNT> path_plots{};
+        std::array<int, PATH_COUNT> path_direction{};
+
+        std::array<std::array<int, 6>, TILE_COUNT> tile_plots{};
+        std::array<std::array<int, 6>, TILE_COUNT> tile_paths{};
+
+        // How many plots and paths the tiles actually created, checked against PLOT_COUNT and PATH_COUNT
+        int plots_created = 0;
+        int paths_created = 0;
+    };
+
+    /**
+    * Requires: two plot coordinates relative to a tile's center
+    * Modifies: nothing
+    * Effects: returns the direction of the path between them (-1 angled down, 1 angled up, 0 flat).
+    * Same rule as Path::calculate_direction, in integers
+    */
+    constexpr int local_direction(Point a, Point b) {
+        // (1, 0) and (-1, 0) are drawn twice as far out as their x says, see Path::calculate_direction
+        if (a.x % 2 != 0 && a.y % 2 == 0) {
+            a.x *= 2;
+        }
+        if (b.x % 2 != 0 && b.y % 2 == 0) {
+            b.x *= 2;
+        }
+        int rise = a.y - b.y;
+        int run = a.x - b.x;
+        if (rise == 0) {
+            return 0;
+        }
+        return (rise > 0) == (run > 0) ? 1 : -1;
+    }
+
+    /**
+    * Requires: nothing
+    * Modifies: nothing
+    * Effects: builds the topology by replaying create_board's creation order
+    */
+    constexpr Topology build_topology() {
+        Topology t{};
+        int plot_count = 0;
+        int path_count = 0;
+
+        for (int tile = 0; tile < TILE_COUNT; tile++) {
+            Point center = TILE_COORDINATES[tile];
+
+            // Plots around the tile, reusing ones an earlier tile already made
+            for (int i = 0; i < 6; i++) {
+                Point position = {center.x + TILE_PLOT_OFFSETS[i].x, center.y + TILE_PLOT_OFFSETS[i].y};
+                int found = -1;
+                for (int p = 0; p < plot_count; p++) {
+                    if (t.plot_coordinates[p].x == position.x && t.plot_coordinates[p].y == position.y) {
+                        found = p;
+                    }
+                }
+                if (found == -1) {
+                    found = plot_count;
+                    t.plot_coordinates[plot_count] = position;
+                    plot_count++;
+                }
+                t.tile_plots[tile][i] = found;
+            }
+
+            // Paths around the tile, reusing ones an earlier tile already made
+            for (int a = 0; a < 6; a++) {
+                int b = (a + 1) % 6;
+                int plot_a = t.tile_plots[tile][a];
+                int plot_b = t.tile_plots[tile][b];
+                int found = -1;
+                for (int p = 0; p < path_count; p++) {
+                    if ((t.path_plots[p][0] == plot_a && t.path_plots[p][1] == plot_b) ||
+                        (t.path_plots[p][0] == plot_b && t.path_plots[p][1] == plot_a)) {
+                        found = p;
+                    }
+                }
+                if (found == -1) {
+                    found = path_count;
+                    t.path_plots[path_count] = {plot_a, plot_b};
+                    t.path_direction[path_count] = local_direction(TILE_PLOT_OFFSETS[a], TILE_PLOT_OFFSETS[b]);
+                    path_count++;
+                }
+                t.tile_paths[tile][a] = found;
+            }
+        }
+        t.plots_created = plot_count;
+        t.paths_created = path_count;
+
+        for (int plot = 0; plot < PLOT_COUNT; plot++) {
+            Point position = t.plot_coordinates[plot];
+
+            // The side neighbour flips between left and right with every step across the grid, starting
+            // from (-1, 0) whose side neighbour is on the left
+            int steps = (position.x + 1) / 2 + position.y;
+            int side_x = (steps % 2 == 0) ? -2 : 2;
+            Point neighbours[3] = {{position.x, position.y + 1}, {position.x, position.y - 1},
+                {position.x + side_x, position.y}};
+
+            for (int slot = 0; slot < 3; slot++) {
+                t.plot_plots[plot][slot] = -1;
+                for (int other = 0; other < PLOT_COUNT; other++) {
+                    if (t.plot_coordinates[other].x == neighbours[slot].x &&
+                        t.plot_coordinates[other].y == neighbours[slot].y) {
+                        t.plot_plots[plot][slot] = other;
+                    }
+                }
+            }
+
+            t.plot_port[plot] = NO_PORT;
+            for (int port = 0; port < PORT_COUNT; port++) {
+                for (const Point &port_plot : PORT_PLOT_COORDINATES[port]) {
+                    if (port_plot.x == position.x && port_plot.y == position.y) {
+                        t.plot_port[plot] = port;
+                    }
+                }
+            }
+        }
+
+        return t;
+    }
+
+    constexpr Topology TOPOLOGY = build_topology();
+
+    /**
+    * Requires: ring and letter of a tile position id (ex. 'b' and 'c' for "b,c")
+    * Modifies: nothing
+    * Effects: returns the id of the tile at that position, or -1 if there is no such tile
+    */
+    constexpr int tile_index(const char ring, const char letter) {
+        int ring_index = ring - 'a';
+        int letter_index = letter - 'a';
+        if (ring_index < 0 || ring_index > 2 || letter_index < 0 || letter_index >= RING_SIZES[ring_index]) {
+            return -1;
+        }
+        return RING_OFFSETS[ring_index] + letter_index;
+    }
+
+    static_assert(TOPOLOGY.plots_created == PLOT_COUNT, "standard board should have exactly 54 plots");
+    static_assert(TOPOLOGY.paths_created == PATH_COUNT, "standard board should have exactly 72 paths");
+}
+
+#endif //STANDARDBOARD_H
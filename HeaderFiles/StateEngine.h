@@ -0,0 +1,202 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef STATEENGINE_H
+#define STATEENGINE_H
+
+#include "BoardBitboards.h"
+#include "Enums.h"
+#include "GameState.h"
+#include "LegalActionGenerator.h"
+
+class GameRandom;
+
+/*
+ * The StateEngine plays the rules on a GameState instead of a Board and GameContext, so a search can copy
+ * the state and try moves on it thousands of times a second.
+ *
+ * The rules are the GameEngine's: the same legal actions (in the LegalActionGenerator's order, except that
+ * devcard plays are listed by type rather than by their order in hand), the same production capped by the
+ * bank, discards and the robber on a 7, the same devcards, and the same rules for handing over Longest Road
+ * and Largest Army. Choices the GameEngine would ask an Agent for in the middle of an action (where the
+ * robber goes, which roads Road Building places...) are made by the StatePolicy.
+ *
+ * A turn is start_turn with the roll, any number of apply_action, then end_turn. Initial placements aren't
+ * played here, states are taken after the setup.
+ */
+
+class StateEngine {
+
+    public:
+        // Stops a turn whose player never passes, same as GameEngine::MAX_ACTIONS_PER_TURN
+        static const int MAX_ACTIONS_PER_TURN = 200;
+
+        /**
+        * Requires: state, list to fill
+        * Modifies: actions
+        * Effects: clears the list and fills it with every legal action for the current player. Passing is always legal
+        */
+        static void generate(const GameState &state, ActionList &actions);
+
+        /**
+        * Requires: random numbers
+        * Modifies: random
+        * Effects: returns the sum of two dice
+        */
+        static int roll_dice(GameRandom &random);
+
+        /**
+        * Requires: state, roll of the dice, random numbers
+        * Modifies: state, random
+        * Effects: starts the current player's turn: devcards bought last turn become playable, then the roll
+        * produces resources, or makes players discard and the current player move the robber if it is a 7
+        */
+        static void start_turn(GameState &state, const int roll, GameRandom &random);
+
+        /**
+        * Requires: state, legal action for the current player, random numbers
+        * Modifies: state, random
+        * Effects: applies the action and records the current player as the winner if it got them to 10 points.
+        * Returns the devcard drawn if the action bought one, CARD_EMPTY otherwise
+        */
+        static devcard_type apply_action(GameState &state, const Action &action, GameRandom &random);
+
+        /**
+        * Requires: state
+        * Modifies: state
+        * Effects: ends the current player's turn and passes it to the next player
+        */
+        static void end_turn(GameState &state);
+
+        /* Getters */
+
+        /**
+        * Requires: state, color, whether the plot has to be at the end of one of the color's roads
+        * Modifies: nothing
+        * Effects: returns the plots the color could build a settlement on
+        */
+        static PlotMask get_buildable_plots(const GameState &state, const player_color color, const bool needs_road);
+
+        /**
+        * Requires: state, color
+        * Modifies: nothing
+        * Effects: returns the empty paths next to one of the color's roads
+        */
+        static PathMask get_buildable_paths(const GameState &state, const player_color color);
+
+        /**
+        * Requires: state, color, resource
+        * Modifies: nothing
+        * Effects: returns how many of the resource the color pays the bank for 1 resource
+        */
+        static int get_trade_rate(const GameState &state, const player_color color, const tile_type resource);
+
+        /**
+        * Requires: state, color
+        * Modifies: nothing
+        * Effects: returns the length of the color's longest road, not passing through opponent buildings
+        */
+        static int get_road_length(const GameState &state, const player_color color);
+
+        /**
+        * Requires: tile id / plot id / path id
+        * Modifies: nothing
+        * Effects: returns the plots around the tile, the plots next to the plot, the paths touching the plot,
+        * or the two plots at the ends of the path
+        */
+        static PlotMask get_tile_plots(const TileId tile);
+        static PlotMask get_plot_plots(const PlotId plot);
+        static PathMask get_plot_paths(const PlotId plot);
+        static PlotMask get_path_plots(const PathId path);
+
+        /**
+        * Requires: state, plot id
+        * Modifies: nothing
+        * Effects: returns how many of the 36 rolls of two dice make the tiles around the plot produce
+        */
+        static int get_plot_pips(const GameState &state, const PlotId plot);
+
+        /**
+        * Requires: state, tile id
+        * Modifies: nothing
+        * Effects: returns how many of the 36 rolls of two dice make the tile produce (0 for the desert)
+        */
+        static int get_tile_pips(const GameState &state, const TileId tile);
+
+    private:
+
+        /**
+        * Requires: state, color, resource, amount
+        * Modifies: state
+        * Effects: moves as many of the amount from the bank to the color's hand as the bank has
+        */
+        static void take_from_bank(GameState &state, const player_color color, const tile_type resource, const int amount);
+
+        /**
+        * Requires: state, color, amounts of grain, wool, brick, ore and lumber
+        * Modifies: state
+        * Effects: moves the resources from the color's hand back to the bank
+        */
+        static void pay(GameState &state, const player_color color,
+            const int grain, const int wool, const int brick, const int ore, const int lumber);
+
+        /**
+        * Requires: state, roll
+        * Modifies: state
+        * Effects: gives every player the production of the roll's tiles, except the robber's
+        */
+        static void produce(GameState &state, const int roll);
+
+        /**
+        * Requires: state, random numbers
+        * Modifies: state, random
+        * Effects: makes every player with more than 7 resources discard half, then moves the robber
+        */
+        static void seven_rolled(GameState &state, GameRandom &random);
+
+        /**
+        * Requires: state, random numbers
+        * Modifies: state, random
+        * Effects: moves the robber where the current player chooses and steals a random resource for them
+        */
+        static void move_robber(GameState &state, GameRandom &random);
+
+        /**
+        * Requires: state, devcard type, random numbers
+        * Modifies: state, random
+        * Effects: plays one of the current player's devcards of the type
+        */
+        static void play_devcard(GameState &state, const devcard_type type, GameRandom &random);
+
+        /**
+        * Requires: state, color, path id
+        * Modifies: state
+        * Effects: places a road of the color on the path and hands Longest Road over if it should change
+        */
+        static void place_road(GameState &state, const player_color color, const PathId path);
+
+        /**
+        * Requires: state
+        * Modifies: state
+        * Effects: measures every player's longest road again, then hands Longest Road over the same way
+        * Player::set_length_of_road does, for every player whose length changed, in color order
+        */
+        static void update_road_lengths(GameState &state);
+
+        /**
+        * Requires: state, color
+        * Modifies: state
+        * Effects: hands Largest Army to the color if it has played more knights than the holder (and at least 3)
+        */
+        static void update_largest_army(GameState &state, const player_color color);
+
+        /**
+        * Requires: state, plot the trail is at, roads it may use, roads already used, plots it can't pass
+        * Modifies: nothing
+        * Effects: returns the length of the longest trail starting at the plot
+        */
+        static int trail_from(const PlotId plot, const PathMask &roads, const PathMask &used, const PlotMask broken);
+};
+
+#endif //STATEENGINE_H
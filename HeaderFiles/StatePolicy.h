@@ -0,0 +1,126 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef STATEPOLICY_H
+#define STATEPOLICY_H
+
+#include <array>
+#include <cstdint>
+
+#include "BoardBitboards.h"
+#include "Enums.h"
+#include "GameState.h"
+#include "LegalActionGenerator.h"
+
+class GameRandom;
+
+/*
+ * The StatePolicy makes quick rule of thumb choices on a GameState: build the best city or settlement it can,
+ * put the robber on the leader's best tile, discard from its biggest piles, and so on.
+ *
+ * It is what the MctsAgent plays its random games (rollouts) with, since games between sensible players end
+ * in far fewer turns than games between random ones. The StateEngine asks it for the choices in the middle
+ * of an action, and the MctsAgent uses it for every choice it doesn't search.
+ *
+ * Nothing here looks further ahead than the current state.
+ */
+
+class StatePolicy {
+
+    public:
+
+        /**
+        * Requires: state, legal actions for the current player, random numbers
+        * Modifies: random
+        * Effects: returns the action to take next: a city or settlement on the most productive plot, then
+        * (sometimes) a devcard, a road if there is nowhere left to build, a trade for a missing resource, or passing
+        */
+        static Action choose_action(const GameState &state, const ActionList &actions, GameRandom &random);
+
+        /**
+        * Requires: state, color
+        * Modifies: nothing
+        * Effects: returns the free plot with the most production and variety of resources
+        */
+        static PlotId choose_initial_settlement(const GameState &state, const player_color color);
+
+        /**
+        * Requires: state, color, plot id of the settlement just placed
+        * Modifies: nothing
+        * Effects: returns the empty path next to the settlement leading towards the best plot to build on next
+        */
+        static PathId choose_initial_road(const GameState &state, const player_color color, const PlotId settlement);
+
+        /**
+        * Requires: state, color, random numbers
+        * Modifies: random
+        * Effects: returns a path the color can build a road on, next to the best plot it could build on, or a
+        * random one if no such path leads anywhere. INVALID_ID if there is none
+        */
+        static PathId choose_free_road(const GameState &state, const player_color color, GameRandom &random);
+
+        /**
+        * Requires: state, color, number of resources to discard
+        * Modifies: nothing
+        * Effects: returns how many of each resource (indexed by tile_type) to discard, always from the biggest pile
+        */
+        static std::array<int, TILE_EMPTY> choose_discard(const GameState &state, const player_color color, const int number_of_resources);
+
+        /**
+        * Requires: state, color
+        * Modifies: nothing
+        * Effects: returns the tile (not the robber's) whose production matters most to the color's opponents,
+        * weighted by their points, and least to the color itself
+        */
+        static TileId choose_robber_tile(const GameState &state, const player_color color);
+
+        /**
+        * Requires: state, color, set of the colors which can be stolen from (bit c is color c)
+        * Modifies: nothing
+        * Effects: returns the target holding the most resources
+        */
+        static player_color choose_steal_target(const GameState &state, const player_color color, const std::uint8_t targets);
+
+        /**
+        * Requires: state, color, the devcard the resource is for (YEAR_OF_PLENTY or MONOPOLY)
+        * Modifies: nothing
+        * Effects: returns the resource the opponents hold the most of for Monopoly, or the one (still in the
+        * bank) the color holds the fewest of for Year of Plenty
+        */
+        static tile_type choose_resource(const GameState &state, const player_color color, const devcard_type reason);
+
+        /**
+        * Requires: state, color the trade is offered to, proposer, resources the color would get and give
+        * (indexed by tile_type)
+        * Modifies: nothing
+        * Effects: returns if the color gets more cards than it gives, or as many including one it has none of,
+        * and the proposer isn't close to winning
+        */
+        static bool respond_to_trade(const GameState &state, const player_color color, const player_color proposer,
+            const std::array<int, TILE_EMPTY> &receive, const std::array<int, TILE_EMPTY> &give);
+
+        /**
+        * Requires: state, random numbers, list to reuse
+        * Modifies: state, random, actions
+        * Effects: rolls the dice and plays the current player's whole turn with choose_action
+        */
+        static void play_turn(GameState &state, GameRandom &random, ActionList &actions);
+
+        /**
+        * Requires: state, random numbers, most turns to play
+        * Modifies: state, random
+        * Effects: plays turns until somebody wins or max_turns have been played
+        */
+        static void play_out(GameState &state, GameRandom &random, const int max_turns);
+
+        /**
+        * Requires: state, plot id
+        * Modifies: nothing
+        * Effects: returns how good the plot is to build on: its production plus a bonus for each different
+        * resource it produces and for a port
+        */
+        static int score_plot(const GameState &state, const PlotId plot);
+};
+
+#endif //STATEPOLICY_H
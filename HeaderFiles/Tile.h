@@ -36,6 +36,9 @@ class Tile{
         // Number position in the strange hexagonal grid
         OrderedPair position_coordinate;
 
+        // Index of the tile in its board's tile list and BoardGraph, INVALID_ID if it is not on a board
+        TileId id = INVALID_ID;
+
         // Whether the tile has the robber or not
         bool robber;
 
@@ -84,6 +87,13 @@ class Tile{
         */
         OrderedPair get_position_coordinate() const;
 
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the tile's id on its board
+        */
+        TileId get_id() const;
+
         /**
         * Requires: nothing
         * Modifies: nothing
@@ -162,6 +172,13 @@ class Tile{
         */
         void set_robber(const bool _robber);
 
+        /**
+        * Requires: id
+        * Modifies: id
+        * Effects: sets the tile's id on its board
+        */
+        void set_id(const TileId _id);
+
         /**
         * Requires: print (optional)
         * Modifies: nothing
@@ -0,0 +1,64 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef TRADEPLANNER_H
+#define TRADEPLANNER_H
+
+#include "BoardBitboards.h"
+#include "Enums.h"
+#include "LegalActionGenerator.h"
+#include "ResourceVector.h"
+
+class Board;
+class Player;
+class GameBank;
+
+/*
+ * The TradePlanner works out the cheapest maritime (bank or port) trades which make a target affordable: a
+ * recipe from Craftable, or several recipes added together to afford them all.
+ *
+ * Every trade gets exactly one card, so the plan needs one trade per card missing from the target, and the
+ * only choice is what to pay with. Only cards the target doesn't need can be paid, and each resource can pay
+ * for as many trades as its spare cards cover at its rate. Taking the cheapest rates first is then the least
+ * the whole plan can cost, so a plan is a handful of vector operations and one step per trade, with nothing
+ * searched and nothing allocated.
+ *
+ * Plans are written into an ActionList as MARITIME_TRADE actions, the same ones LegalActionGenerator lists
+ * and GameEngine plays.
+ */
+
+class TradePlanner {
+
+    public:
+        // Returned instead of a cost when no trades can make the target affordable
+        static const int NO_PLAN = -1;
+
+        /**
+        * Requires: ports a player can trade through
+        * Modifies: nothing
+        * Effects: returns how many of each resource the player pays the bank for 1 resource (4, 3 with a
+        * universal port, or 2 with a matching port)
+        */
+        static ResourceVector get_trade_rates(const PortMask ports);
+
+        /**
+        * Requires: hand, trade rates, target, the bank's resources, list to fill
+        * Modifies: trades
+        * Effects: clears the list and fills it with the cheapest trades, in order, after which the hand covers
+        * the target. Returns the number of cards paid for them (0 if the hand already covers the target), or
+        * NO_PLAN, leaving the list empty, if the hand can't pay for enough trades or the bank can't give them
+        */
+        static int plan(const ResourceVector &hand, const ResourceVector &rates, const ResourceVector &target,
+            const ResourceVector &bank, ActionList &trades);
+
+        /**
+        * Requires: board, player, game bank, target, list to fill
+        * Modifies: trades
+        * Effects: plan for the player's hand at the rates of the ports they have built on
+        */
+        static int plan(const Board &board, const Player &player, const GameBank &bank, const ResourceVector &target,
+            ActionList &trades);
+};
+
+#endif //TRADEPLANNER_H
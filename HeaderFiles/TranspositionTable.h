@@ -0,0 +1,101 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef TRANSPOSITIONTABLE_H
+#define TRANSPOSITIONTABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+/*
+ * A TranspositionTable remembers what a search found out about positions, by their Zobrist hash (see
+ * Zobrist.h), so a position reached again by a different order of moves isn't searched again.
+ *
+ * The table has a fixed number of slots, a power of two, and a position can only go in the slot picked by the
+ * low bits of its hash. Any number of threads can store and probe at once without locks: a slot is two 64 bit
+ * words, the entry and the entry XORed with the hash. Two threads storing into a slot at once can leave the
+ * words from different stores, but then the XOR of the words no longer gives the hash of either, so probe
+ * treats the slot as empty rather than returning a torn entry.
+ */
+
+struct TranspositionEntry {
+    // Mean result of the position for the player to move, and how many times it was tried
+    float value;
+    std::uint16_t visits;
+
+    // How many moves deep it was searched, and the index of the best action found
+    std::uint8_t depth;
+    std::uint8_t best_action;
+};
+
+static_assert(sizeof(TranspositionEntry) == sizeof(std::uint64_t), "an entry has to fit in one atomic word");
+static_assert(std::is_trivially_copyable<TranspositionEntry>::value, "an entry has to be copyable with memcpy");
+
+class TranspositionTable {
+
+    private:
+        struct Slot {
+            std::atomic<std::uint64_t> check{0};
+            std::atomic<std::uint64_t> data{0};
+        };
+
+        std::unique_ptr<Slot[]> slots;
+        std::size_t mask;
+
+        /**
+        * Requires: entry or its packed word
+        * Modifies: nothing
+        * Effects: converts between an entry and the word it is stored as
+        */
+        static std::uint64_t pack(const TranspositionEntry &entry);
+        static TranspositionEntry unpack(const std::uint64_t data);
+
+    public:
+
+        /**
+        * Requires: log2 of the number of slots (optional), at most 30
+        * Modifies: slots, mask
+        * Effects: Constructor for TranspositionTable, makes 2^size_log2 empty slots of 16 bytes each
+        */
+        explicit TranspositionTable(const int size_log2 = 20);
+
+        TranspositionTable(const TranspositionTable&) = delete;
+        TranspositionTable& operator=(const TranspositionTable&) = delete;
+
+        /**
+        * Requires: position's hash, what was found out about it
+        * Modifies: the position's slot
+        * Effects: records the entry for the position. A slot holding a different position is only taken if
+        * that position wasn't searched deeper
+        */
+        void store(const std::uint64_t hash, const TranspositionEntry &entry);
+
+        /**
+        * Requires: position's hash, entry
+        * Modifies: entry
+        * Effects: returns true and sets entry if the position is in the table
+        */
+        bool probe(const std::uint64_t hash, TranspositionEntry &entry) const;
+
+        /**
+        * Requires: nothing
+        * Modifies: slots
+        * Effects: empties every slot. Not safe while other threads use the table
+        */
+        void clear();
+
+        /* Getters */
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the number of slots
+        */
+        std::size_t get_size() const;
+};
+
+#endif //TRANSPOSITIONTABLE_H
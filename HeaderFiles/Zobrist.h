@@ -0,0 +1,136 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <array>
+#include <cstdint>
+
+#include "BoardGraph.h"
+#include "Enums.h"
+#include "ScoreTracker.h"
+#include "StandardBoard.h"
+
+/*
+ * Zobrist keys: a random 64 bit number for every fact about a position (this color has a city on this plot,
+ * this player holds 3 ore, it is blue's turn...). A position's hash is the XOR of the keys of everything
+ * true in it, so a change is hashed by XORing out the key of what was true and XORing in the new one, and
+ * the same position reached in a different order hashes the same.
+ *
+ * Counts have a key for every value, where the key for 0 is 0, so an empty hand or an unused deck slot adds
+ * nothing. Counts above MAX_COUNT - 1 share its key.
+ *
+ * The keys come from a fixed seed, so hashes are the same in every run and on every thread.
+ */
+
+class ZobristKeys {
+
+    public:
+        static const int COLOR_COUNT = ScoreTracker::COLOR_COUNT;
+        static const int MAX_COUNT = 20;
+
+        typedef std::array<std::uint64_t, MAX_COUNT> CountKeys;
+
+    private:
+        std::array<std::array<std::array<std::uint64_t, 2>, COLOR_COUNT>, StandardBoard::PLOT_COUNT> plots;
+        std::array<std::array<std::uint64_t, COLOR_COUNT>, StandardBoard::PATH_COUNT> paths;
+        std::array<std::uint64_t, StandardBoard::TILE_COUNT> robber;
+
+        std::array<std::array<CountKeys, TILE_EMPTY>, COLOR_COUNT> resources;
+        std::array<std::array<CountKeys, CARD_EMPTY>, COLOR_COUNT> devcards;
+        std::array<CountKeys, COLOR_COUNT> knights;
+        std::array<CountKeys, CARD_EMPTY> deck;
+
+        std::array<std::uint64_t, COLOR_COUNT> turn;
+        std::uint64_t setup;
+
+        /**
+        * Requires: nothing
+        * Modifies: every key
+        * Effects: Constructor for ZobristKeys, fills every key from the fixed seed
+        */
+        ZobristKeys();
+
+        /**
+        * Requires: keys for a count, count
+        * Modifies: nothing
+        * Effects: returns the key for the count
+        */
+        static std::uint64_t count_key(const CountKeys &keys, const int count);
+
+    public:
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the keys, which are made the first time they are asked for
+        */
+        static const ZobristKeys& get();
+
+        /**
+        * Requires: plot id, color, building type
+        * Modifies: nothing
+        * Effects: returns the key of the color having the building on the plot
+        */
+        std::uint64_t plot_key(const PlotId plot, const player_color color, const building_type type) const;
+
+        /**
+        * Requires: path id, color
+        * Modifies: nothing
+        * Effects: returns the key of the color having a road on the path
+        */
+        std::uint64_t path_key(const PathId path, const player_color color) const;
+
+        /**
+        * Requires: tile id
+        * Modifies: nothing
+        * Effects: returns the key of the robber being on the tile
+        */
+        std::uint64_t robber_key(const TileId tile) const;
+
+        /**
+        * Requires: color, resource, count
+        * Modifies: nothing
+        * Effects: returns the key of the player holding count of the resource
+        */
+        std::uint64_t resource_key(const player_color color, const tile_type resource, const int count) const;
+
+        /**
+        * Requires: color, devcard type, count
+        * Modifies: nothing
+        * Effects: returns the key of the player holding count devcards of the type
+        */
+        std::uint64_t devcard_key(const player_color color, const devcard_type type, const int count) const;
+
+        /**
+        * Requires: color, count
+        * Modifies: nothing
+        * Effects: returns the key of the player having played count knights
+        */
+        std::uint64_t knight_key(const player_color color, const int count) const;
+
+        /**
+        * Requires: devcard type, count
+        * Modifies: nothing
+        * Effects: returns the key of the deck holding count devcards of the type
+        */
+        std::uint64_t deck_key(const devcard_type type, const int count) const;
+
+        /**
+        * Requires: color
+        * Modifies: nothing
+        * Effects: returns the key of it being the color's turn
+        */
+        std::uint64_t turn_key(const player_color color) const;
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns the key of the game still being in its initial placements
+        */
+        std::uint64_t setup_key() const;
+};
+
+#endif //ZOBRIST_H
@@ -2,36 +2,109 @@
 // Created by nmila on 9/28/2025.
 //
 
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <vector>
 #include <map>
+#include <sstream>
+#include <set>
+#include <thread>
 
 #include "HeaderFiles/Board.h"
+#include "HeaderFiles/BoardBalancer.h"
+#include "HeaderFiles/BoardRenderer.h"
+#include "HeaderFiles/CoordinateGrid.h"
 #include "HeaderFiles/EndpointPair.h"
 #include "HeaderFiles/OrderedPair.h"
 #include "HeaderFiles/GameBank.h"
+#include "HeaderFiles/GameContext.h"
+#include "HeaderFiles/GameEngine.h"
+#include "HeaderFiles/GameLog.h"
+#include "HeaderFiles/GameRandom.h"
+#include "HeaderFiles/GameSave.h"
+#include "HeaderFiles/GameState.h"
+#include "HeaderFiles/Instrumentation.h"
+#include "HeaderFiles/RandomAgent.h"
+#include "HeaderFiles/LegalActionGenerator.h"
+#include "HeaderFiles/LongestRoadEngine.h"
+#include "HeaderFiles/MctsAgent.h"
+#include "HeaderFiles/OutputSink.h"
+#include "HeaderFiles/ProductionTable.h"
+#include "HeaderFiles/ResourceVector.h"
+#include "HeaderFiles/ScoreTracker.h"
+#include "HeaderFiles/StateEngine.h"
+#include "HeaderFiles/StatePolicy.h"
+#include "HeaderFiles/TradePlanner.h"
+#include "HeaderFiles/TranspositionTable.h"
 #include "HeaderFiles/Enums.h"
 
-using std::cout, std::endl, std::shared_ptr, std::make_shared, std::string, std::vector, std::map;
+using std::cout, std::endl, std::shared_ptr, std::make_shared, std::string, std::vector, std::map, std::stringstream;
 
 bool test_Board();
+bool test_BoardBalancer();
+bool test_BoardBitboards();
+bool test_BoardRenderer();
+bool test_CoordinateGrid();
 bool test_DevCard();
 bool test_GameBank();
+bool test_GameContext();
+bool test_GameEngine();
+bool test_GameLog();
+bool test_GameRandom();
+bool test_GameSave();
+bool test_GameState();
+bool test_Instrumentation();
+bool test_LegalActionGenerator();
+bool test_LongestRoadEngine();
+bool test_MctsAgent();
+bool test_OutputSink();
 bool test_Plot();
 bool test_Path();
 bool test_Player();
+bool test_ProductionTable();
+bool test_ResourceVector();
+bool test_ScoreTracker();
+bool test_StateEngine();
 bool test_Tile();
+bool test_TradePlanner();
+bool test_TranspositionTable();
+bool test_Zobrist();
 
 int main() {
 	if (test_Board()) { cout << "Passed all Board tests." << endl; }
+	if (test_BoardBalancer()) { cout << "Passed all BoardBalancer tests." << endl; }
+	if (test_BoardBitboards()) { cout << "Passed all BoardBitboards tests." << endl; }
+	if (test_BoardRenderer()) { cout << "Passed all BoardRenderer tests." << endl; }
+	if (test_CoordinateGrid()) { cout << "Passed all CoordinateGrid tests." << endl; }
 	if (test_DevCard()) { cout << "Passed all DevCard tests." << endl; }
 	if (test_GameBank()) { cout << "Passed all GameBank tests." << endl; }
+	if (test_GameContext()) { cout << "Passed all GameContext tests." << endl; }
+	if (test_GameEngine()) { cout << "Passed all GameEngine tests." << endl; }
+	if (test_GameLog()) { cout << "Passed all GameLog tests." << endl; }
+	if (test_GameRandom()) { cout << "Passed all GameRandom tests." << endl; }
+	if (test_GameSave()) { cout << "Passed all GameSave tests." << endl; }
+	if (test_GameState()) { cout << "Passed all GameState tests." << endl; }
+	if (test_Instrumentation()) { cout << "Passed all Instrumentation tests." << endl; }
+	if (test_LegalActionGenerator()) { cout << "Passed all LegalActionGenerator tests." << endl; }
+	if (test_LongestRoadEngine()) { cout << "Passed all LongestRoadEngine tests." << endl; }
+	if (test_MctsAgent()) { cout << "Passed all MctsAgent tests." << endl; }
+	if (test_OutputSink()) { cout << "Passed all OutputSink tests." << endl; }
 	if (test_Plot()) { cout << "Passed all Plot tests." << endl; }
 	if (test_Path()) { cout << "Passed all Path tests." << endl; }
 	if (test_Player()) { cout << "Passed all Player tests." << endl; }
+	if (test_ProductionTable()) { cout << "Passed all ProductionTable tests." << endl; }
+	if (test_ResourceVector()) { cout << "Passed all ResourceVector tests." << endl; }
+	if (test_ScoreTracker()) { cout << "Passed all ScoreTracker tests." << endl; }
+	if (test_StateEngine()) { cout << "Passed all StateEngine tests." << endl; }
 	if (test_Tile()) { cout << "Passed all Tile tests." << endl; }
+	if (test_TradePlanner()) { cout << "Passed all TradePlanner tests." << endl; }
+	if (test_TranspositionTable()) { cout << "Passed all TranspositionTable tests." << endl; }
+	if (test_Zobrist()) { cout << "Passed all Zobrist tests." << endl; }
 
 	return 0;
 }
@@ -39,9 +112,8 @@ int main() {
 bool test_Board() {
 	bool passed = true;
 
-	GameBank bank = GameBank::instance(4);
-	GameBank::reset();
-	Board board = Board();
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
 
 	if (board.get_board_paths().size() != 72) {
 		passed = false;
@@ -125,6 +197,64 @@ bool test_Board() {
 		}
 	}
 
+	// (1, 0) + (1, 3) has the same edge key as the real path between (1, 1) and (1, 2)
+	if (board.has_path(OrderedPair(1, 0), OrderedPair(1, 3)) || !board.has_path(OrderedPair(1, 2), OrderedPair(1, 1))) {
+		passed = false;
+		cout << "FAILED BOARD GET_PATH EDGE KEY TEST" << endl;
+	}
+
+	const BoardGraph &graph = board.get_graph();
+	if (graph.get_plot_count() != 54 || graph.get_path_count() != 72 || graph.get_tile_count() != 19) {
+		passed = false;
+		cout << "FAILED BOARD GRAPH COUNT TEST" << endl;
+	}
+
+	for (shared_ptr<Path> path : board.get_board_paths()) {
+		if (board.get_path_by_id(path->get_id()) != path ||
+			graph.find_path(path->get_endpoints().plot_a->get_id(), path->get_endpoints().plot_b->get_id()) != path->get_id() ||
+			graph.get_adjacent_paths(path->get_id())[1] == INVALID_ID) {
+			passed = false;
+			cout << "FAILED BOARD GRAPH PATH ID TEST" << endl;
+			break;
+		}
+	}
+
+	// Path directions come from the constexpr tables, so check them against the slope calculation
+	Path direction_calculator;
+	for (auto ring : board.get_board_tiles()) {
+		for (auto tile : ring.second) {
+			const auto &tile_plots = graph.get_tile_plots(tile.second.get_id());
+			const auto &tile_paths = graph.get_tile_paths(tile.second.get_id());
+			bool directions_match = true;
+			for (int i = 0; i < 6; i++) {
+				int expected = direction_calculator.calculate_direction(
+					board.get_plot_by_id(tile_plots[i])->get_position_coordinates(),
+					board.get_plot_by_id(tile_plots[(i + 1) % 6])->get_position_coordinates(),
+					tile.second.get_position_coordinate());
+				if (board.get_path_by_id(tile_paths[i])->get_direction() != expected) {
+					directions_match = false;
+				}
+			}
+			if (!directions_match) {
+				passed = false;
+				cout << "FAILED BOARD STANDARD TOPOLOGY DIRECTION TEST" << endl;
+				break;
+			}
+		}
+	}
+
+	for (auto ring : board.get_board_tiles()) {
+		for (auto tile : ring.second) {
+			TileId tile_id = board.get_tile_id(tile.second.get_position_id());
+			if (tile_id != tile.second.get_id() ||
+				board.get_tile_by_id(tile_id).get_position_coordinate() != tile.second.get_position_coordinate()) {
+				passed = false;
+				cout << "FAILED BOARD GRAPH TILE ID TEST" << endl;
+				break;
+			}
+		}
+	}
+
 	for (auto ring : board.get_board_tiles()) {
 		for (auto tile : ring.second) {
 			if (board.get_tile_position_coordinates(tile.second.get_position_id()) !=
@@ -177,9 +307,9 @@ bool test_Board() {
 		cout << "FAILED BOARD SET_ROBBER_POSITION TEST" << endl;
 	}
 
-	Board board2 = Board();
+	Board board2 = Board(context.get_board_random());
 	vector<int> prod_nums = {1, 2, 3, 4, 5};
-	int num = board2.get_random_production_number(prod_nums);
+	int num = board2.get_random_production_number(prod_nums, context.get_random());
 	if (!(num > 0 && num <= 5)) {
 		passed = false;
 		cout << "FAILED BOARD GET RANDOM PRODUCTION NUMBER TEST 1" << endl;
@@ -190,18 +320,18 @@ bool test_Board() {
 	}
 
 	shared_ptr<Path> p1 = board2.get_path(OrderedPair(-1, 0), OrderedPair(-1, 1));
-	if (board.can_place_road(bank.get_player(RED))) {
+	if (board.can_place_road(context.get_player(RED))) {
 		passed = false;
 		cout << "FAILED BOARD CAN PLACE ROAD TEST 1" << endl;
 	}
-	p1->set_inhabitant(Road(bank.get_player(RED)));
-	if (!board2.can_place_road(bank.get_player(RED))) {
+	p1->set_inhabitant(Road(context.get_player(RED)));
+	if (!board2.can_place_road(context.get_player(RED))) {
 		passed = false;
 		cout << "FAILED BOARD CAN PLACE ROAD TEST 2" << endl;
 	}
 
 	map<tile_type, int> tile_types = {{GRAIN, 2}, {WOOL, 2}, {ORE, 2}};
-	tile_type choice = board2.get_random_tile_type(tile_types);
+	tile_type choice = board2.get_random_tile_type(tile_types, context.get_random());
 	if (!(choice == GRAIN || choice == WOOL || choice == ORE)) {
 		passed = false;
 		cout << "FAILED BOARD GET RANDOM TILE TYPE TEST 1" << endl;
@@ -214,6 +344,288 @@ bool test_Board() {
 	return passed;
 }
 
+bool test_BoardBalancer() {
+	bool passed = true;
+
+	const map<tile_type, int> tile_types = {{GRAIN, 4}, {WOOL, 4}, {LUMBER, 4}, {BRICK, 3}, {ORE, 3}, {DESERT, 1}};
+	const vector<int> production_numbers = {2, 3, 3, 4, 4, 5, 5, 6, 6, 8, 8, 9, 9, 10, 10, 11, 11, 12};
+
+	if (BoardBalancer::get_pips(2) != 1 || BoardBalancer::get_pips(6) != 5 || BoardBalancer::get_pips(7) != 6 ||
+		BoardBalancer::get_pips(8) != 5 || BoardBalancer::get_pips(12) != 1 || BoardBalancer::get_pips(-1) != 0) {
+		passed = false;
+		cout << "FAILED BOARDBALANCER PIPS TEST" << endl;
+	}
+
+	// Every red number in the middle (a,a, b,a, b,b and b,c), ore on 2, 3 and 12, 3:1 ports only
+	BoardLayout bad;
+	const std::array<tile_type, StandardBoard::TILE_COUNT> bad_types = {
+		GRAIN, GRAIN, WOOL, WOOL, LUMBER, LUMBER, BRICK,
+		ORE, ORE, ORE, GRAIN, GRAIN, WOOL, WOOL, LUMBER, LUMBER, BRICK, BRICK, DESERT};
+	const std::array<int, StandardBoard::TILE_COUNT> bad_numbers = {
+		6, 6, 8, 8, 5, 5, 9, 2, 3, 12, 3, 4, 4, 9, 10, 10, 11, 11, -1};
+	for (int tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+		bad.tile_types[tile] = bad_types[tile];
+		bad.tile_numbers[tile] = bad_numbers[tile];
+	}
+	bad.port_types.fill(TILE_EMPTY);
+	BalanceWeights weights;
+	BalanceScore bad_score = BoardBalancer::score(bad, weights);
+	double total = weights.resource_pips * bad_score.resource_pips + weights.red_adjacency * bad_score.red_adjacency +
+		weights.plot_pip_variance * bad_score.plot_pip_variance + weights.port_coupling * bad_score.port_coupling;
+	if (bad_score.red_adjacency != 5 || bad_score.port_coupling != 0 || bad_score.resource_pips <= 0 ||
+		bad_score.plot_pip_variance <= 0 || std::abs(bad_score.total - total) > 1e-9) {
+		passed = false;
+		cout << "FAILED BOARDBALANCER SCORE TEST" << endl;
+	}
+
+	// A 2:1 ore port next to the ore is coupled by the ore's pips. c,a to c,c touch ports 0 and 1
+	bad.port_types[0] = ORE;
+	bad.port_types[1] = ORE;
+	if (BoardBalancer::score(bad, weights).port_coupling <= 0 || BoardBalancer::score(bad, BalanceWeights{0, 0, 0, 0}).total != 0) {
+		passed = false;
+		cout << "FAILED BOARDBALANCER PORT COUPLING TEST" << endl;
+	}
+
+	// The same seed and candidate limit give the same board on any number of threads, dealt from the same tiles
+	BalanceOptions options;
+	options.time_ms = 0;
+	options.max_candidates = 200;
+	options.threads = 1;
+	GameRandom random_one(17);
+	BalanceResult one_thread = BoardBalancer::generate(tile_types, production_numbers, options, random_one);
+	options.threads = 4;
+	GameRandom random_four(17);
+	BalanceResult four_threads = BoardBalancer::generate(tile_types, production_numbers, options, random_four);
+	std::multiset<tile_type> dealt_types;
+	std::multiset<int> dealt_numbers;
+	for (int tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+		dealt_types.insert(one_thread.layout.tile_types[tile]);
+		if (one_thread.layout.tile_numbers[tile] != -1) {
+			dealt_numbers.insert(one_thread.layout.tile_numbers[tile]);
+		}
+	}
+	if (one_thread.candidates != 200 || four_threads.candidates != 200 ||
+		one_thread.layout.tile_types != four_threads.layout.tile_types ||
+		one_thread.layout.tile_numbers != four_threads.layout.tile_numbers ||
+		one_thread.layout.port_types != four_threads.layout.port_types ||
+		one_thread.score.total != four_threads.score.total ||
+		dealt_types.count(DESERT) != 1 || dealt_types.count(ORE) != 3 ||
+		dealt_numbers != std::multiset<int>(production_numbers.begin(), production_numbers.end())) {
+		passed = false;
+		cout << "FAILED BOARDBALANCER DETERMINISM TEST" << endl;
+	}
+
+	// The best of 200 beats a random board on average, and a Board made the same way gets the same layout
+	GameRandom random_boards(29);
+	double random_total = 0;
+	for (int i = 0; i < 50; i++) {
+		random_total += BoardBalancer::score(
+			Board::get_random_layout(tile_types, production_numbers, random_boards), options.weights).total;
+	}
+	GameRandom random_board(17);
+	Board balanced_board(random_board, options);
+	BalanceScore board_score = BoardBalancer::score(balanced_board.get_layout(), options.weights);
+	if (one_thread.score.total >= random_total / 50 || board_score.total != one_thread.score.total ||
+		balanced_board.get_layout().tile_numbers != one_thread.layout.tile_numbers) {
+		passed = false;
+		cout << "FAILED BOARDBALANCER BEST LAYOUT TEST" << endl;
+	}
+
+	// With only a time budget the search stops on time, having scored at least one candidate
+	options.time_ms = 20;
+	options.max_candidates = 0;
+	GameRandom random_timed(3);
+	auto start = std::chrono::steady_clock::now();
+	BalanceResult timed = BoardBalancer::generate(tile_types, production_numbers, options, random_timed);
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+	if (timed.candidates < 1 || elapsed.count() > 1000) {
+		passed = false;
+		cout << "FAILED BOARDBALANCER TIME BUDGET TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_BoardBitboards() {
+	bool passed = true;
+
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
+	const BoardBitboards &bitboards = board.get_bitboards();
+
+	if (bitboards.get_occupied_plots() != 0 || bitboards.get_occupied_paths().any() ||
+		count_bits(bitboards.get_buildable_plots(RED, false)) != 54 ||
+		bitboards.get_buildable_paths(RED, false).count() != 72) {
+		passed = false;
+		cout << "FAILED BOARDBITBOARDS EMPTY BOARD TEST" << endl;
+	}
+
+	shared_ptr<Plot> plot = board.get_plot(OrderedPair(-1, 0));
+	plot->set_inhabitant(Building(context.get_player(RED), SETTLEMENT));
+	PlotMask plot_bit = PlotMask(1) << plot->get_id();
+	if (bitboards.get_settlements(RED) != plot_bit || bitboards.get_occupied_plots() != plot_bit) {
+		passed = false;
+		cout << "FAILED BOARDBITBOARDS PLACE SETTLEMENT TEST" << endl;
+	}
+	// The plot and its 3 neighbours can't be built on anymore
+	if (count_bits(bitboards.get_buildable_plots(YELLOW, false)) != 50) {
+		passed = false;
+		cout << "FAILED BOARDBITBOARDS BUILDABLE PLOTS TEST" << endl;
+	}
+
+	plot->upgrade_inhabitant();
+	if (bitboards.get_settlements(RED) != 0 || bitboards.get_cities(RED) != plot_bit) {
+		passed = false;
+		cout << "FAILED BOARDBITBOARDS UPGRADE TEST" << endl;
+	}
+
+	if (bitboards.can_place_road(RED)) {
+		passed = false;
+		cout << "FAILED BOARDBITBOARDS CAN PLACE ROAD TEST 1" << endl;
+	}
+	shared_ptr<Path> path = board.get_path(OrderedPair(-1, 0), OrderedPair(-1, 1));
+	path->set_inhabitant(Road(context.get_player(RED)));
+	// The road touches 4 other paths, all empty
+	if (!bitboards.can_place_road(RED) || bitboards.get_buildable_paths(RED, true).count() != 4 ||
+		bitboards.get_roads(RED) != PathMask::bit(path->get_id())) {
+		passed = false;
+		cout << "FAILED BOARDBITBOARDS CAN PLACE ROAD TEST 2" << endl;
+	}
+	// The other end of the road is next to the city, so there is still nowhere to build
+	if (bitboards.get_buildable_plots(RED, true) != 0) {
+		passed = false;
+		cout << "FAILED BOARDBITBOARDS BUILDABLE PLOTS WITH ROAD TEST" << endl;
+	}
+
+	// (1, 5) is on a port, which may be a 2:1 or a universal 3:1 port
+	if (bitboards.get_port_access(RED) != 0 || bitboards.get_trade_rate(RED, GRAIN) != 4) {
+		passed = false;
+		cout << "FAILED BOARDBITBOARDS NO PORT TEST" << endl;
+	}
+	shared_ptr<Plot> port_plot = board.get_plot(OrderedPair(1, 5));
+	port_plot->set_inhabitant(Building(context.get_player(RED), SETTLEMENT));
+	PortMask expected_ports = port_plot->is_universal_port() ? UNIVERSAL_PORT : port_bit(port_plot->get_port_type());
+	if (bitboards.get_port_access(RED) != expected_ports || bitboards.get_port_access(YELLOW) != 0) {
+		passed = false;
+		cout << "FAILED BOARDBITBOARDS PORT ACCESS TEST" << endl;
+	}
+	if (!port_plot->is_universal_port() && bitboards.get_trade_rate(RED, port_plot->get_port_type()) != 2) {
+		passed = false;
+		cout << "FAILED BOARDBITBOARDS TRADE RATE TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_BoardRenderer() {
+	bool passed = true;
+
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
+	BoardRenderer renderer(board);
+	renderer.update(board);
+
+	stringstream frame;
+	renderer.draw(frame);
+	int line_count = 0;
+	string line;
+	while (std::getline(frame, line)) { line_count++; }
+	string board_text;
+	for (int row = 0; row < BoardRenderer::ROWS; row++) {
+		board_text += renderer.get_row_text(row) + "\n";
+	}
+	bool has_every_tile = true;
+	for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+		if (board_text.find(board.get_tile_by_id(tile).get_main_display_row(false)) == string::npos) {
+			has_every_tile = false;
+		}
+	}
+	if (line_count != BoardRenderer::ROWS || !has_every_tile || renderer.has_changes()) {
+		passed = false;
+		cout << "FAILED BOARDRENDERER FULL DRAW TEST" << endl;
+	}
+
+	// Nothing changed, so nothing is sent
+	stringstream unchanged;
+	renderer.update(board);
+	renderer.draw_changes(unchanged, 2);
+	if (!unchanged.str().empty()) {
+		passed = false;
+		cout << "FAILED BOARDRENDERER NO CHANGES TEST" << endl;
+	}
+
+	// A settlement only sends the cells of its plot
+	board.get_plot(OrderedPair(-1, 0))->set_inhabitant(Building(context.get_player(RED), SETTLEMENT));
+	renderer.update(board);
+	stringstream settlement;
+	renderer.draw_changes(settlement, 2);
+	if (settlement.str().find('S') == string::npos || settlement.str().find("H") == string::npos ||
+		settlement.str().size() > 40 || renderer.has_changes()) {
+		passed = false;
+		cout << "FAILED BOARDRENDERER SETTLEMENT CHANGES TEST" << endl;
+	}
+
+	// Updating one change at a time ends up the same as painting everything at once
+	board.get_path(OrderedPair(-1, 0), OrderedPair(-1, 1))->set_inhabitant(Road(context.get_player(BLUE)));
+	board.set_robber_position("b,c");
+	board.get_plot(OrderedPair(1, 0))->set_icon_override("\033[1m3\033[0m");
+	renderer.update(board, true, {"a,a", "b,c"});
+	BoardRenderer fresh_renderer(board);
+	fresh_renderer.update(board, true, {"a,a", "b,c"});
+	stringstream updated_frame, fresh_frame;
+	renderer.draw(updated_frame);
+	fresh_renderer.draw(fresh_frame);
+	if (updated_frame.str() != fresh_frame.str() || updated_frame.str().find("b,c") == string::npos) {
+		passed = false;
+		cout << "FAILED BOARDRENDERER INCREMENTAL UPDATE TEST" << endl;
+	}
+
+	// Taking the override away puts the plot's own icon back
+	board.get_plot(OrderedPair(1, 0))->set_icon_override("");
+	renderer.update(board);
+	fresh_renderer = BoardRenderer(board);
+	fresh_renderer.update(board);
+	for (int row = 0; row < BoardRenderer::ROWS; row++) {
+		if (renderer.get_row_text(row) != fresh_renderer.get_row_text(row)) {
+			passed = false;
+			cout << "FAILED BOARDRENDERER RESET OVERRIDE TEST" << endl;
+			break;
+		}
+	}
+
+	return passed;
+}
+
+bool test_CoordinateGrid() {
+	bool passed = true;
+
+	CoordinateGrid grid;
+	if (grid.contains(OrderedPair(0, 0)) || grid.get(OrderedPair(3, -2)) != INVALID_ID) {
+		passed = false;
+		cout << "FAILED COORDINATEGRID EMPTY TEST" << endl;
+	}
+
+	grid.set(OrderedPair(1, 1), 4);
+	grid.set(OrderedPair(-7, 9), 5);
+	grid.set(OrderedPair(25, -30), 6);
+	if (grid.get(OrderedPair(1, 1)) != 4 || grid.get(OrderedPair(-7, 9)) != 5 || grid.get(OrderedPair(25, -30)) != 6) {
+		passed = false;
+		cout << "FAILED COORDINATEGRID GROW TEST" << endl;
+	}
+	if (grid.contains(OrderedPair(0, 0)) || grid.contains(OrderedPair(26, -30))) {
+		passed = false;
+		cout << "FAILED COORDINATEGRID CONTAINS TEST" << endl;
+	}
+
+	if (CoordinateGrid::edge_key(OrderedPair(1, 2), OrderedPair(3, 2)) !=
+		CoordinateGrid::edge_key(OrderedPair(3, 2), OrderedPair(1, 2))) {
+		passed = false;
+		cout << "FAILED COORDINATEGRID EDGE KEY TEST" << endl;
+	}
+
+	return passed;
+}
+
 bool test_DevCard() {
 	bool passed = true;
 
@@ -260,21 +672,14 @@ bool test_DevCard() {
 bool test_GameBank() {
 	bool passed = true;
 
-	GameBank& bank = GameBank::instance(4);
-	bank.get_player(RED)->set_length_of_road(8, false);
-	bank.draw_devcard();
-	GameBank::reset();
-	if (bank.get_player(RED)->get_length_of_road() == 8) {
-		passed = false;
-		cout << "FAILED GAMEBANK RESET TEST 1" << endl;
-	}
-	bank.get_player(RED)->set_length_of_road(0, false);
+	GameBank bank;
+	GameRandom random(1);
 
 	if (bank.get_available_devcards().size() != 25) {
 		passed = false;
-		cout << "FAILED GAMEBANK DEVCARD DECK AND RESET TEST" << endl;
+		cout << "FAILED GAMEBANK DEVCARD DECK TEST" << endl;
 	}
-	bank.draw_devcard();
+	bank.draw_devcard(random);
 	if (bank.get_available_devcards().size() != 24) {
 		passed = false;
 		cout << "FAILED GAMEBANK DRAW DEVCARD TEST" << endl;
@@ -297,61 +702,746 @@ bool test_GameBank() {
 	}
 
 	bank.draw_resource(GRAIN);
-	if (bank.get_available_resources().at(GRAIN) != 18) {
+	if (bank.get_available_resources().get(GRAIN) != 18) {
 		passed = false;
 		cout << "FAILED GAMEBANK DRAW RESOURCE TEST" << endl;
 	}
 	bank.return_resource(GRAIN);
-	if (bank.get_available_resources().at(GRAIN) != 19) {
+	if (bank.get_available_resources().get(GRAIN) != 19) {
 		passed = false;
 		cout << "FAILED GAMEBANK RETURN RESOURCE TEST" << endl;
 	}
 	bank.return_resource(WOOL);
-	if (bank.get_available_resources().at(GRAIN) != 19) {
+	if (bank.get_available_resources().get(GRAIN) != 19) {
 		passed = false;
 		cout << "FAILED GAMEBANK RETURN RESOURCE WHEN RESOURCE IS FULL TEST" << endl;
 	}
+	if (bank.get_resources_drawn()[GRAIN] != 1 || bank.get_resources_returned()[GRAIN] != 1 ||
+		bank.get_resources_drawn()[ORE] != 0) {
+		passed = false;
+		cout << "FAILED GAMEBANK RESOURCE FLOW TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_GameContext() {
+	bool passed = true;
 
-	if (bank.get_players().size() != 4) {
+	GameContext context(4);
+	if (context.get_players().size() != 4 || context.get_player_count() != 4) {
 		passed = false;
-		cout << "FAILED GAMEBANK PLAYER SETUP TEST" << endl;
+		cout << "FAILED GAMECONTEXT PLAYER SETUP TEST" << endl;
 	}
 
-	if (bank.get_player(RED) == nullptr) {
+	if (context.get_player(RED) == nullptr) {
 		passed = false;
-		cout << "FAILED GAMEBANK GETPLAYER WITH COLOR TEST" << endl;
+		cout << "FAILED GAMECONTEXT GETPLAYER WITH COLOR TEST" << endl;
 	}
-	if (bank.get_player("RED") == nullptr) {
+	if (context.get_player("RED") == nullptr) {
 		passed = false;
-		cout << "FAILED GAMEBANK GETPLAYER WITH STRING TEST" << endl;
+		cout << "FAILED GAMECONTEXT GETPLAYER WITH STRING TEST" << endl;
+	}
+	if (context.get_player(1) == nullptr) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT GETPLAYER WITH INT TEST" << endl;
+	}
+	if (&context.get_player(RED)->get_context() != &context) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT PLAYER CONTEXT TEST" << endl;
+	}
+
+	if (context.get_longest_road_player() != nullptr) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT GET LONGEST ROAD PLAYER TEST" << endl;
+	}
+	if (context.get_largest_army_player() != nullptr) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT GET LARGEST ARMY PLAYER TEST" << endl;
+	}
+	context.get_player(RED)->set_largest_army(true);
+	context.get_player(YELLOW)->set_longest_road(true);
+	if (context.get_longest_road_player() != context.get_player(YELLOW)) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT GET LONGEST ROAD PLAYER TEST" << endl;
+	}
+	if (context.get_largest_army_player() != context.get_player(RED)) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT GET LARGEST ARMY PLAYER TEST" << endl;
+	}
+
+	// Players take from and give back to their own game's bank
+	context.get_player(RED)->gain_many_resources({{ORE, 3}}, true, false);
+	context.get_player(RED)->discard_many_resources({{ORE, 1}}, "spent", true, false);
+	if (context.get_bank().get_resources_drawn()[ORE] != 3 || context.get_bank().get_resources_returned()[ORE] != 1 ||
+		context.get_bank().get_available_resources().get(ORE) != 17) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT RESOURCE FLOW TEST" << endl;
+	}
+
+	// Another game starts from nothing, whatever happened in this one
+	GameContext other(4);
+	if (other.get_largest_army_player() != nullptr || other.get_bank().get_available_resources().get(ORE) != 19) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT INDEPENDENCE TEST" << endl;
+	}
+
+	// Games with the same seed play out the same, even when they are played at the same time
+	map<player_color, shared_ptr<Agent>> agents;
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		agents[color] = make_shared<RandomAgent>();
+	}
+	auto play = [&agents](int &turns, player_color &winner) {
+		GameContext game(4, 7);
+		Board board = Board(game.get_board_random());
+		GameEngine engine(board, game, agents);
+		winner = engine.play_game(2000);
+		turns = engine.get_turn_count();
+	};
+	int turns_a = 0, turns_b = 0;
+	player_color winner_a = COLOR_EMPTY, winner_b = COLOR_EMPTY;
+	std::thread game_a(play, std::ref(turns_a), std::ref(winner_a));
+	std::thread game_b(play, std::ref(turns_b), std::ref(winner_b));
+	game_a.join();
+	game_b.join();
+	if (turns_a != turns_b || winner_a != winner_b || winner_a == COLOR_EMPTY) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT CONCURRENT GAMES TEST" << endl;
+	}
+
+	// A seed always makes the same board, rolls and devcard order, however differently the game goes
+	GameContext seeded_a(4, 99), seeded_b(4, 99);
+	Board board_a = Board(seeded_a.get_board_random());
+	Board board_b = Board(seeded_b.get_board_random());
+	bool same_board = true;
+	for (TileId tile = 0; tile < board_a.get_graph().get_tile_count(); tile++) {
+		same_board = same_board &&
+			board_a.get_tile_by_id(tile).get_type() == board_b.get_tile_by_id(tile).get_type() &&
+			board_a.get_tile_by_id(tile).get_production_number() == board_b.get_tile_by_id(tile).get_production_number();
+	}
+	for (PlotId plot = 0; plot < board_a.get_graph().get_plot_count(); plot++) {
+		same_board = same_board && board_a.get_plot_by_id(plot)->get_port_type() == board_b.get_plot_by_id(plot)->get_port_type();
+	}
+	if (!same_board) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT SEEDED BOARD TEST" << endl;
+	}
+	seeded_a.get_random().next_int(10);
+	bool same_dice = true;
+	for (int i = 0; i < 20; i++) {
+		same_dice = same_dice && seeded_a.get_dice_random().next_int(6) == seeded_b.get_dice_random().next_int(6);
+	}
+	bool same_deck = true;
+	for (int i = 0; i < 25; i++) {
+		same_deck = same_deck && seeded_a.get_bank().draw_devcard(seeded_a.get_deck_random()).get_type() ==
+			seeded_b.get_bank().draw_devcard(seeded_b.get_deck_random()).get_type();
+	}
+	if (!same_dice || !same_deck) {
+		passed = false;
+		cout << "FAILED GAMECONTEXT SEEDED STREAMS TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_GameRandom() {
+	bool passed = true;
+
+	GameRandom random_a(5), random_b(5), random_c(6);
+	bool same = true, different = false;
+	for (int i = 0; i < 100; i++) {
+		std::uint64_t a = random_a.next();
+		same = same && a == random_b.next();
+		different = different || a != random_c.next();
+	}
+	if (!same || !different) {
+		passed = false;
+		cout << "FAILED GAMERANDOM SEED TEST" << endl;
+	}
+
+	random_a.seed(5);
+	random_b.seed(5);
+	if (random_a.next() != random_b.next()) {
+		passed = false;
+		cout << "FAILED GAMERANDOM RESEED TEST" << endl;
+	}
+
+	vector<int> counts(6, 0);
+	bool in_bounds = true;
+	for (int i = 0; i < 6000; i++) {
+		int value = random_a.next_int(6);
+		in_bounds = in_bounds && value >= 0 && value < 6;
+		if (in_bounds) {
+			counts[value]++;
+		}
+	}
+	for (int count : counts) {
+		in_bounds = in_bounds && count > 800 && count < 1200;
+	}
+	if (!in_bounds || random_a.next_int(1) != 0) {
+		passed = false;
+		cout << "FAILED GAMERANDOM NEXT INT TEST" << endl;
+	}
+
+	// A split carries on from the parent's numbers, and the parent jumps to a stream of its own
+	GameRandom parent(7), copy(7);
+	GameRandom child = parent.split();
+	GameRandom second_child = parent.split();
+	std::uint64_t from_child = child.next();
+	if (from_child != copy.next() || from_child == parent.next() || from_child == second_child.next()) {
+		passed = false;
+		cout << "FAILED GAMERANDOM SPLIT TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_GameEngine() {
+	bool passed = true;
+
+	GameContext context(4, 1);
+	Board board = Board(context.get_board_random());
+
+	map<player_color, shared_ptr<Agent>> agents;
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		agents[color] = make_shared<RandomAgent>();
+	}
+	GameEngine engine(board, context, agents);
+
+	// Nothing should reach the console in a game between automated agents
+	stringstream captured;
+	OutputSink captured_output(&captured);
+	OutputSink::set_current(&captured_output);
+
+	engine.setup();
+	bool placed_initial = true;
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		shared_ptr<Player> player = context.get_player(color);
+		placed_initial = placed_initial &&
+			count_bits(board.get_bitboards().get_settlements(color)) == 2 &&
+			board.get_bitboards().get_roads(color).count() == 2 &&
+			player->get_settlement_pieces() == 3 && player->get_road_pieces() == 13;
+	}
+
+	TileId robber_tile = board.get_bitboards().get_production_table().get_robber_tile();
+	engine.play_turn(7);
+	TileId moved_robber_tile = board.get_bitboards().get_production_table().get_robber_tile();
+
+	player_color winner = engine.play_game(2000);
+
+	OutputSink::set_current(nullptr);
+
+	if (!placed_initial) {
+		passed = false;
+		cout << "FAILED GAMEENGINE SETUP TEST" << endl;
+	}
+
+	if (moved_robber_tile == robber_tile || engine.get_turn_count() < 1) {
+		passed = false;
+		cout << "FAILED GAMEENGINE ROBBER TEST" << endl;
+	}
+
+	if (!captured.str().empty() || captured_output.get_byte_count() != 0) {
+		passed = false;
+		cout << "FAILED GAMEENGINE SILENT TEST" << endl;
+	}
+
+	if (winner == COLOR_EMPTY || context.get_player(winner)->get_points(board) < ScoreTracker::WINNING_POINTS ||
+		engine.get_winner() != winner) {
+		passed = false;
+		cout << "FAILED GAMEENGINE WINNER TEST" << endl;
+	}
+
+	// Every resource card is either in the bank or in someone's hand
+	bool conserved = true;
+	for (tile_type resource : RESOURCE_TYPES) {
+		int total = context.get_bank().get_available_resources().get(resource);
+		for (auto &player : context.get_players()) {
+			total += player.second->get_amount_of_resource(resource);
+		}
+		conserved = conserved && total == 19;
+	}
+	if (!conserved) {
+		passed = false;
+		cout << "FAILED GAMEENGINE RESOURCE CONSERVATION TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_GameLog() {
+	bool passed = true;
+	const string path = "test_game.hxlog";
+
+	GameContext context(4, 17);
+	Board board = Board(context.get_board_random());
+	map<player_color, shared_ptr<Agent>> agents;
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		agents[color] = make_shared<RandomAgent>();
+	}
+	GameEngine engine(board, context, agents);
+
+	GameLogWriter log;
+	bool opened = log.open(path, GameLogHeader::describe(board, context));
+	context.set_log(&log);
+	player_color winner = engine.play_game(2000);
+	context.set_log(nullptr);
+	std::size_t events_written = log.get_event_count();
+	bool closed = log.close();
+
+	if (!opened || !closed || events_written == 0) {
+		passed = false;
+		cout << "FAILED GAMELOG WRITE TEST" << endl;
+	}
+
+	GameLogReader reader;
+	if (!reader.open(path) || reader.get_event_count() != events_written ||
+		reader.get_header().seed != 17 || reader.get_header().player_count != 4) {
+		passed = false;
+		cout << "FAILED GAMELOG READ TEST" << endl;
+	}
+
+	// A game made from the logged layout and seed, with the log's events applied, ends up exactly where the game did
+	GameContext replay_context(reader.get_header().player_count, reader.get_header().seed);
+	Board replay_board = Board(reader.get_header().get_layout());
+	GameLogReplayer replayer(replay_board, replay_context);
+	std::size_t applied = replayer.replay(reader);
+	bool same_points = true;
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		same_points = same_points &&
+			context.get_player(color)->get_points(board) == replay_context.get_player(color)->get_points(replay_board);
+	}
+	if (applied != events_written || replayer.get_winner() != winner || !same_points ||
+		(board.get_bitboards().get_hash() ^ context.get_hash()) !=
+		(replay_board.get_bitboards().get_hash() ^ replay_context.get_hash())) {
+		passed = false;
+		cout << "FAILED GAMELOG REPLAY TEST" << endl;
+	}
+
+	// A board picked by the BoardBalancer isn't the one its seed makes, so it is made again from the logged layout
+	BalanceOptions balance;
+	balance.time_ms = 0;
+	balance.max_candidates = 20;
+	GameContext balanced_context(4, 17);
+	Board balanced_board(balanced_context.get_board_random(), balance);
+	std::uint8_t header_bytes[GameLogHeader::SIZE];
+	GameLogHeader::describe(balanced_board, balanced_context).encode(header_bytes);
+	GameLogHeader balanced_header;
+	GameContext seed_context(4, 17);
+	if (!balanced_header.decode(header_bytes) || !balanced_header.matches(balanced_board) ||
+		!balanced_header.matches(Board(balanced_header.get_layout())) ||
+		balanced_header.matches(Board(seed_context.get_board_random()))) {
+		passed = false;
+		cout << "FAILED GAMELOG BALANCED BOARD TEST" << endl;
+	}
+
+	// An event that doesn't fit the game is refused
+	GameEvent taken_plot{EVENT_SETTLEMENT, BLUE, 0, 0};
+	taken_plot.target = static_cast<std::uint8_t>(lowest_bit(replay_board.get_bitboards().get_settlements(RED) |
+		replay_board.get_bitboards().get_cities(RED)));
+	if (replayer.apply(taken_plot) || replayer.apply(GameEvent{EVENT_GAIN, BLUE, TILE_EMPTY, 1}) ||
+		replayer.apply(GameEvent{EVENT_TYPE_COUNT, BLUE, 0, 0})) {
+		passed = false;
+		cout << "FAILED GAMELOG INVALID EVENT TEST" << endl;
+	}
+
+	// So is losing cards the player doesn't hold
+	ResourceVector blue_hand = replay_context.get_player(BLUE)->get_resources();
+	std::uint8_t too_many = static_cast<std::uint8_t>(blue_hand.get(ORE) + 1);
+	if (replayer.apply(GameEvent{EVENT_LOSE, BLUE, ORE, too_many}) ||
+		replayer.apply(GameEvent{EVENT_RETURN_TO_BANK, BLUE, ORE, too_many}) ||
+		replay_context.get_player(BLUE)->get_resources() != blue_hand) {
+		passed = false;
+		cout << "FAILED GAMELOG INVALID DISCARD TEST" << endl;
+	}
+	reader.close();
+
+	// Or taking more from the bank than it holds, which stops a replay there
+	const string bank_path = "test_bank_game.hxlog";
+	GameContext bank_context(4, 17);
+	Board bank_board = Board(bank_context.get_board_random());
+	GameLogWriter bank_log;
+	bank_log.open(bank_path, GameLogHeader::describe(bank_board, bank_context));
+	bank_log.append(EVENT_GAIN_FROM_BANK, BLUE, ORE, 2);
+	bank_log.append(EVENT_GAIN_FROM_BANK, BLUE, ORE, 18);
+	bank_log.append(EVENT_GAIN_FROM_BANK, BLUE, ORE, 1);
+	bank_log.close();
+	GameLogReplayer bank_replayer(bank_board, bank_context);
+	GameLogReader bank_reader;
+	if (!bank_reader.open(bank_path) || bank_replayer.replay(bank_reader) != 1 ||
+		bank_context.get_player(BLUE)->get_amount_of_resource(ORE) != 2 ||
+		bank_context.get_bank().get_available_resources().get(ORE) != 17) {
+		passed = false;
+		cout << "FAILED GAMELOG INVALID BANK GAIN TEST" << endl;
+	}
+	bank_reader.close();
+	std::remove(bank_path.c_str());
+
+	// Files that aren't logs of this version don't open
+	bool refused = true;
+	for (int corrupt_byte : {4, 0}) {
+		std::FILE *file = std::fopen(path.c_str(), "r+b");
+		std::fseek(file, corrupt_byte, SEEK_SET);
+		std::fputc(0x7F, file);
+		std::fclose(file);
+		refused = refused && !reader.open(path);
+	}
+	refused = refused && !reader.open("missing_game.hxlog");
+	if (!refused) {
+		passed = false;
+		cout << "FAILED GAMELOG CORRUPT TEST" << endl;
+	}
+	std::remove(path.c_str());
+
+	return passed;
+}
+
+bool test_GameSave() {
+	bool passed = true;
+
+	// Stop a game in the middle, after someone has bought devcards this turn
+	GameContext context(4, 23);
+	Board board = Board(context.get_board_random());
+	map<player_color, shared_ptr<Agent>> agents;
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		agents[color] = make_shared<RandomAgent>();
+	}
+	GameEngine engine(board, context, agents);
+	engine.setup();
+	for (int turn = 0; turn < 60 && engine.get_winner() == COLOR_EMPTY; turn++) {
+		engine.play_turn();
+	}
+	shared_ptr<Player> player = engine.get_current_player();
+	player->start_new_turn();
+	player->gain_many_resources({{GRAIN, 2}, {WOOL, 2}, {ORE, 2}}, true, false);
+	engine.apply_action(player, Action{BUY_DEVCARD});
+	engine.apply_action(player, Action{BUY_DEVCARD});
+	SavedGame saved{context.get_seed(), engine.get_state()};
+
+	SavedGame from_binary;
+	SavedGame from_text;
+	vector<std::uint8_t> bytes = GameSave::encode_binary(saved);
+	string text = GameSave::encode_text(saved);
+	if (!GameSave::decode_binary(bytes.data(), bytes.size(), from_binary) || GameSave::encode_binary(from_binary) != bytes ||
+		!GameSave::decode_text(text, from_text) || GameSave::encode_binary(from_text) != bytes ||
+		from_text.seed != 23 || bytes.size() > 512) {
+		passed = false;
+		cout << "FAILED GAMESAVE ROUND TRIP TEST" << endl;
+	}
+
+	BoardLayout layout = GameSave::get_layout(saved.state);
+	BoardLayout original_layout = board.get_layout();
+	if (layout.tile_types != original_layout.tile_types || layout.tile_numbers != original_layout.tile_numbers ||
+		layout.port_types != original_layout.port_types) {
+		passed = false;
+		cout << "FAILED GAMESAVE LAYOUT TEST" << endl;
+	}
+
+	// The loaded game is the same game, down to the devcards bought this turn, and can be played to the end
+	GameContext loaded_context(from_binary.state.player_count, from_binary.seed);
+	Board loaded_board = Board(GameSave::get_layout(from_binary.state));
+	GameEngine loaded_engine(loaded_board, loaded_context, agents);
+	bool restored = GameSave::restore(from_binary.state, loaded_board, loaded_context);
+	loaded_engine.resume(from_binary.state);
+	if (!restored || loaded_engine.get_hash() != engine.get_hash() ||
+		GameSave::encode_binary(SavedGame{loaded_context.get_seed(), loaded_engine.get_state()}) != bytes) {
+		passed = false;
+		cout << "FAILED GAMESAVE RESTORE TEST" << endl;
+	}
+	if (loaded_engine.play_game(2000) == COLOR_EMPTY) {
+		passed = false;
+		cout << "FAILED GAMESAVE RESUME TEST" << endl;
+	}
+
+	// Saves that are cut short, out of range or don't add up are refused
+	SavedGame refused;
+	string out_of_range = text;
+	std::size_t robber_line = out_of_range.find("robber_tile");
+	out_of_range.replace(robber_line, out_of_range.find('\n', robber_line) - robber_line, "robber_tile 40");
+	GameState extra_resource = saved.state;
+	extra_resource.bank_resources[GRAIN]++;
+	if (GameSave::decode_binary(bytes.data(), bytes.size() - 1, refused) ||
+		GameSave::decode_text(out_of_range, refused) ||
+		GameSave::decode_text(text.substr(0, text.size() / 2), refused) ||
+		GameSave::is_valid(extra_resource)) {
+		passed = false;
+		cout << "FAILED GAMESAVE INVALID TEST" << endl;
+	}
+
+	// Either format loads from a file
+	const string path = "test_game.hxsave";
+	bool loaded = true;
+	for (save_format format : {SAVE_BINARY, SAVE_TEXT}) {
+		SavedGame from_file;
+		loaded = loaded && GameSave::save(path, saved, format) && GameSave::load(path, from_file) &&
+			GameSave::encode_binary(from_file) == bytes;
+	}
+	std::remove(path.c_str());
+	if (!loaded || GameSave::load("missing_game.hxsave", refused)) {
+		passed = false;
+		cout << "FAILED GAMESAVE FILE TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_GameState() {
+	bool passed = true;
+
+	GameContext context(4, 3);
+	Board board = Board(context.get_board_random());
+	map<player_color, shared_ptr<Agent>> agents;
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		agents[color] = make_shared<RandomAgent>();
+	}
+	GameEngine engine(board, context, agents);
+	engine.setup();
+	for (int i = 0; i < 60; i++) {
+		engine.play_turn();
+	}
+	GameState state = engine.get_state();
+
+	bool same_game = state.player_count == 4 && state.turn_count == engine.get_turn_count() &&
+		state.current_player == engine.get_current_player()->get_color() &&
+		state.robber_tile == board.get_bitboards().get_production_table().get_robber_tile();
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		shared_ptr<Player> player = context.get_player(color);
+		const PlayerState &player_state = state.players[color];
+		same_game = same_game &&
+			state.get_points(color, true) == player->get_points(board, true) &&
+			state.get_points(color, false) == player->get_points(board, false) &&
+			state.get_settlements(color) == board.get_bitboards().get_settlements(color) &&
+			state.get_cities(color) == board.get_bitboards().get_cities(color) &&
+			state.get_roads(color) == board.get_bitboards().get_roads(color) &&
+			player_state.get_resource_count() == player->get_number_of_resources() &&
+			player_state.resources[ORE] == player->get_amount_of_resource(ORE) &&
+			player_state.knights == player->get_number_of_knights() &&
+			player_state.roads_left == player->get_road_pieces();
+	}
+	size_t deck_size = 0;
+	for (int count : state.deck) {
+		deck_size += count;
+	}
+	same_game = same_game && deck_size == context.get_bank().get_available_devcards().size() &&
+		state.bank_resources[GRAIN] == context.get_bank().get_available_resources().get(GRAIN);
+	if (!same_game) {
+		passed = false;
+		cout << "FAILED GAMESTATE CAPTURE TEST" << endl;
+	}
+
+	// A copy is a separate game
+	GameState clone = state;
+	if (std::memcmp(&clone, &state, sizeof(GameState)) != 0) {
+		passed = false;
+		cout << "FAILED GAMESTATE CLONE TEST" << endl;
+	}
+	clone.players[RED].resources[GRAIN]++;
+	clone.path_owners[0] = BLUE;
+	if (state.players[RED].resources[GRAIN] != context.get_player(RED)->get_amount_of_resource(GRAIN) ||
+		state.path_owners[0] != GameState::capture(board, context).path_owners[0]) {
+		passed = false;
+		cout << "FAILED GAMESTATE CLONE INDEPENDENCE TEST" << endl;
+	}
+
+	// Capturing the same game twice gives the same bytes
+	GameState again = engine.get_state();
+	if (std::memcmp(&again, &state, sizeof(GameState)) != 0) {
+		passed = false;
+		cout << "FAILED GAMESTATE CAPTURE REPEAT TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_Instrumentation() {
+	bool passed = true;
+
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
+	stringstream report;
+
+	if (!Instrumentation::is_compiled_in()) {
+		board.get_plot(OrderedPair(0, 0));
+		Instrumentation::report(report);
+		if (Instrumentation::get_stats("Board::get_plot").calls != 0 ||
+			report.str().find("without instrumentation") == string::npos) {
+			passed = false;
+			cout << "FAILED INSTRUMENTATION COMPILED OUT TEST" << endl;
+		}
+		return passed;
+	}
+
+	// Every call is counted, and overloads of the same function add up under one name
+	uint64_t plot_calls = Instrumentation::get_stats("Board::get_plot").calls;
+	uint64_t path_calls = Instrumentation::get_stats("Board::get_path").calls;
+	for (int i = 0; i < 25; i++) {
+		board.get_plot(OrderedPair(0, 0));
+	}
+	board.get_path(OrderedPair(-1, 0), OrderedPair(-1, 1));
+	board.get_path(board.get_plot(OrderedPair(-1, 0)), 0);
+	InstrumentStats plot_stats = Instrumentation::get_stats("Board::get_plot");
+	if (plot_stats.calls != plot_calls + 26 || plot_stats.ticks != 0 ||
+		Instrumentation::get_stats("Board::get_path").calls != path_calls + 2) {
+		passed = false;
+		cout << "FAILED INSTRUMENTATION COUNT TEST" << endl;
+	}
+
+	// A timed site records its time, and the allocations made while it ran
+	OutputSink silent(nullptr);
+	InstrumentStats before = Instrumentation::get_stats("Board::display_board");
+	uint64_t allocations = Instrumentation::get_thread_allocations();
+	OutputSink::set_current(&silent);
+	board.display_board();
+	OutputSink::set_current(nullptr);
+	InstrumentStats after = Instrumentation::get_stats("Board::display_board");
+	if (after.calls != before.calls + 1 || after.ticks <= before.ticks ||
+		after.allocations <= before.allocations || Instrumentation::get_thread_allocations() <= allocations) {
+		passed = false;
+		cout << "FAILED INSTRUMENTATION SCOPE TEST" << endl;
+	}
+
+	// Calls on other threads are counted, even after the thread has finished
+	uint64_t tile_calls = Instrumentation::get_stats("Board::get_tile").calls;
+	std::thread worker([&board]() {
+		for (int i = 0; i < 10; i++) {
+			board.get_tile(OrderedPair(0, 0));
+		}
+	});
+	worker.join();
+	if (Instrumentation::get_stats("Board::get_tile").calls != tile_calls + 10) {
+		passed = false;
+		cout << "FAILED INSTRUMENTATION THREAD TEST" << endl;
+	}
+
+	Instrumentation::report(report);
+	if (report.str().find("Board::get_plot") == string::npos ||
+		report.str().find("Board::display_board") == string::npos ||
+		report.str().find("Allocations on this thread") == string::npos ||
+		Instrumentation::get_stats("No such site").calls != 0) {
+		passed = false;
+		cout << "FAILED INSTRUMENTATION REPORT TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_LegalActionGenerator() {
+	bool passed = true;
+
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
+	shared_ptr<Player> red = context.get_player(RED);
+	ActionList actions;
+
+	LegalActionGenerator::generate(board, *red, context.get_bank(), actions);
+	if (actions.size() != 1 || actions[0].type != PASS_TURN) {
+		passed = false;
+		cout << "FAILED LEGALACTIONGENERATOR ONLY PASS TEST" << endl;
+	}
+
+	board.get_plot(OrderedPair(-1, 0))->set_inhabitant(Building(red, SETTLEMENT));
+	board.get_path(OrderedPair(-1, 0), OrderedPair(-1, 1))->set_inhabitant(Road(red));
+	red->gain_many_resources({{BRICK, 1}, {LUMBER, 1}, {GRAIN, 4}}, true, false);
+
+	// 4 paths next to the road, no room for a settlement, and 4 grain can be traded for any of the other 4 resources
+	LegalActionGenerator::generate(board, *red, context.get_bank(), actions);
+	if (actions.count_of(BUILD_ROAD) != 4 || actions.count_of(BUILD_SETTLEMENT) != 0 ||
+		actions.count_of(MARITIME_TRADE) != 4 || actions.count_of(PASS_TURN) != 1) {
+		passed = false;
+		cout << "FAILED LEGALACTIONGENERATOR ROAD AND TRADE TEST" << endl;
+	}
+
+	for (const Action &action : actions) {
+		if (action.type == BUILD_ROAD && !board.get_bitboards().get_buildable_paths(RED, true).test(action.target)) {
+			passed = false;
+			cout << "FAILED LEGALACTIONGENERATOR ROAD TARGET TEST" << endl;
+			break;
+		}
+	}
+
+	red->gain_devcard(KNIGHT, false);
+	LegalActionGenerator::generate(board, *red, context.get_bank(), actions);
+	if (actions.count_of(PLAY_DEVCARD) != 0) {
+		passed = false;
+		cout << "FAILED LEGALACTIONGENERATOR NEW DEVCARD TEST" << endl;
+	}
+	red->start_new_turn();
+	LegalActionGenerator::generate(board, *red, context.get_bank(), actions);
+	if (actions.count_of(PLAY_DEVCARD) != 1) {
+		passed = false;
+		cout << "FAILED LEGALACTIONGENERATOR PLAY DEVCARD TEST" << endl;
+	}
+	red->set_played_devcard_this_turn(true);
+	LegalActionGenerator::generate(board, *red, context.get_bank(), actions);
+	if (actions.count_of(PLAY_DEVCARD) != 0) {
+		passed = false;
+		cout << "FAILED LEGALACTIONGENERATOR ONE DEVCARD PER TURN TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_LongestRoadEngine() {
+	bool passed = true;
+
+	GameContext context(4);
+	shared_ptr<Player> red = context.get_player(RED);
+	shared_ptr<Player> yellow = context.get_player(YELLOW);
+
+	// Two separate networks, neither of which starts from an initial road
+	Board board = Board(context.get_board_random());
+	board.get_path(OrderedPair(-1, 0), OrderedPair(-1, 1))->set_inhabitant(Road(red));
+	board.get_path(OrderedPair(-1, -3), OrderedPair(1, -3))->set_inhabitant(Road(red));
+	board.get_path(OrderedPair(1, -3), OrderedPair(1, -4))->set_inhabitant(Road(red));
+	board.get_path(OrderedPair(1, -4), OrderedPair(1, -5))->set_inhabitant(Road(red));
+	const LongestRoadEngine &engine = board.get_bitboards().get_road_engine();
+	if (engine.get_length(RED) != 3 || engine.get_components(RED).size() != 2 || engine.get_length(YELLOW) != 0) {
+		passed = false;
+		cout << "FAILED LONGESTROADENGINE DISCONNECTED NETWORKS TEST: " << engine.get_length(RED) << endl;
+	}
+
+	// A loop around the center tile with a spur off of it. The longest trail starts at the spur and goes all the way around
+	Board loop_board = Board(context.get_board_random());
+	vector<OrderedPair> ring = {OrderedPair(-1, 1), OrderedPair(1, 1), OrderedPair(1, 0),
+		OrderedPair(1, -1), OrderedPair(-1, -1), OrderedPair(-1, 0)};
+	for (size_t i = 0; i < ring.size(); i++) {
+		loop_board.get_path(ring[i], ring[(i + 1) % ring.size()])->set_inhabitant(Road(red));
 	}
-	if (bank.get_player(1) == nullptr) {
+	loop_board.get_path(OrderedPair(1, 1), OrderedPair(1, 2))->set_inhabitant(Road(red));
+	if (loop_board.get_bitboards().get_road_length(RED) != 7) {
 		passed = false;
-		cout << "FAILED GAMEBANK GETPLAYER WITH INT TEST" << endl;
+		cout << "FAILED LONGESTROADENGINE LOOP TEST: " << loop_board.get_bitboards().get_road_length(RED) << endl;
 	}
 
-	if (bank.get_longest_road_player() != nullptr) {
-		passed = false;
-		cout << "FAILED GAMEBANK GET LONGEST ROAD PLAYER TEST" << endl;
+	// A chain of 5 is broken in two by an opponent's settlement
+	Board chain_board = Board(context.get_board_random());
+	for (int i = 0; i < 5; i++) {
+		chain_board.get_path(ring[i], ring[i + 1])->set_inhabitant(Road(red));
 	}
-	if (bank.get_largest_army_player() != nullptr) {
+	chain_board.report_road_lengths(false);
+	if (chain_board.get_bitboards().get_road_length(RED) != 5 || red->get_length_of_road() != 5) {
 		passed = false;
-		cout << "FAILED GAMEBANK GET LARGEST ARMY PLAYER TEST" << endl;
+		cout << "FAILED LONGESTROADENGINE CHAIN TEST: " << chain_board.get_bitboards().get_road_length(RED) << endl;
 	}
-	bank.get_player(RED)->set_largest_army(true);
-	bank.get_player(YELLOW)->set_longest_road(true);
-	if (bank.get_longest_road_player() != bank.get_player(YELLOW)) {
+	chain_board.get_plot(OrderedPair(1, 0))->set_inhabitant(Building(yellow, SETTLEMENT));
+	chain_board.report_road_lengths(false);
+	const LongestRoadEngine &chain_engine = chain_board.get_bitboards().get_road_engine();
+	if (chain_engine.get_length(RED) != 3 || chain_engine.get_components(RED).size() != 2 || red->get_length_of_road() != 3) {
 		passed = false;
-		cout << "FAILED GAMEBANK GET LONGEST ROAD PLAYER TEST" << endl;
+		cout << "FAILED LONGESTROADENGINE BROKEN ROAD TEST: " << chain_engine.get_length(RED) << endl;
+	}
+
+	// The player's own buildings don't break their road
+	Board own_board = Board(context.get_board_random());
+	for (int i = 0; i < 5; i++) {
+		own_board.get_path(ring[i], ring[i + 1])->set_inhabitant(Road(red));
 	}
-	if (bank.get_largest_army_player() != bank.get_player(RED)) {
+	own_board.get_plot(OrderedPair(1, 0))->set_inhabitant(Building(red, SETTLEMENT));
+	if (own_board.get_bitboards().get_road_length(RED) != 5) {
 		passed = false;
-		cout << "FAILED GAMEBANK GET LARGEST ARMY PLAYER TEST" << endl;
+		cout << "FAILED LONGESTROADENGINE OWN BUILDING TEST: " << own_board.get_bitboards().get_road_length(RED) << endl;
 	}
 
-	bank.get_player(RED)->set_largest_army(false);
-	bank.get_player(YELLOW)->set_longest_road(false);
-
 	return passed;
 }
 
@@ -391,7 +1481,8 @@ bool test_Path() {
 		cout << "FAILED PATH OVERRIDE ICON HORIZONTAL TEST" << endl;
 	}
 
-	path2.set_inhabitant(Road(GameBank::instance(4).get_player(RED)));
+	GameContext context(4);
+	path2.set_inhabitant(Road(context.get_player(RED)));
 	if (!path2.is_occupied()) {
 		passed = false;
 		cout << "FAILED PATH OCCUPIED TEST" << endl;
@@ -406,7 +1497,7 @@ bool test_Path() {
 		cout << "FAILED PATH CALCULATING DIRECTION TEST" << endl;
 	}
 
-	Board board = Board();
+	Board board = Board(context.get_board_random());
 	// pic -> path in context
 	shared_ptr<Path> pic1 = board.get_path(board.get_plot(OrderedPair(-1, 0)), 1);
 	shared_ptr<Path> pic2 = board.get_path(board.get_plot(OrderedPair(-1, 0)), -1);
@@ -415,13 +1506,13 @@ bool test_Path() {
 		passed = false;
 		cout << "FAILED PATH ADJACENT MATCHING ROAD TEST 1" << endl;
 	}
-	pic1->set_inhabitant(Road(GameBank::instance().get_player(RED)));
-	pic2->set_inhabitant(Road(GameBank::instance().get_player(YELLOW)));
+	pic1->set_inhabitant(Road(context.get_player(RED)));
+	pic2->set_inhabitant(Road(context.get_player(YELLOW)));
 	if (pic1->has_adjacent_matching_road(RED)) {
 		passed = false;
 		cout << "FAILED PATH ADJACENT MATCHING ROAD TEST 2" << endl;
 	}
-	pic3->set_inhabitant(Road(GameBank::instance().get_player(RED)));
+	pic3->set_inhabitant(Road(context.get_player(RED)));
 	if (!pic1->has_adjacent_matching_road(RED)) {
 		passed = false;
 		cout << "FAILED PATH ADJACENT MATCHING ROAD TEST 3" << endl;
@@ -430,6 +1521,133 @@ bool test_Path() {
 	return passed;
 }
 
+bool test_MctsAgent() {
+	bool passed = true;
+
+	GameContext context(4, 11);
+	Board board = Board(context.get_board_random());
+	MctsOptions options;
+	options.time_ms = 5;
+	options.threads = 2;
+	shared_ptr<MctsAgent> mcts = make_shared<MctsAgent>(options);
+	map<player_color, shared_ptr<Agent>> agents;
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		agents[color] = make_shared<RandomAgent>();
+	}
+	agents[RED] = mcts;
+	GameEngine engine(board, context, agents);
+	engine.setup();
+
+	// Give red enough to have a real choice
+	for (tile_type resource : {GRAIN, WOOL, BRICK, ORE, LUMBER}) {
+		context.get_player(RED)->gain_many_resources({{resource, 3}}, true, false);
+	}
+	GameState state = engine.get_state();
+	ActionList legal_actions;
+	StateEngine::generate(state, legal_actions);
+
+	options.time_ms = 10000;
+	options.max_playouts = 300;
+	MctsResult result = MctsAgent(options).search(state, 1);
+	bool legal = false;
+	for (const Action &action : legal_actions) {
+		legal = legal || (action.type == result.action.type && action.target == result.action.target &&
+			action.give == result.action.give && action.receive == result.action.receive);
+	}
+	if (!legal || result.visits <= 0 || result.playouts < 300 || result.playouts > 300 + options.threads) {
+		passed = false;
+		cout << "FAILED MCTSAGENT SEARCH TEST" << endl;
+	}
+
+	// Building the same things in a different order reaches positions already in the table
+	if (result.transpositions <= 0) {
+		passed = false;
+		cout << "FAILED MCTSAGENT TRANSPOSITION TEST" << endl;
+	}
+	options.transposition_log2 = 0;
+	MctsResult no_table = MctsAgent(options).search(state, 1);
+	options.transposition_log2 = 16;
+	if (no_table.transpositions != 0 || no_table.playouts < 300) {
+		passed = false;
+		cout << "FAILED MCTSAGENT NO TRANSPOSITION TABLE TEST" << endl;
+	}
+
+	// The time budget holds, including setting up and tearing down the search
+	options.time_ms = 50;
+	options.max_playouts = 0;
+	auto start = std::chrono::steady_clock::now();
+	MctsAgent(options).search(state, 2);
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+	if (elapsed.count() > 200) {
+		passed = false;
+		cout << "FAILED MCTSAGENT TIME BUDGET TEST" << endl;
+	}
+
+	// A whole game through the engine, against random players
+	player_color winner = engine.play_game(400);
+	if (winner == COLOR_EMPTY || context.get_player(winner)->get_points(board) < ScoreTracker::WINNING_POINTS) {
+		passed = false;
+		cout << "FAILED MCTSAGENT GAME TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_OutputSink() {
+	bool passed = true;
+
+	stringstream target;
+	OutputSink sink(&target);
+	sink.get_stream() << "Red gained 2 grain" << '\n' << "Blue gained 1 ore\n" << "...";
+	if (!target.str().empty() || sink.get_line_count() != 2 || sink.get_byte_count() != 40 ||
+		sink.get_flush_count() != 0) {
+		passed = false;
+		cout << "FAILED OUTPUTSINK BUFFER TEST" << endl;
+	}
+
+	sink.flush();
+	sink.flush();
+	if (target.str() != "Red gained 2 grain\nBlue gained 1 ore\n..." || sink.get_flush_count() != 1) {
+		passed = false;
+		cout << "FAILED OUTPUTSINK FLUSH TEST" << endl;
+	}
+
+	// endl still flushes, and a full buffer writes itself out
+	sink.get_stream() << endl;
+	string long_line(OutputSink::BUFFER_SIZE, '-');
+	sink.get_stream() << long_line;
+	if (sink.get_flush_count() != 3 || target.str().size() != 41 + OutputSink::BUFFER_SIZE) {
+		passed = false;
+		cout << "FAILED OUTPUTSINK AUTOMATIC FLUSH TEST" << endl;
+	}
+
+	OutputSink silent(nullptr);
+	silent.get_stream() << "Nobody sees this\n";
+	silent.flush();
+	if (!silent.is_silent() || sink.is_silent() || silent.get_line_count() != 1 ||
+		silent.get_byte_count() != 17 || silent.get_flush_count() != 0) {
+		passed = false;
+		cout << "FAILED OUTPUTSINK SILENT TEST" << endl;
+	}
+
+	// Displaying the board is one frame, written in one go
+	stringstream frame;
+	OutputSink frame_sink(&frame);
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
+	OutputSink::set_current(&frame_sink);
+	board.display_board();
+	bool current = &game_output() == &frame_sink.get_stream();
+	OutputSink::set_current(nullptr);
+	if (!current || frame_sink.get_flush_count() != 1 || frame_sink.get_line_count() != BoardRenderer::ROWS + 2 ||
+		frame.str().size() != frame_sink.get_byte_count() || &game_output() == &frame_sink.get_stream()) {
+		passed = false;
+		cout << "FAILED OUTPUTSINK CURRENT SINK TEST" << endl;
+	}
+
+	return passed;
+}
+
 bool test_Plot() {
 	bool passed = true;
 
@@ -446,11 +1664,12 @@ bool test_Plot() {
 		cout << "FAILED PLOT ICON OVERRIDE TEST" << endl;
 	}
 
-	Board board = Board();
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
 	shared_ptr<Plot> pic1 = board.get_plot(OrderedPair(-1, 0));
 	shared_ptr<Plot> pic2 = board.get_plot(OrderedPair(-1, 1));
 
-	pic1->set_inhabitant(Building(GameBank::instance().get_player(RED), SETTLEMENT));
+	pic1->set_inhabitant(Building(context.get_player(RED), SETTLEMENT));
 	if (!pic2->next_to_building()) {
 		passed = false;
 		cout << "FAILED PLOT NEXT TO BUILDING TEST 1" << endl;
@@ -474,10 +1693,10 @@ bool test_Plot() {
 bool test_Player() {
 	bool passed = true;
 
-	GameBank bank = GameBank::instance(4);
-	Board board = Board();
-	shared_ptr<Player> red = bank.get_player(RED);
-	shared_ptr<Player> yellow = bank.get_player(YELLOW);
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
+	shared_ptr<Player> red = context.get_player(RED);
+	shared_ptr<Player> yellow = context.get_player(YELLOW);
 
 	if (red->get_points(board, true) != 0) {
 		passed = false;
@@ -597,14 +1816,315 @@ bool test_Player() {
 	return passed;
 }
 
+bool test_ProductionTable() {
+	bool passed = true;
+
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
+	shared_ptr<Player> red = context.get_player(RED);
+	const ProductionTable &production = board.get_bitboards().get_production_table();
+
+	for (int roll = ProductionTable::MIN_ROLL; roll <= ProductionTable::MAX_ROLL; roll++) {
+		if (!production.get_production(roll).empty()) {
+			passed = false;
+			cout << "FAILED PRODUCTIONTABLE EMPTY BOARD TEST" << endl;
+		}
+	}
+	if (!production.get_tiles(7).empty() || production.get_robber_tile() == INVALID_ID) {
+		passed = false;
+		cout << "FAILED PRODUCTIONTABLE ROLL TILES TEST" << endl;
+	}
+
+	// Find a tile which produces, and settle on one of its corners
+	TileId tile = 0;
+	while (board.get_tile_by_id(tile).get_production_number() < ProductionTable::MIN_ROLL) {
+		tile++;
+	}
+	int roll = board.get_tile_by_id(tile).get_production_number();
+	tile_type resource = board.get_tile_by_id(tile).get_type();
+	PlotId plot = board.get_graph().get_tile_plots(tile)[0];
+
+	// Other tiles around the plot might have the same number and resource, so count every one of them
+	int producing_tiles = 0;
+	for (TileId t : board.get_graph().get_plot_tiles(plot)) {
+		if (t != INVALID_ID && board.get_tile_by_id(t).get_production_number() == roll &&
+			board.get_tile_by_id(t).get_type() == resource) {
+			producing_tiles++;
+		}
+	}
+
+	// Another tile around the plot might share the roll but not the resource, so only look at the resource's entry
+	auto amount_on_roll = [&production, roll, resource]() {
+		int amount = 0;
+		for (const ProductionEntry &entry : production.get_production(roll)) {
+			if (entry.color == RED && entry.resource == resource) {
+				amount += entry.amount;
+			}
+		}
+		return amount;
+	};
+
+	board.get_plot_by_id(plot)->set_inhabitant(Building(red, SETTLEMENT));
+	if (production.get_production(roll).empty() || amount_on_roll() != producing_tiles) {
+		passed = false;
+		cout << "FAILED PRODUCTIONTABLE SETTLEMENT TEST" << endl;
+	}
+
+	board.get_plot_by_id(plot)->upgrade_inhabitant();
+	board.generate_resources(roll, false);
+	if (red->get_amount_of_resource(resource) != 2 * producing_tiles) {
+		passed = false;
+		cout << "FAILED PRODUCTIONTABLE CITY TEST: " << red->get_amount_of_resource(resource) << endl;
+	}
+
+	string previous_robber = board.get_tile_with_robber().get_position_id();
+	board.set_robber_position(board.get_tile_by_id(tile).get_position_id());
+	if (production.get_robber_tile() != tile || amount_on_roll() != 2 * (producing_tiles - 1)) {
+		passed = false;
+		cout << "FAILED PRODUCTIONTABLE ROBBER TEST" << endl;
+	}
+	board.set_robber_position(previous_robber);
+	if (amount_on_roll() != 2 * producing_tiles) {
+		passed = false;
+		cout << "FAILED PRODUCTIONTABLE ROBBER MOVED AWAY TEST" << endl;
+	}
+
+	// Setting a tile again moves it to its new roll, and its production with it
+	ProductionTable table(2);
+	table.set_tile(0, ORE, 6, {0, 1, INVALID_ID, INVALID_ID, INVALID_ID, INVALID_ID});
+	table.building_placed(0, RED, SETTLEMENT);
+	table.set_tile(0, ORE, 9, {0, 1, INVALID_ID, INVALID_ID, INVALID_ID, INVALID_ID});
+	if (!table.get_tiles(6).empty() || table.get_tiles(9).size() != 1 || !table.get_production(6).empty() ||
+		table.get_production(9).size() != 1 || table.get_production(9)[0].amount != 1) {
+		passed = false;
+		cout << "FAILED PRODUCTIONTABLE SET TILE AGAIN TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_ResourceVector() {
+	bool passed = true;
+
+	ResourceVector hand = {{GRAIN, 3}, {WOOL, 1}, {BRICK, 2}, {LUMBER, 1}, {DESERT, 4}};
+	if (hand.get(GRAIN) != 3 || hand.get(ORE) != 0 || hand.get(DESERT) != 0 || hand.get(TILE_EMPTY) != 0 ||
+		hand.get_total() != 7 || hand.is_empty() || !ResourceVector().is_empty()) {
+		passed = false;
+		cout << "FAILED RESOURCEVECTOR GET TEST" << endl;
+	}
+
+	// Every lane is compared at once, and a short lane anywhere means the hand can't cover it
+	if (!hand.covers(Craftable::SETTLEMENT_RECIPE) || !hand.covers(Craftable::ROAD_RECIPE) ||
+		hand.covers(Craftable::CITY_RECIPE) || hand.covers(Craftable::DEVCARD_RECIPE) ||
+		!hand.covers(ResourceVector()) || !hand.covers(hand)) {
+		passed = false;
+		cout << "FAILED RESOURCEVECTOR COVERS TEST" << endl;
+	}
+	ResourceVector most = ResourceVector::filled(ResourceVector::MAX_AMOUNT);
+	if (!most.covers(most) || ResourceVector().covers(ResourceVector::filled(1)) ||
+		most.get_total() != 5 * ResourceVector::MAX_AMOUNT) {
+		passed = false;
+		cout << "FAILED RESOURCEVECTOR LARGEST AMOUNT TEST" << endl;
+	}
+
+	// Taking away stops at 0 in each lane without borrowing from its neighbour
+	ResourceVector spent = hand - Craftable::CITY_RECIPE;
+	ResourceVector gained = hand + Craftable::DEVCARD_RECIPE;
+	if (spent != ResourceVector({{GRAIN, 1}, {WOOL, 1}, {BRICK, 2}, {LUMBER, 1}}) ||
+		gained != ResourceVector({{GRAIN, 4}, {WOOL, 2}, {BRICK, 2}, {ORE, 1}, {LUMBER, 1}}) ||
+		gained - Craftable::DEVCARD_RECIPE != hand) {
+		passed = false;
+		cout << "FAILED RESOURCEVECTOR ARITHMETIC TEST" << endl;
+	}
+
+	ResourceVector capped = hand.capped_at(ResourceVector::filled(2));
+	if (capped != ResourceVector({{GRAIN, 2}, {WOOL, 1}, {BRICK, 2}, {LUMBER, 1}}) ||
+		ResourceVector::filled(2).capped_at(hand) != capped) {
+		passed = false;
+		cout << "FAILED RESOURCEVECTOR CAPPED TEST" << endl;
+	}
+
+	ResourceVector changed = hand;
+	changed.set(ORE, 200);
+	changed.add(WOOL, -5);
+	changed.set(DESERT, 1);
+	if (changed.get(ORE) != ResourceVector::MAX_AMOUNT || changed.get(WOOL) != 0 ||
+		changed.get(GRAIN) != 3 || changed.get(LUMBER) != 1) {
+		passed = false;
+		cout << "FAILED RESOURCEVECTOR SET TEST" << endl;
+	}
+
+	// Hands take from the bank only what it has left
+	GameContext context(2);
+	shared_ptr<Player> red = context.get_player(RED);
+	shared_ptr<Player> yellow = context.get_player(YELLOW);
+	yellow->gain_many_resources({{ORE, 18}}, true, false);
+	red->gain_many_resources({{ORE, 3}, {GRAIN, 2}}, true, false);
+	if (red->get_amount_of_resource(ORE) != 1 || red->get_amount_of_resource(GRAIN) != 2 ||
+		context.get_bank().get_available_resources().get(ORE) != 0 ||
+		context.get_bank().get_resources_drawn()[ORE] != 19) {
+		passed = false;
+		cout << "FAILED RESOURCEVECTOR BANK TEST" << endl;
+	}
+	red->discard_many_resources({{ORE, 5}, {GRAIN, 1}}, "spent", true, false);
+	if (red->get_resources() != ResourceVector({{GRAIN, 1}}) ||
+		context.get_bank().get_available_resources().get(ORE) != 1 ||
+		context.get_bank().get_available_resources().get(GRAIN) != 18) {
+		passed = false;
+		cout << "FAILED RESOURCEVECTOR DISCARD TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_ScoreTracker() {
+	bool passed = true;
+
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
+	shared_ptr<Player> red = context.get_player(RED);
+	shared_ptr<Player> blue = context.get_player(BLUE);
+	const ScoreTracker &scores = context.get_score_tracker();
+
+	board.get_plot(OrderedPair(-1, 0))->set_inhabitant(Building(red, SETTLEMENT));
+	board.get_plot(OrderedPair(3, -2))->set_inhabitant(Building(red, SETTLEMENT));
+	board.get_plot(OrderedPair(3, -2))->upgrade_inhabitant();
+	if (ScoreTracker::get_building_points(board.get_bitboards(), RED) != 3 ||
+		red->get_number_of_placed_building(board, SETTLEMENT) != 1 || red->get_number_of_placed_building(board, CITY) != 1) {
+		passed = false;
+		cout << "FAILED SCORETRACKER BUILDING POINTS TEST" << endl;
+	}
+
+	red->gain_devcard(VICTORY_POINT, false);
+	red->gain_devcard(KNIGHT, false);
+	if (scores.get_victory_point_cards(RED) != 1 || red->get_points(board, true) != 4 || red->get_points(board, false) != 3) {
+		passed = false;
+		cout << "FAILED SCORETRACKER VICTORY POINT CARD TEST: " << red->get_points(board, true) << endl;
+	}
+
+	red->set_length_of_road(5, false);
+	if (scores.get_longest_road_holder() != RED || context.get_longest_road_player() != red || red->get_points(board, true) != 6) {
+		passed = false;
+		cout << "FAILED SCORETRACKER LONGEST ROAD TEST" << endl;
+	}
+	blue->set_length_of_road(6, false);
+	if (scores.get_longest_road_holder() != BLUE || scores.get_title_points(RED) != 0 || scores.get_title_points(BLUE) != 2) {
+		passed = false;
+		cout << "FAILED SCORETRACKER LONGEST ROAD OVERTAKE TEST" << endl;
+	}
+
+	blue->set_largest_army(true);
+	blue->set_largest_army(false);
+	if (scores.get_largest_army_holder() != COLOR_EMPTY || context.get_largest_army_player() != nullptr) {
+		passed = false;
+		cout << "FAILED SCORETRACKER LARGEST ARMY TEST" << endl;
+	}
+
+	context.get_score_tracker().reset();
+	if (scores.get_longest_road_holder() != COLOR_EMPTY || scores.get_victory_point_cards(RED) != 0) {
+		passed = false;
+		cout << "FAILED SCORETRACKER RESET TEST" << endl;
+	}
+	return passed;
+}
+
+bool test_StateEngine() {
+	bool passed = true;
+
+	GameContext context(4, 21);
+	Board board = Board(context.get_board_random());
+	map<player_color, shared_ptr<Agent>> agents;
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		agents[color] = make_shared<RandomAgent>();
+	}
+	GameEngine engine(board, context, agents);
+	engine.setup();
+	for (int i = 0; i < 40; i++) {
+		engine.play_turn();
+	}
+	shared_ptr<Player> player = engine.get_current_player();
+	for (tile_type resource : {GRAIN, WOOL, BRICK, ORE, LUMBER}) {
+		player->gain_many_resources({{resource, 4}}, true, false);
+	}
+	GameState state = engine.get_state();
+
+	// The same legal actions as the LegalActionGenerator lists
+	ActionList state_actions;
+	ActionList board_actions;
+	StateEngine::generate(state, state_actions);
+	LegalActionGenerator::generate(board, *player, context.get_bank(), board_actions);
+	bool same_actions = state_actions.size() == board_actions.size();
+	for (const Action &action : board_actions) {
+		bool found = false;
+		for (const Action &other : state_actions) {
+			found = found || (action.type == other.type && action.target == other.target && action.give == other.give &&
+				action.give_amount == other.give_amount && action.receive == other.receive);
+		}
+		same_actions = same_actions && found;
+	}
+	if (!same_actions) {
+		passed = false;
+		cout << "FAILED STATEENGINE LEGAL ACTIONS TEST" << endl;
+	}
+
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		if (StateEngine::get_road_length(state, color) != board.get_bitboards().get_road_length(color) ||
+			StateEngine::get_trade_rate(state, color, ORE) != board.get_bitboards().get_trade_rate(color, ORE)) {
+			passed = false;
+			cout << "FAILED STATEENGINE ROAD LENGTH AND TRADE RATE TEST" << endl;
+			break;
+		}
+	}
+
+	// Building a city
+	Action city;
+	for (const Action &action : state_actions) {
+		if (action.type == BUILD_CITY) {
+			city = action;
+		}
+	}
+	if (city.type == BUILD_CITY) {
+		GameState built = state;
+		int points = built.get_points(player->get_color());
+		StateEngine::apply_action(built, city, context.get_random());
+		if (!built.plot_cities[city.target] || built.get_points(player->get_color()) != points + 1 ||
+			built.players[player->get_color()].resources[ORE] != state.players[player->get_color()].resources[ORE] - 3 ||
+			built.bank_resources[ORE] != state.bank_resources[ORE] + 3) {
+			passed = false;
+			cout << "FAILED STATEENGINE BUILD CITY TEST" << endl;
+		}
+	}
+
+	// Playing on to the end never makes or loses a card
+	GameRandom random(4);
+	StatePolicy::play_out(state, random, 1000);
+	bool conserved = true;
+	for (tile_type resource : {GRAIN, WOOL, BRICK, ORE, LUMBER}) {
+		int total = state.bank_resources[resource];
+		for (const PlayerState &player_state : state.players) {
+			total += player_state.resources[resource];
+		}
+		conserved = conserved && total == 19;
+	}
+	if (!conserved) {
+		passed = false;
+		cout << "FAILED STATEENGINE RESOURCES CONSERVED TEST" << endl;
+	}
+	if (state.winner == COLOR_EMPTY || state.get_points(static_cast<player_color>(state.winner)) < ScoreTracker::WINNING_POINTS) {
+		passed = false;
+		cout << "FAILED STATEENGINE PLAY OUT TEST" << endl;
+	}
+
+	return passed;
+}
+
 bool test_Tile() {
 	bool passed = true;
 
-	Board board = Board();
-	GameBank bank = GameBank::instance();
-	GameBank::reset();
+	GameContext context(4);
+	Board board = Board(context.get_board_random());
 
-	shared_ptr<Player> player = GameBank::instance().get_player(RED);
+	shared_ptr<Player> player = context.get_player(RED);
 	shared_ptr<Plot> plot = board.get_plot(OrderedPair(-1, 0));
 	Tile& tic1 = board.get_tile(OrderedPair(0, 0));
 
@@ -679,4 +2199,265 @@ bool test_Tile() {
 	}
 
 	return passed;
-}
\ No newline at end of file
+}
+
+bool test_TradePlanner() {
+	bool passed = true;
+
+	ResourceVector full_bank = ResourceVector::filled(19);
+	ResourceVector no_ports = TradePlanner::get_trade_rates(0);
+	ResourceVector wool_port = TradePlanner::get_trade_rates(UNIVERSAL_PORT | port_bit(WOOL));
+	if (no_ports != ResourceVector::filled(4) ||
+		wool_port != ResourceVector({{GRAIN, 3}, {WOOL, 2}, {BRICK, 3}, {ORE, 3}, {LUMBER, 3}})) {
+		passed = false;
+		cout << "FAILED TRADEPLANNER TRADE RATES TEST" << endl;
+	}
+
+	ActionList trades;
+	if (TradePlanner::plan({{GRAIN, 2}, {ORE, 3}}, no_ports, Craftable::CITY_RECIPE, full_bank, trades) != 0 ||
+		!trades.empty()) {
+		passed = false;
+		cout << "FAILED TRADEPLANNER AFFORDABLE TEST" << endl;
+	}
+
+	// The 2:1 port is used before the 3:1 one, and cards the city needs are never paid
+	ResourceVector hand = {{WOOL, 2}, {GRAIN, 5}, {ORE, 1}};
+	int cost = TradePlanner::plan(hand, wool_port, Craftable::CITY_RECIPE, full_bank, trades);
+	if (cost != 5 || trades.size() != 2 ||
+		trades[0].type != MARITIME_TRADE || trades[0].give != GRAIN || trades[0].give_amount != 3 || trades[0].receive != ORE ||
+		trades[1].type != MARITIME_TRADE || trades[1].give != WOOL || trades[1].give_amount != 2 || trades[1].receive != ORE) {
+		passed = false;
+		cout << "FAILED TRADEPLANNER PORT TEST" << endl;
+	}
+
+	// Nothing to spare, or nothing in the bank to get
+	if (TradePlanner::plan({{ORE, 4}, {WOOL, 1}}, no_ports, Craftable::ROAD_RECIPE, full_bank, trades) != TradePlanner::NO_PLAN ||
+		!trades.empty() ||
+		TradePlanner::plan({{ORE, 8}}, no_ports, Craftable::ROAD_RECIPE, ResourceVector({{BRICK, 1}}), trades) != TradePlanner::NO_PLAN ||
+		TradePlanner::plan({{ORE, 8}}, no_ports, Craftable::ROAD_RECIPE, full_bank, trades) != 8) {
+		passed = false;
+		cout << "FAILED TRADEPLANNER NO PLAN TEST" << endl;
+	}
+
+	// Against every way of splitting the trades between the resources, for random hands, ports and targets
+	GameRandom random(11);
+	bool cheapest = true;
+	for (int round = 0; round < 300 && cheapest; round++) {
+		ResourceVector random_hand;
+		ResourceVector target;
+		for (tile_type resource : RESOURCE_TYPES) {
+			random_hand.set(resource, random.next_int(9));
+			target.set(resource, random.next_int(4));
+		}
+		PortMask ports = static_cast<PortMask>(random.next_int(1 << (TILE_EMPTY + 1))) & ~port_bit(DESERT);
+		ResourceVector rates = TradePlanner::get_trade_rates(ports);
+		ResourceVector missing = target - random_hand;
+		ResourceVector spare = random_hand - target;
+
+		int best = TradePlanner::NO_PLAN;
+		int most[TILE_EMPTY] = {};
+		for (tile_type resource : RESOURCE_TYPES) {
+			most[resource] = spare.get(resource) / rates.get(resource);
+		}
+		for (int a = 0; a <= most[GRAIN]; a++) {
+			for (int b = 0; b <= most[WOOL]; b++) {
+				for (int c = 0; c <= most[BRICK]; c++) {
+					for (int d = 0; d <= most[ORE]; d++) {
+						for (int e = 0; e <= most[LUMBER]; e++) {
+							if (a + b + c + d + e != missing.get_total()) {
+								continue;
+							}
+							int paid = a * rates.get(GRAIN) + b * rates.get(WOOL) + c * rates.get(BRICK) +
+								d * rates.get(ORE) + e * rates.get(LUMBER);
+							if (best == TradePlanner::NO_PLAN || paid < best) {
+								best = paid;
+							}
+						}
+					}
+				}
+			}
+		}
+
+		cost = TradePlanner::plan(random_hand, rates, target, full_bank, trades);
+		ResourceVector after = random_hand;
+		int paid = 0;
+		for (const Action &trade : trades) {
+			cheapest = cheapest && after.get(trade.give) >= trade.give_amount && trade.give != trade.receive;
+			after.add(trade.give, -trade.give_amount);
+			after.add(trade.receive, 1);
+			paid += trade.give_amount;
+		}
+		cheapest = cheapest && cost == best && (cost == TradePlanner::NO_PLAN || (paid == cost && after.covers(target)));
+	}
+	if (!cheapest) {
+		passed = false;
+		cout << "FAILED TRADEPLANNER CHEAPEST PLAN TEST" << endl;
+	}
+
+	// From a player in a game, at the rates of their ports, for a settlement and a road together
+	GameContext context(2);
+	Board board = Board(context.get_board_random());
+	shared_ptr<Player> red = context.get_player(RED);
+	red->gain_many_resources({{ORE, 9}, {GRAIN, 1}}, true, false);
+	cost = TradePlanner::plan(board, *red, context.get_bank(), Craftable::SETTLEMENT_RECIPE + Craftable::ROAD_RECIPE, trades);
+	if (cost != TradePlanner::NO_PLAN) {
+		passed = false;
+		cout << "FAILED TRADEPLANNER PLAYER TEST" << endl;
+	}
+	red->gain_many_resources({{ORE, 11}, {WOOL, 1}, {BRICK, 1}}, true, false);
+	cost = TradePlanner::plan(board, *red, context.get_bank(), Craftable::SETTLEMENT_RECIPE + Craftable::ROAD_RECIPE, trades);
+	if (cost != 12 || trades.size() != 3 || trades.count_of(MARITIME_TRADE) != 3) {
+		passed = false;
+		cout << "FAILED TRADEPLANNER PLAYER TEST" << endl;
+	}
+
+	return passed;
+}
+
+bool test_TranspositionTable() {
+	bool passed = true;
+
+	TranspositionTable table(10);
+	if (table.get_size() != 1024) {
+		passed = false;
+		cout << "FAILED TRANSPOSITIONTABLE SIZE TEST" << endl;
+	}
+
+	TranspositionEntry entry{};
+	if (table.probe(12345, entry)) {
+		passed = false;
+		cout << "FAILED TRANSPOSITIONTABLE EMPTY PROBE TEST" << endl;
+	}
+
+	table.store(12345, TranspositionEntry{0.75f, 40, 3, 7});
+	if (!table.probe(12345, entry) || entry.value != 0.75f || entry.visits != 40 || entry.depth != 3 ||
+		entry.best_action != 7) {
+		passed = false;
+		cout << "FAILED TRANSPOSITIONTABLE STORE PROBE TEST" << endl;
+	}
+	// Same slot, different position
+	if (table.probe(12345 + 1024, entry)) {
+		passed = false;
+		cout << "FAILED TRANSPOSITIONTABLE DIFFERENT KEY TEST" << endl;
+	}
+
+	// A shallower search of a different position doesn't replace a deeper one, a deeper one does
+	table.store(12345 + 1024, TranspositionEntry{0.25f, 10, 1, 2});
+	if (table.probe(12345 + 1024, entry) || !table.probe(12345, entry)) {
+		passed = false;
+		cout << "FAILED TRANSPOSITIONTABLE KEEP DEEPER TEST" << endl;
+	}
+	table.store(12345 + 1024, TranspositionEntry{0.25f, 10, 5, 2});
+	if (!table.probe(12345 + 1024, entry) || entry.depth != 5 || table.probe(12345, entry)) {
+		passed = false;
+		cout << "FAILED TRANSPOSITIONTABLE REPLACE TEST" << endl;
+	}
+
+	table.clear();
+	if (table.probe(12345 + 1024, entry)) {
+		passed = false;
+		cout << "FAILED TRANSPOSITIONTABLE CLEAR TEST" << endl;
+	}
+
+	// Threads storing into the same slots never leave an entry which doesn't belong to its position
+	vector<std::thread> threads;
+	for (int t = 0; t < 4; t++) {
+		threads.emplace_back([&table, t]() {
+			for (uint16_t i = 0; i < 20000; i++) {
+				uint64_t hash = (uint64_t(t + 1) << 32) | (i % 64);
+				table.store(hash, TranspositionEntry{static_cast<float>(t), i, 0, static_cast<uint8_t>(t)});
+			}
+		});
+	}
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+	for (int t = 0; t < 4; t++) {
+		for (uint64_t i = 0; i < 64; i++) {
+			if (table.probe((uint64_t(t + 1) << 32) | i, entry) && (entry.best_action != t || entry.value != t)) {
+				passed = false;
+				cout << "FAILED TRANSPOSITIONTABLE THREADS TEST" << endl;
+			}
+		}
+	}
+
+	return passed;
+}
+
+bool test_Zobrist() {
+	bool passed = true;
+
+	// The hash kept up to date by the game is the hash worked out from scratch
+	GameContext context(4, 5);
+	Board board = Board(context.get_board_random());
+	map<player_color, shared_ptr<Agent>> agents;
+	for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+		agents[color] = make_shared<RandomAgent>();
+	}
+	GameEngine engine(board, context, agents);
+	if (engine.get_hash() != engine.get_state().hash()) {
+		passed = false;
+		cout << "FAILED ZOBRIST NEW GAME TEST" << endl;
+	}
+	engine.setup();
+	for (int i = 0; i < 80 && engine.get_winner() == COLOR_EMPTY; i++) {
+		uint64_t before = engine.get_hash();
+		engine.play_turn();
+		if (engine.get_hash() != engine.get_state().hash()) {
+			passed = false;
+			cout << "FAILED ZOBRIST INCREMENTAL HASH TEST" << endl;
+			break;
+		}
+		// At least whose turn it is changed
+		if (engine.get_hash() == before) {
+			passed = false;
+			cout << "FAILED ZOBRIST MOVE CHANGES HASH TEST" << endl;
+			break;
+		}
+	}
+
+	// The same position reached in a different order hashes the same
+	GameContext first(4, 9);
+	GameContext second(4, 9);
+	Board first_board = Board(first.get_board_random());
+	Board second_board = Board(second.get_board_random());
+	shared_ptr<Plot> first_plot = first_board.get_plot(OrderedPair(-1, 0));
+	shared_ptr<Plot> second_plot = second_board.get_plot(OrderedPair(-1, 0));
+	shared_ptr<Path> first_path = first_board.get_path(OrderedPair(-1, 0), OrderedPair(-1, 1));
+	shared_ptr<Path> second_path = second_board.get_path(OrderedPair(-1, 0), OrderedPair(-1, 1));
+
+	first_plot->set_inhabitant(Building(first.get_player(RED), SETTLEMENT));
+	first_path->set_inhabitant(Road(first.get_player(RED)));
+	first.get_player(RED)->gain_resource(ORE);
+	first.get_player(RED)->gain_resource(GRAIN);
+	first.get_player(BLUE)->gain_resource(ORE);
+
+	second_path->set_inhabitant(Road(second.get_player(RED)));
+	second.get_player(BLUE)->gain_resource(ORE);
+	second.get_player(RED)->gain_resource(GRAIN);
+	second_plot->set_inhabitant(Building(second.get_player(RED), SETTLEMENT));
+	second.get_player(RED)->gain_resource(ORE);
+
+	if (first_board.get_bitboards().get_hash() != second_board.get_bitboards().get_hash() ||
+		first.get_hash() != second.get_hash()) {
+		passed = false;
+		cout << "FAILED ZOBRIST TRANSPOSITION TEST" << endl;
+	}
+
+	// Gaining and losing a card gives back the hash, a different player holding it doesn't
+	uint64_t hash = first.get_hash();
+	first.get_player(RED)->gain_resource(WOOL);
+	first.get_player(RED)->discard_resource(WOOL);
+	if (first.get_hash() != hash) {
+		passed = false;
+		cout << "FAILED ZOBRIST UNDO TEST" << endl;
+	}
+	first.get_player(YELLOW)->gain_resource(ORE);
+	second.get_player(GREEN)->gain_resource(ORE);
+	if (first.get_hash() == second.get_hash()) {
+		passed = false;
+		cout << "FAILED ZOBRIST DIFFERENT POSITION TEST" << endl;
+	}
+
+	return passed;
+}
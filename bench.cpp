@@ -0,0 +1,508 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+/*
+ * bench times the parts of the engine that a game spends its time in, from single board lookups up to whole
+ * games, so a change which slows one of them down shows up in the numbers.
+ *
+ * Every benchmark runs a body some number of times. The first few runs are warmup and aren't timed, the rest
+ * (the repetitions) are timed one by one. Anything a repetition needs which shouldn't be timed (a fresh board
+ * for generate_resources, for example) is made by its setup before the clock starts. A body does ops
+ * operations, so ns/op is the median repetition divided by ops.
+ *
+ * Results are printed as a table. With --json they are also written to FILE ("-" for the standard output
+ * instead of the table), one object per benchmark, so two runs can be compared by a script.
+ *
+ * Everything bench runs is seeded, so every run does the same work. bench is built with optimization whatever
+ * the build type, as unoptimized numbers say little about the game people play.
+ *
+ * Usage: bench [--filter TEXT] [--quick] [--json FILE]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "HeaderFiles/Board.h"
+#include "HeaderFiles/BoardBalancer.h"
+#include "HeaderFiles/BoardRenderer.h"
+#include "HeaderFiles/Craftable.h"
+#include "HeaderFiles/GameContext.h"
+#include "HeaderFiles/GameEngine.h"
+#include "HeaderFiles/GameRandom.h"
+#include "HeaderFiles/OutputSink.h"
+#include "HeaderFiles/Player.h"
+#include "HeaderFiles/RandomAgent.h"
+#include "HeaderFiles/TradePlanner.h"
+
+using std::cout, std::endl, std::string, std::vector, std::map, std::shared_ptr, std::make_shared;
+
+const string USAGE = "Usage: bench [--filter TEXT] [--quick] [--json FILE]";
+
+const int PLAYER_COUNT = 4;
+
+struct BenchOptions {
+    // Only benchmarks with this in their name are run
+    string filter;
+    // Runs a tenth of the repetitions, for checking bench works rather than for numbers
+    bool quick = false;
+    // Where to write the results as JSON, none if empty
+    string json_path;
+};
+
+struct BenchResult {
+    string name;
+    int warmup = 0;
+    int repetitions = 0;
+    long ops = 1;
+    double median_ns = 0;
+    double p99_ns = 0;
+    double mean_ns = 0;
+    double min_ns = 0;
+    double ns_per_op = 0;
+};
+
+// Results of the bodies are added here, so the compiler can't leave out the work that made them
+std::uint64_t bench_sink = 0;
+
+/**
+* Requires: argc, argv, options
+* Modifies: options
+* Effects: reads the command line into options. Returns false, printing the usage, if it can't
+*/
+bool parse_options(const int argc, char *argv[], BenchOptions &options);
+
+class BenchRunner {
+
+    private:
+        const BenchOptions &options;
+        vector<BenchResult> results;
+
+    public:
+
+        /**
+        * Requires: options
+        * Modifies: nothing
+        * Effects: Constructor for BenchRunner
+        */
+        explicit BenchRunner(const BenchOptions &_options) : options(_options) {}
+
+        /**
+        * Requires: name, warmup runs, timed repetitions, operations in one run of the body, setup (optional) and body
+        * Modifies: results
+        * Effects: runs setup then body warmup + repetitions times, timing only the body of the repetitions,
+        * unless the name is filtered out
+        */
+        void run(const string &name, int warmup, int repetitions, const long ops,
+            const std::function<void()> &setup, const std::function<void()> &body) {
+
+            if (name.find(options.filter) == string::npos) {
+                return;
+            }
+            if (options.quick) {
+                warmup = std::max(1, warmup / 10);
+                repetitions = std::max(3, repetitions / 10);
+            }
+
+            for (int i = 0; i < warmup; i++) {
+                if (setup) { setup(); }
+                body();
+            }
+            vector<double> times;
+            times.reserve(repetitions);
+            for (int i = 0; i < repetitions; i++) {
+                if (setup) { setup(); }
+                auto start = std::chrono::steady_clock::now();
+                body();
+                std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+                times.push_back(elapsed.count());
+            }
+
+            std::sort(times.begin(), times.end());
+            BenchResult result;
+            result.name = name;
+            result.warmup = warmup;
+            result.repetitions = repetitions;
+            result.ops = ops;
+            result.median_ns = times[times.size() / 2];
+            result.p99_ns = times[std::min(times.size() - 1, (times.size() * 99 + 99) / 100 - 1)];
+            double total = 0;
+            for (double time : times) {
+                total += time;
+            }
+            result.mean_ns = total / times.size();
+            result.min_ns = times.front();
+            result.ns_per_op = result.median_ns / ops;
+            results.push_back(result);
+
+            if (options.json_path != "-") {
+                print_result(result);
+            }
+        }
+
+        /**
+        * Requires: result
+        * Modifies: nothing
+        * Effects: prints the result as a row of the table
+        */
+        static void print_result(const BenchResult &result) {
+            cout << std::left << std::setw(32) << result.name << std::right << std::fixed << std::setprecision(1)
+                << std::setw(8) << result.repetitions
+                << std::setw(14) << result.median_ns / 1000
+                << std::setw(14) << result.p99_ns / 1000
+                << std::setw(14) << result.ns_per_op << endl;
+        }
+
+        /**
+        * Requires: output stream
+        * Modifies: the stream
+        * Effects: writes the results as JSON
+        */
+        void write_json(std::ostream &out) const {
+            out << std::fixed << std::setprecision(1);
+            out << "{\n  \"optimized\": " << (is_optimized() ? "true" : "false") << ",\n  \"benchmarks\": [";
+            for (std::size_t i = 0; i < results.size(); i++) {
+                const BenchResult &result = results[i];
+                out << (i == 0 ? "\n" : ",\n")
+                    << "    {\"name\": \"" << result.name << "\""
+                    << ", \"warmup\": " << result.warmup
+                    << ", \"repetitions\": " << result.repetitions
+                    << ", \"ops\": " << result.ops
+                    << ", \"median_ns\": " << result.median_ns
+                    << ", \"p99_ns\": " << result.p99_ns
+                    << ", \"mean_ns\": " << result.mean_ns
+                    << ", \"min_ns\": " << result.min_ns
+                    << ", \"ns_per_op\": " << result.ns_per_op << "}";
+            }
+            out << "\n  ]\n}\n";
+        }
+
+        /**
+        * Requires: nothing
+        * Modifies: nothing
+        * Effects: returns if bench was compiled with optimization
+        */
+        static bool is_optimized() {
+#if defined(__OPTIMIZE__) || (defined(_MSC_VER) && defined(NDEBUG))
+            return true;
+#else
+            return false;
+#endif
+        }
+};
+
+/**
+* Requires: graph, plot the chain has reached, plots on the chain, roads on the chain, roads wanted
+* Modifies: visited, chain
+* Effects: extends the chain from the plot to the roads wanted without visiting a plot twice, backing up out
+* of dead ends. Returns false if it can't
+*/
+bool extend_chain(const BoardGraph &graph, const PlotId plot, vector<bool> &visited, vector<PathId> &chain,
+    const int roads) {
+
+    if (static_cast<int>(chain.size()) == roads) {
+        return true;
+    }
+    for (PathId path : graph.get_plot_paths(plot)) {
+        if (path == INVALID_ID) {
+            continue;
+        }
+        const std::array<PlotId, 2> &ends = graph.get_path_plots(path);
+        PlotId next = ends[0] == plot ? ends[1] : ends[0];
+        if (visited[next]) {
+            continue;
+        }
+        visited[next] = true;
+        chain.push_back(path);
+        if (extend_chain(graph, next, visited, chain, roads)) {
+            return true;
+        }
+        chain.pop_back();
+        visited[next] = false;
+    }
+    return false;
+}
+
+/**
+* Requires: graph, number of roads, whether to branch
+* Modifies: nothing
+* Effects: returns a connected network of roads, in the order to build them, starting from the middle of the
+* board. A chain is one long road. A branching network grows out from its oldest roads first, so it forks at
+* every plot
+*/
+vector<PathId> plan_road_network(const BoardGraph &graph, const int roads, const bool branching) {
+    PlotId start = graph.get_tile_plots(0)[0];
+    vector<PathId> network;
+    if (branching) {
+        network.push_back(graph.get_plot_paths(start)[0]);
+        for (std::size_t i = 0; i < network.size() && static_cast<int>(network.size()) < roads; i++) {
+            for (PathId adjacent : graph.get_adjacent_paths(network[i])) {
+                bool taken = std::find(network.begin(), network.end(), adjacent) != network.end();
+                if (adjacent != INVALID_ID && !taken && static_cast<int>(network.size()) < roads) {
+                    network.push_back(adjacent);
+                }
+            }
+        }
+    } else {
+        vector<bool> visited(StandardBoard::PLOT_COUNT, false);
+        visited[start] = true;
+        extend_chain(graph, start, visited, network, roads);
+    }
+    return network;
+}
+
+/**
+* Requires: board, the game's context
+* Modifies: board
+* Effects: places two settlements for every player
+*/
+void place_settlements(Board &board, const GameContext &context) {
+    const vector<PlotId> plots = {0, 9, 18, 27, 36, 45, 50, 53};
+    for (int i = 0; i < static_cast<int>(plots.size()); i++) {
+        shared_ptr<Player> player = context.get_player(static_cast<player_color>(i % PLAYER_COUNT));
+        board.get_plot_by_id(plots[i])->set_inhabitant(Building(player, SETTLEMENT));
+    }
+}
+
+int main(int argc, char *argv[]) {
+    BenchOptions options;
+    if (!parse_options(argc, argv, options)) {
+        return 1;
+    }
+    // What the game prints while it is timed is counted and thrown away
+    OutputSink silent_output(nullptr);
+    OutputSink::set_current(&silent_output);
+
+    if (!BenchRunner::is_optimized()) {
+        cout << "bench wasn't compiled with optimization, its numbers won't mean much" << endl;
+    }
+    if (options.json_path != "-") {
+        cout << std::left << std::setw(32) << "benchmark" << std::right << std::setw(8) << "reps"
+            << std::setw(14) << "median (us)" << std::setw(14) << "p99 (us)" << std::setw(14) << "ns/op" << endl;
+    }
+    BenchRunner runner(options);
+
+    /* Boards */
+
+    std::uint64_t seed = 1;
+    runner.run("board/construct", 20, 200, 1, nullptr, [&seed]() {
+        GameRandom random(seed++);
+        Board board(random);
+        bench_sink += board.get_plot_by_id(0)->get_id();
+    });
+
+    GameContext context(PLAYER_COUNT, 1);
+    Board board(context.get_board_random());
+    vector<OrderedPair> plot_coordinates, path_endpoints_a, path_endpoints_b;
+    vector<string> tile_ids;
+    for (PlotId plot = 0; plot < StandardBoard::PLOT_COUNT; plot++) {
+        plot_coordinates.push_back(board.get_plot_by_id(plot)->get_position_coordinates());
+    }
+    for (PathId path = 0; path < StandardBoard::PATH_COUNT; path++) {
+        const std::array<PlotId, 2> &plots = board.get_graph().get_path_plots(path);
+        path_endpoints_a.push_back(plot_coordinates[plots[0]]);
+        path_endpoints_b.push_back(plot_coordinates[plots[1]]);
+    }
+    for (TileId tile = 0; tile < StandardBoard::TILE_COUNT; tile++) {
+        tile_ids.push_back(board.get_tile_by_id(tile).get_position_id());
+    }
+
+    runner.run("board/get_plot", 100, 2000, StandardBoard::PLOT_COUNT, nullptr, [&]() {
+        for (const OrderedPair &coordinates : plot_coordinates) {
+            bench_sink += board.get_plot(coordinates)->get_id();
+        }
+    });
+    runner.run("board/get_path", 100, 2000, StandardBoard::PATH_COUNT, nullptr, [&]() {
+        for (int i = 0; i < StandardBoard::PATH_COUNT; i++) {
+            bench_sink += board.get_path(path_endpoints_a[i], path_endpoints_b[i])->get_id();
+        }
+    });
+    runner.run("board/get_tile", 100, 2000, StandardBoard::TILE_COUNT, nullptr, [&]() {
+        for (const string &position_id : tile_ids) {
+            bench_sink += board.get_tile(position_id).get_production_number();
+        }
+    });
+
+    // Scoring the board's layout, and picking the best of 100 candidates on one thread
+    BoardLayout layout = board.get_layout();
+    BalanceOptions balance;
+    balance.time_ms = 0;
+    balance.threads = 1;
+    balance.max_candidates = 100;
+    const map<tile_type, int> tile_types = {{GRAIN, 4}, {WOOL, 4}, {LUMBER, 4}, {BRICK, 3}, {ORE, 3}, {DESERT, 1}};
+    const vector<int> production_numbers = {2, 3, 3, 4, 4, 5, 5, 6, 6, 8, 8, 9, 9, 10, 10, 11, 11, 12};
+    runner.run("board/balance_score", 100, 2000, 1, nullptr, [&]() {
+        bench_sink += static_cast<std::uint64_t>(BoardBalancer::score(layout, balance.weights).total);
+    });
+    runner.run("board/balance_generate", 5, 50, 100, nullptr, [&]() {
+        GameRandom random(seed++);
+        bench_sink += BoardBalancer::generate(tile_types, production_numbers, balance, random).candidates;
+    });
+
+    /* Rendering */
+
+    runner.run("render/first_frame", 10, 200, 1, nullptr, [&board]() {
+        BoardRenderer renderer(board);
+        renderer.update(board);
+        std::ostringstream frame;
+        renderer.draw(frame);
+        bench_sink += frame.str().size();
+    });
+    runner.run("render/display_board", 10, 500, 1, nullptr, [&board]() {
+        board.display_board();
+    });
+    bool highlight = false;
+    runner.run("render/display_board_highlight", 10, 500, 1, nullptr, [&board, &highlight]() {
+        highlight = !highlight;
+        board.display_board(highlight, highlight ? vector<string>{"a,a", "b,c"} : vector<string>{});
+    });
+
+    /* Roads */
+
+    // Road lengths are cached, so what costs anything is the LongestRoadEngine measuring them again when a road
+    // joins the network or an opponent's settlement splits it. Every repetition starts from a fresh board
+    std::unique_ptr<GameContext> road_context;
+    std::unique_ptr<Board> road_board;
+    for (const bool branching : {false, true}) {
+        for (const int roads : {5, 15}) {
+            const vector<PathId> network = plan_road_network(board.get_graph(), roads, branching);
+            const PlotId split_plot = board.get_graph().get_path_plots(network[network.size() / 2])[0];
+            auto build_network = [&road_context, &road_board, &network](const std::size_t built) {
+                road_context = std::make_unique<GameContext>(PLAYER_COUNT, 2);
+                road_board = std::make_unique<Board>(road_context->get_board_random());
+                for (std::size_t i = 0; i < built; i++) {
+                    road_board->get_path_by_id(network[i])->set_inhabitant(Road(road_context->get_player(RED)));
+                }
+            };
+            string shape = string(branching ? "branching_" : "chain_") + std::to_string(roads);
+
+            runner.run("road/place_" + shape, 5, 200, 1,
+                [&build_network, &network]() { build_network(network.size() - 1); },
+                [&road_context, &road_board, &network]() {
+                    road_board->get_path_by_id(network.back())->set_inhabitant(Road(road_context->get_player(RED)));
+                    bench_sink += road_board->get_bitboards().get_road_length(RED);
+                });
+            runner.run("road/split_" + shape, 5, 200, 1,
+                [&build_network, &network]() { build_network(network.size()); },
+                [&road_context, &road_board, split_plot]() {
+                    road_board->get_plot_by_id(split_plot)->set_inhabitant(Building(road_context->get_player(BLUE), SETTLEMENT));
+                    bench_sink += road_board->get_bitboards().get_road_length(RED);
+                });
+        }
+    }
+
+    /* Scoring and production */
+
+    place_settlements(board, context);
+    runner.run("player/get_points", 100, 2000, PLAYER_COUNT, nullptr, [&board, &context]() {
+        for (auto &player : context.get_players()) {
+            bench_sink += player.second->get_points(board);
+        }
+    });
+
+    // Buying a devcard's worth of resources and paying for it again, checking the four recipes each time
+    shared_ptr<Player> buyer = context.get_player(RED);
+    runner.run("player/resource_cycle", 100, 2000, 100, nullptr, [&buyer]() {
+        for (int i = 0; i < 100; i++) {
+            buyer->gain_many_resources(Craftable::DEVCARD_RECIPE, true, false);
+            bench_sink += buyer->can_afford(Craftable::SETTLEMENT_RECIPE, false) +
+                buyer->can_afford(Craftable::CITY_RECIPE, false) + buyer->can_afford(Craftable::ROAD_RECIPE, false) +
+                buyer->can_afford(Craftable::DEVCARD_RECIPE, false);
+            buyer->discard_many_resources(Craftable::DEVCARD_RECIPE, "spent", true, false);
+        }
+    });
+
+    // Planning the trades for each recipe from a lopsided hand, at 4:1, 3:1 and a 2:1 port
+    const ResourceVector trade_hand = {{GRAIN, 7}, {WOOL, 5}, {ORE, 1}};
+    const ResourceVector trade_bank = ResourceVector::filled(19);
+    const ResourceVector trade_rates[3] = {TradePlanner::get_trade_rates(0),
+        TradePlanner::get_trade_rates(UNIVERSAL_PORT), TradePlanner::get_trade_rates(port_bit(GRAIN))};
+    const ResourceVector trade_targets[4] = {Craftable::SETTLEMENT_RECIPE, Craftable::CITY_RECIPE,
+        Craftable::ROAD_RECIPE, Craftable::DEVCARD_RECIPE};
+    ActionList planned_trades;
+    runner.run("trade/plan", 100, 2000, 12, nullptr, [&]() {
+        for (const ResourceVector &rates : trade_rates) {
+            for (const ResourceVector &target : trade_targets) {
+                bench_sink += TradePlanner::plan(trade_hand, rates, target, trade_bank, planned_trades) +
+                    planned_trades.size();
+            }
+        }
+    });
+
+    // Production takes from the bank, so every repetition starts from a fresh game
+    std::unique_ptr<GameContext> production_context;
+    std::unique_ptr<Board> production_board;
+    runner.run("board/generate_resources", 10, 500, 10,
+        [&production_context, &production_board]() {
+            production_context = std::make_unique<GameContext>(PLAYER_COUNT, 3);
+            production_board = std::make_unique<Board>(production_context->get_board_random());
+            place_settlements(*production_board, *production_context);
+        },
+        [&production_board]() {
+            for (int roll = 2; roll <= 12; roll++) {
+                if (roll != 7) {
+                    production_board->generate_resources(roll, false);
+                }
+            }
+        });
+
+    /* Whole games */
+
+    std::unique_ptr<GameContext> game_context;
+    std::unique_ptr<Board> game_board;
+    std::uint64_t game_seed = 1;
+    map<player_color, shared_ptr<Agent>> agents;
+    for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+        agents[color] = make_shared<RandomAgent>();
+    }
+    runner.run("game/random_agents", 2, 30, 1,
+        [&game_context, &game_board, &game_seed]() {
+            game_context = std::make_unique<GameContext>(PLAYER_COUNT, game_seed++);
+            game_board = std::make_unique<Board>(game_context->get_board_random());
+        },
+        [&game_context, &game_board, &agents]() {
+            GameEngine engine(*game_board, *game_context, agents);
+            bench_sink += engine.play_game(1000);
+        });
+
+    if (!options.json_path.empty()) {
+        if (options.json_path == "-") {
+            runner.write_json(cout);
+        } else {
+            std::ofstream json(options.json_path);
+            runner.write_json(json);
+            if (!json) {
+                cout << "Couldn't write " << options.json_path << endl;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+bool parse_options(const int argc, char *argv[], BenchOptions &options) {
+    for (int i = 1; i < argc; i++) {
+        string option = argv[i];
+        if (option == "--quick") {
+            options.quick = true;
+        } else if (option == "--filter" && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (option == "--json" && i + 1 < argc) {
+            options.json_path = argv[++i];
+        } else {
+            cout << USAGE << endl;
+            return false;
+        }
+    }
+    return true;
+}
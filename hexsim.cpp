@@ -0,0 +1,401 @@
+//
+// Created by agent on 10/17/2026.
+//
+
+/*
+ * hexsim plays many complete games between automated agents and reports what happened in them.
+ *
+ * Games are handed out to a pool of threads one at a time. Every game has its own GameContext (bank,
+ * players and random numbers) and Board, so the threads share nothing but the counter of the next game to
+ * play and the stateless agents. Game i is always seeded with seed + i, so the results don't depend on the
+ * number of threads or which thread played which game.
+ *
+ * Seats are played by RandomAgents, except the first --mcts seats, which are played by MctsAgents thinking
+ * --think-ms per action. The cores are shared between the games, so each MctsAgent searches on cores / T
+ * threads. Searches stop on time, so games with MctsAgents don't repeat exactly.
+ *
+ * With --start, every game carries on from a position saved with GameSave (4 players) instead of starting
+ * from scratch. The random numbers are still seed + i, so the games go their own ways from the position.
+ *
+ * With --balance N, every game is played on the fairest of N boards dealt by the BoardBalancer. Candidates are
+ * counted rather than timed, so the boards still only depend on the seed.
+ *
+ * With --log-dir, every game is written to DIR/game_<i>.hxlog as a GameLog. --replay plays one of those
+ * logs back instead of playing games, and reports how fast it replayed and how the game ended.
+ *
+ * Usage: hexsim [--games N] [--threads T] [--seed S] [--max-turns M] [--mcts K] [--think-ms MS] [--start SAVE]
+ *               [--log-dir DIR] [--balance N]
+ *        hexsim --replay FILE
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "HeaderFiles/Board.h"
+#include "HeaderFiles/BoardBalancer.h"
+#include "HeaderFiles/GameContext.h"
+#include "HeaderFiles/GameEngine.h"
+#include "HeaderFiles/GameLog.h"
+#include "HeaderFiles/GameSave.h"
+#include "HeaderFiles/InputFunctions.h"
+#include "HeaderFiles/MctsAgent.h"
+#include "HeaderFiles/OutputSink.h"
+#include "HeaderFiles/RandomAgent.h"
+
+using std::cout, std::endl, std::string, std::vector, std::array, std::map, std::shared_ptr, std::make_shared;
+
+const int PLAYER_COUNT = 4;
+// Final scores above this are counted with it
+const int MAX_POINTS = 15;
+
+const string USAGE = "Usage: hexsim [--games N] [--threads T] [--seed S] [--max-turns M] [--mcts K] [--think-ms MS] "
+    "[--start SAVE] [--log-dir DIR] [--balance N]\n       hexsim --replay FILE";
+
+struct SimulationOptions {
+    int games = 1000;
+    int threads = 1;
+    std::uint64_t seed = 1;
+    int max_turns = 1000;
+    int mcts_seats = 0;
+    int think_ms = 20;
+    // Candidate boards each game's board is picked from, 0 to deal one at random
+    int balance_candidates = 0;
+    // Position every game starts from, if there is one
+    bool from_saved = false;
+    SavedGame start;
+    // Directory to write a log of every game to, none if empty
+    string log_dir;
+    // Log to replay instead of playing games
+    string replay;
+};
+
+struct SimulationStats {
+    long games = 0;
+    long unfinished = 0;
+    array<long, PLAYER_COUNT> wins{};
+
+    // Turns taken by each finished game
+    vector<int> game_turns;
+
+    // How many players ended a game in each seat with each score
+    array<array<long, MAX_POINTS + 1>, PLAYER_COUNT> points{};
+
+    // Resources taken from and put back in the bank
+    array<long, TILE_EMPTY> resources_drawn{};
+    array<long, TILE_EMPTY> resources_returned{};
+
+    /**
+    * Requires: other stats
+    * Modifies: every count
+    * Effects: adds the other stats to these
+    */
+    void merge(const SimulationStats &other) {
+        games += other.games;
+        unfinished += other.unfinished;
+        game_turns.insert(game_turns.end(), other.game_turns.begin(), other.game_turns.end());
+        for (int seat = 0; seat < PLAYER_COUNT; seat++) {
+            wins[seat] += other.wins[seat];
+            for (int p = 0; p <= MAX_POINTS; p++) {
+                points[seat][p] += other.points[seat][p];
+            }
+        }
+        for (int r = 0; r < TILE_EMPTY; r++) {
+            resources_drawn[r] += other.resources_drawn[r];
+            resources_returned[r] += other.resources_returned[r];
+        }
+    }
+};
+
+/**
+* Requires: argc, argv, options
+* Modifies: options
+* Effects: reads the command line into options. Returns false, printing the usage, if it can't
+*/
+bool parse_options(const int argc, char *argv[], SimulationOptions &options);
+
+/**
+* Requires: the game's index, options, agents for every color, stats
+* Modifies: stats
+* Effects: plays one game to the end (or max_turns) and records it
+*/
+void play_game(const int game_index, const SimulationOptions &options,
+    const map<player_color, shared_ptr<Agent>> &agents, SimulationStats &stats);
+
+/**
+* Requires: options, counter of the next game to play, stats
+* Modifies: next_game, stats
+* Effects: plays games until every game has been handed out
+*/
+void run_worker(const SimulationOptions &options, std::atomic<int> &next_game, SimulationStats &stats);
+
+/**
+* Requires: path of a game log
+* Modifies: nothing
+* Effects: replays the log and prints how many events it held, how fast they were replayed and the final
+* scores. Returns false, printing why, if it can't
+*/
+bool replay_log(const string &path);
+
+/**
+* Requires: options, stats, seconds taken
+* Modifies: nothing
+* Effects: prints the win rates, game lengths, scores and resource flow
+*/
+void print_stats(const SimulationOptions &options, SimulationStats &stats, const double seconds);
+
+int main(int argc, char *argv[]) {
+    SimulationOptions options;
+    options.threads = std::max(1u, std::thread::hardware_concurrency());
+    if (!parse_options(argc, argv, options)) {
+        return 1;
+    }
+    // Nobody watches the games, so anything they print is dropped. hexsim's own reports go to std::cout
+    OutputSink silent_output(nullptr);
+    OutputSink::set_current(&silent_output);
+    if (!options.replay.empty()) {
+        return replay_log(options.replay) ? 0 : 1;
+    }
+
+    std::atomic<int> next_game(0);
+    vector<SimulationStats> thread_stats(options.threads);
+    vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < options.threads; t++) {
+        workers.emplace_back(run_worker, std::cref(options), std::ref(next_game), std::ref(thread_stats[t]));
+    }
+    SimulationStats stats;
+    for (int t = 0; t < options.threads; t++) {
+        workers[t].join();
+        stats.merge(thread_stats[t]);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    print_stats(options, stats, elapsed.count());
+    return 0;
+}
+
+bool parse_options(const int argc, char *argv[], SimulationOptions &options) {
+    for (int i = 1; i < argc; i++) {
+        string option = argv[i];
+        if (i + 1 >= argc) {
+            cout << USAGE << endl;
+            return false;
+        }
+        if (option == "--log-dir" || option == "--replay") {
+            (option == "--log-dir" ? options.log_dir : options.replay) = argv[++i];
+            continue;
+        }
+        if (option == "--start") {
+            string path = argv[++i];
+            options.from_saved = GameSave::load(path, options.start);
+            if (!options.from_saved || options.start.state.player_count != PLAYER_COUNT) {
+                cout << path << " isn't a saved game of " << PLAYER_COUNT << " players" << endl;
+                return false;
+            }
+            // Restoring doesn't depend on the random numbers, so a save that restores once restores in every game
+            GameContext scratch_context(PLAYER_COUNT, options.seed);
+            Board scratch_board = Board(GameSave::get_layout(options.start.state));
+            if (!GameSave::restore(options.start.state, scratch_board, scratch_context)) {
+                cout << path << " doesn't restore into a game, its pieces, cards or bank don't add up" << endl;
+                return false;
+            }
+            continue;
+        }
+        long value = std::strtol(argv[++i], nullptr, 10);
+        if (option == "--games" && value > 0) {
+            options.games = value;
+        } else if (option == "--threads" && value > 0) {
+            options.threads = value;
+        } else if (option == "--seed" && value >= 0) {
+            options.seed = value;
+        } else if (option == "--max-turns" && value > 0) {
+            options.max_turns = value;
+        } else if (option == "--mcts" && value >= 0 && value <= PLAYER_COUNT) {
+            options.mcts_seats = value;
+        } else if (option == "--think-ms" && value > 0) {
+            options.think_ms = value;
+        } else if (option == "--balance" && value >= 0) {
+            options.balance_candidates = value;
+        } else {
+            cout << USAGE << endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+void play_game(const int game_index, const SimulationOptions &options,
+    const map<player_color, shared_ptr<Agent>> &agents, SimulationStats &stats) {
+
+    GameContext context(PLAYER_COUNT, options.seed + game_index);
+    // The games already use every thread, so each board is balanced on the thread playing its game
+    BalanceOptions balance;
+    balance.time_ms = 0;
+    balance.threads = 1;
+    balance.max_candidates = options.balance_candidates;
+    Board board = options.from_saved ? Board(GameSave::get_layout(options.start.state)) :
+        options.balance_candidates > 0 ? Board(context.get_board_random(), balance) : Board(context.get_board_random());
+
+    GameEngine engine(board, context, agents);
+    if (options.from_saved) {
+        // parse_options already checked that the saved game restores
+        GameSave::restore(options.start.state, board, context);
+        engine.resume(options.start.state);
+    }
+    GameLogWriter log;
+    // A log replays a game from its start, so games from a saved position aren't logged
+    if (!options.log_dir.empty() && !options.from_saved) {
+        string path = options.log_dir + "/game_" + std::to_string(game_index) + ".hxlog";
+        if (log.open(path, GameLogHeader::describe(board, context))) {
+            context.set_log(&log);
+        } else {
+            cout << "Couldn't write " << path << endl;
+        }
+    }
+    player_color winner = engine.play_game(options.max_turns);
+
+    stats.games++;
+    if (winner == COLOR_EMPTY) {
+        stats.unfinished++;
+    } else {
+        stats.wins[winner]++;
+        stats.game_turns.push_back(engine.get_turn_count());
+    }
+    // Players are seated in color order, so the color is the seat
+    for (auto &player : context.get_players()) {
+        int points = std::min(player.second->get_points(board), MAX_POINTS);
+        stats.points[player.second->get_color()][points]++;
+    }
+    const GameBank &bank = context.get_bank();
+    for (int r = 0; r < TILE_EMPTY; r++) {
+        stats.resources_drawn[r] += bank.get_resources_drawn()[r];
+        stats.resources_returned[r] += bank.get_resources_returned()[r];
+    }
+}
+
+void run_worker(const SimulationOptions &options, std::atomic<int> &next_game, SimulationStats &stats) {
+    // Neither agent keeps state between decisions, so one per color is shared by all of this thread's games
+    MctsOptions mcts_options;
+    mcts_options.time_ms = options.think_ms;
+    mcts_options.threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) / options.threads);
+    map<player_color, shared_ptr<Agent>> agents;
+    for (player_color color : {RED, YELLOW, GREEN, BLUE}) {
+        if (color < options.mcts_seats) {
+            agents[color] = make_shared<MctsAgent>(mcts_options);
+        } else {
+            agents[color] = make_shared<RandomAgent>();
+        }
+    }
+
+    // The current sink is per thread, so the main thread's silent sink doesn't cover this one
+    OutputSink silent_output(nullptr);
+    OutputSink::set_current(&silent_output);
+    while (true) {
+        int game_index = next_game.fetch_add(1, std::memory_order_relaxed);
+        if (game_index >= options.games) {
+            break;
+        }
+        play_game(game_index, options, agents, stats);
+    }
+    OutputSink::set_current(nullptr);
+}
+
+bool replay_log(const string &path) {
+    GameLogReader reader;
+    if (!reader.open(path)) {
+        cout << "Couldn't read a game log from " << path << endl;
+        return false;
+    }
+    const GameLogHeader &header = reader.get_header();
+    GameContext context(header.player_count, header.seed);
+    Board board = Board(header.get_layout());
+
+    GameLogReplayer replayer(board, context);
+    auto start = std::chrono::steady_clock::now();
+    std::size_t applied = replayer.replay(reader);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    cout << std::fixed << std::setprecision(1);
+    cout << "Replayed " << applied << " of " << reader.get_event_count() << " events in "
+        << elapsed.count() * 1000 << "ms (" << (elapsed.count() > 0 ? applied / elapsed.count() : 0.0)
+        << " events/s)" << endl;
+    if (applied != reader.get_event_count()) {
+        cout << "Event " << applied << " doesn't fit the game, the log stops making sense there" << endl;
+    }
+    player_color winner = replayer.get_winner();
+    cout << "Winner: " << (winner == COLOR_EMPTY ? "nobody" : Player::get_color_as_text(winner)) << endl;
+    for (auto &player : context.get_players()) {
+        cout << " - " << Player::get_color_as_text(player.second->get_color()) << ": "
+            << player.second->get_points(board) << " points" << endl;
+    }
+    return applied == reader.get_event_count();
+}
+
+void print_stats(const SimulationOptions &options, SimulationStats &stats, const double seconds) {
+    cout << std::fixed << std::setprecision(1);
+    cout << "Played " << stats.games << " games on " << options.threads << " threads in " << seconds << "s ("
+        << (seconds > 0 ? stats.games / seconds : 0.0) << " games/s)" << endl;
+    cout << "Unfinished after " << options.max_turns << " turns: " << stats.unfinished << endl;
+
+    long finished = stats.games - stats.unfinished;
+    cout << "\nWin rate by seat:" << endl;
+    for (int seat = 0; seat < PLAYER_COUNT; seat++) {
+        double rate = finished > 0 ? 100.0 * stats.wins[seat] / finished : 0.0;
+        cout << " - Seat " << seat + 1 << " (" << Player::get_color_as_text(static_cast<player_color>(seat)) << "): "
+            << rate << "%" << endl;
+    }
+
+    if (!stats.game_turns.empty()) {
+        std::sort(stats.game_turns.begin(), stats.game_turns.end());
+        long total = 0;
+        for (int turns : stats.game_turns) {
+            total += turns;
+        }
+        cout << "\nGame length in turns (finished games):" << endl;
+        cout << " - mean " << static_cast<double>(total) / stats.game_turns.size()
+            << " | min " << stats.game_turns.front()
+            << " | median " << stats.game_turns[stats.game_turns.size() / 2]
+            << " | 90th " << stats.game_turns[stats.game_turns.size() * 9 / 10]
+            << " | max " << stats.game_turns.back() << endl;
+    }
+
+    cout << "\nFinal victory points (% of games), by seat:" << endl;
+    cout << "  VP";
+    for (int seat = 0; seat < PLAYER_COUNT; seat++) {
+        cout << std::setw(9) << ("Seat " + std::to_string(seat + 1));
+    }
+    cout << endl;
+    for (int p = 0; p <= MAX_POINTS; p++) {
+        bool any = false;
+        for (int seat = 0; seat < PLAYER_COUNT; seat++) {
+            any = any || stats.points[seat][p] > 0;
+        }
+        if (!any) {
+            continue;
+        }
+        cout << std::setw(3) << p << (p == MAX_POINTS ? "+" : " ");
+        for (int seat = 0; seat < PLAYER_COUNT; seat++) {
+            cout << std::setw(8) << (stats.games > 0 ? 100.0 * stats.points[seat][p] / stats.games : 0.0) << "%";
+        }
+        cout << endl;
+    }
+
+    cout << "\nResource flow per game (from bank / back to bank):" << endl;
+    map<tile_type, string> names = get_resource_conversion_to_string(false);
+    for (int r = GRAIN; r < TILE_EMPTY; r++) {
+        double games = stats.games > 0 ? stats.games : 1;
+        cout << " - " << std::left << std::setw(7) << names.at(static_cast<tile_type>(r)) << std::right
+            << std::setw(8) << stats.resources_drawn[r] / games << " /"
+            << std::setw(8) << stats.resources_returned[r] / games << endl;
+    }
+}
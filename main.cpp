@@ -1,99 +1,131 @@
 //
 // Created by nmila on 9/4/2025.
 //
+#include <cstdio>
 #include <iostream>
 #include <windows.h>
 
 #include "HeaderFiles/Board.h"
+#include "HeaderFiles/BoardBalancer.h"
 #include "HeaderFiles/Player.h"
 #include "HeaderFiles/InputFunctions.h"
-#include "HeaderFiles/GameBank.h"
-
-using std::cout, std::endl, std::cin, std::vector, std::map, std::shared_ptr;
+#include "HeaderFiles/GameContext.h"
+#include "HeaderFiles/GameEngine.h"
+#include "HeaderFiles/GameLog.h"
+#include "HeaderFiles/GameSave.h"
+#include "HeaderFiles/ConsoleAgent.h"
+#include "HeaderFiles/MctsAgent.h"
+#include "HeaderFiles/OutputSink.h"
+#include "HeaderFiles/Instrumentation.h"
+
+using std::cin, std::vector, std::map, std::shared_ptr;
 using std::getline, std::string, std::to_string, std::string_literals::operator ""s;
 
-void player_board_setup(Board &board, const map<int, shared_ptr<Player>> &players);
-
-void roll_dice(Board &board, shared_ptr<Player> current_player, map<int, shared_ptr<Player>> players, const int number_override = -1);
+// The game in progress is saved here at the start of every turn, so quitting doesn't lose it
+const string SAVE_PATH = "hexsettlers.save";
 
 void print_winner_score(const Board &board, const shared_ptr<Player> &current_player);
 
-void quick_setup(Board &board);
+void quick_setup(Board &board, const GameContext &context);
+
+bool saved_game_restores(const SavedGame &saved);
 
-int main() {
+int main(int argc, char *argv[]) {
     system(("chcp "s + to_string(CP_UTF8)).c_str());
 
+    // With --pinned-board the board stays at the top of the terminal and only what changes on it is redrawn,
+    // which is much less to send to a remote terminal than the whole board every time
+    bool pin_board = false;
+    // With --stats how often the hot paths were called, and how long they took, is printed once the game ends
+    bool print_stats = false;
+    // With --balanced-board a new game is played on the fairest of the boards that can be dealt in a moment
+    bool balance_board = false;
+    for (int i = 1; i < argc; i++) {
+        if (string(argv[i]) == "--pinned-board") {
+            pin_board = true;
+        } else if (string(argv[i]) == "--stats") {
+            print_stats = true;
+        } else if (string(argv[i]) == "--balanced-board") {
+            balance_board = true;
+        }
+    }
+
+    // Messages are kept until a turn ends or the board is shown, but a prompt has to be seen before its answer is read
+    cin.tie(&game_output());
+
     welcome_message();
     help_message();
 
-    GameBank::instance();
-    Board board = Board();
-
-    player_board_setup(board, GameBank::instance().get_players());
-
-    board.display_board();
-
-    int turn_index = 1;
-    cout << "\nThe game will now truly begin!\n" << endl;
-    while (true) {
-        shared_ptr<Player> current_player = GameBank::instance().get_player(turn_index);
-
-        current_player->start_new_turn();
-        roll_dice(board, current_player, GameBank::instance().get_players());
-
-        cout << "\n" << current_player->get_name() << ", it is your turn? ";
-        string input;
-        while (true) {
-            cout << "What would you like to do?" << endl;
-            cout << " [Pass]  [Trade]  [Craft]  [Devcard]  [Info]" << endl;
-            getline(cin, input);
-            if (input.empty()) {
-                cout << "It seems you didn't enter anything" << endl;
-                continue;
-            }
-            input = get_lowercase(input);
-            if (input == "quit") {
-                cout << "You cannot quit from this game state. Did you mean [Pass]?" << endl;
-                continue;
-            }
-            if (input == "pass") {
-                break;
-            }
-            if (input == "trade") {
-                trade_prompt(board, current_player, GameBank::instance().get_players());
-            }
-            if (input == "craft") {
-                craft_something_prompt(board, current_player);
-            }
-            if (input == "devcard") {
-                play_devcard(board, current_player, true);
-            }
-            if (input == "info") {
-                request_info_prompt(board, current_player, GameBank::instance().get_players());
-            }
-        }
+    SavedGame saved;
+    bool resuming = GameSave::load(SAVE_PATH, saved) && continue_saved_game_prompt();
+    // A save which can't be restored is kept aside rather than deleted, and a new game is started instead
+    if (resuming && !saved_game_restores(saved)) {
+        game_output() << "Sorry, the saved game couldn't be loaded. It was kept as " << SAVE_PATH << ".bad, "
+            << "and a new game will be started." << '\n';
+        std::rename(SAVE_PATH.c_str(), (SAVE_PATH + ".bad").c_str());
+        resuming = false;
+    }
+    GameContext context(resuming ? saved.state.player_count : 0, resuming ? saved.seed : time(nullptr));
+    Board board = resuming ? Board(GameSave::get_layout(saved.state)) :
+        balance_board ? Board(context.get_board_random(), BalanceOptions()) : Board(context.get_board_random());
+    if (resuming) {
+        GameSave::restore(saved.state, board, context);
+    }
 
-        if (current_player->get_points(board) >= 10) {
-            print_winner_score(board, current_player);
-            break;
+    // Everyone else plays at this terminal, the computer takes the last seats
+    int computer_players = computer_player_count_prompt(context.get_player_count());
+    map<player_color, shared_ptr<Agent>> agents;
+    for (auto &player : context.get_players()) {
+        player_color color = player.second->get_color();
+        if (color >= context.get_player_count() - computer_players) {
+            agents[color] = std::make_shared<MctsAgent>();
+        } else {
+            agents[color] = std::make_shared<ConsoleAgent>();
         }
-
-        // Continue turn index
-        turn_index += 1;
-        if (turn_index > GameBank::instance().get_players().size()) {
-            turn_index = 1;
+    }
+    GameEngine engine(board, context, agents, true);
+    board.set_display_pinned(pin_board);
+
+    // The last game played from the start is kept, so it can be replayed with hexsim --replay
+    GameLogWriter log;
+    if (resuming) {
+        engine.resume(saved.state);
+        board.display_board();
+        game_output() << "\nWelcome back! The game carries on from turn " << engine.get_turn_count() + 1 << ".\n" << '\n';
+    } else {
+        if (log.open("last_game.hxlog", GameLogHeader::describe(board, context))) {
+            context.set_log(&log);
         }
-        cout << endl;
+
+        engine.setup();
+
+        board.display_board();
+
+        game_output() << "\nThe game will now truly begin!\n" << '\n';
     }
+    while (engine.get_winner() == COLOR_EMPTY) {
+        GameSave::save(SAVE_PATH, SavedGame{context.get_seed(), engine.get_state()}, SAVE_BINARY);
+        engine.play_turn();
+        game_output() << '\n';
+    }
+    std::remove(SAVE_PATH.c_str());
+    board.set_display_pinned(false);
+    print_winner_score(board, context.get_player(engine.get_winner()));
 
-    cout << "\n\n" << "Thanks for Playing!\n\n" << endl;
+    if (print_stats) {
+        game_output() << '\n';
+        Instrumentation::report(game_output());
+    }
+
+    game_output() << "\n\n" << "Thanks for Playing!\n\n" << '\n';
+    flush_game_output();
     return 0;
 }
 
-void quick_setup(Board &board) {
+void quick_setup(Board &board, const GameContext &context) {
     // RED
-    if (GameBank::instance().get_player(RED) != nullptr) {
-        shared_ptr<Player> red = GameBank::instance().get_player(RED);
+    if (context.get_player(RED) != nullptr) {
+        shared_ptr<Player> red = context.get_player(RED);
         board.get_plot(OrderedPair(-1, 0))->set_inhabitant(Building(red, SETTLEMENT));
         board.get_plot(OrderedPair(3, -2))->set_inhabitant(Building(red, SETTLEMENT));
 
@@ -105,8 +137,8 @@ void quick_setup(Board &board) {
     }
 
     // YELLOW
-    if (GameBank::instance().get_player(YELLOW) != nullptr) {
-        shared_ptr<Player> yellow = GameBank::instance().get_player(YELLOW);
+    if (context.get_player(YELLOW) != nullptr) {
+        shared_ptr<Player> yellow = context.get_player(YELLOW);
         board.get_plot(OrderedPair(1, -1))->set_inhabitant(Building(yellow, SETTLEMENT));
         board.get_plot(OrderedPair(-1, 3))->set_inhabitant(Building(yellow, SETTLEMENT));
 
@@ -118,8 +150,8 @@ void quick_setup(Board &board) {
     }
 
     // GREEN
-    if (GameBank::instance().get_player(GREEN) != nullptr) {
-        shared_ptr<Player> green = GameBank::instance().get_player(GREEN);
+    if (context.get_player(GREEN) != nullptr) {
+        shared_ptr<Player> green = context.get_player(GREEN);
         board.get_plot(OrderedPair(-3, -1))->set_inhabitant(Building(green, SETTLEMENT));
         board.get_plot(OrderedPair(3, 2))->set_inhabitant(Building(green, SETTLEMENT));
 
@@ -131,8 +163,8 @@ void quick_setup(Board &board) {
     }
 
     // BLUE
-    if (GameBank::instance().get_player(BLUE) != nullptr) {
-        shared_ptr<Player> blue = GameBank::instance().get_player(BLUE);
+    if (context.get_player(BLUE) != nullptr) {
+        shared_ptr<Player> blue = context.get_player(BLUE);
         board.get_plot(OrderedPair(-1, -3))->set_inhabitant(Building(blue, SETTLEMENT));
         board.get_plot(OrderedPair(1, 5))->set_inhabitant(Building(blue, SETTLEMENT));
 
@@ -144,67 +176,37 @@ void quick_setup(Board &board) {
     }
 }
 
+/**
+* Requires: saved game
+* Modifies: nothing
+* Effects: returns if the saved game can be restored, by restoring it into a game of its own
+*/
+bool saved_game_restores(const SavedGame &saved) {
+    GameContext context(saved.state.player_count, saved.seed);
+    Board board = Board(GameSave::get_layout(saved.state));
+    return GameSave::restore(saved.state, board, context);
+}
 
 void print_winner_score(const Board &board, const shared_ptr<Player> &current_player) {
-    cout << current_player->get_name() << " WINS!!!" << endl;
-    cout << "Here's the breakdown: " << endl;
+    game_output() << current_player->get_name() << " WINS!!!" << '\n';
+    game_output() << "Here's the breakdown: " << '\n';
 
     int num = current_player->get_number_of_placed_building(board, SETTLEMENT);
-    cout << " - " << num << " Settlements: " << num << " Victory Points" << endl;
+    game_output() << " - " << num << " Settlements: " << num << " Victory Points" << '\n';
 
     num = current_player->get_number_of_placed_building(board, CITY);
-    cout << " - " << num << " Cities: " << (num * 2) << " Victory Points" << endl;
+    game_output() << " - " << num << " Cities: " << (num * 2) << " Victory Points" << '\n';
 
     num = current_player->get_number_of_vp_devcards();
-    cout << " - " << num << " Victory Point Cards: " << num << " Victory Points" << endl;
+    game_output() << " - " << num << " Victory Point Cards: " << num << " Victory Points" << '\n';
 
     if (current_player->has_largest_army()) {
-        cout << " - Largest Army: 2 Victory Points" << endl;
+        game_output() << " - Largest Army: 2 Victory Points" << '\n';
     }
 
     if (current_player->has_longest_road()) {
-        cout << " - Longest Road: 2 Victory Points" << endl;
+        game_output() << " - Longest Road: 2 Victory Points" << '\n';
     }
 
-    cout << "\n" << current_player->get_name() << " total Victory Points: " << current_player->get_points(board) << endl;
+    game_output() << "\n" << current_player->get_name() << " total Victory Points: " << current_player->get_points(board) << '\n';
 }
-
-void roll_dice(Board &board, shared_ptr<Player> current_player, map<int, shared_ptr<Player>> players, const int number_override) {
-    int result = -1;
-    if (number_override >= 2 && number_override <= 12) {
-        result = number_override;
-    } else {
-        srand(time(nullptr));
-        result = ((rand() % 6) + 1) + ((rand() % 6) + 1);
-    }
-    cout << "--------------------------------------------------------" << endl;
-    cout << "\nThe Dice have rolled a " << result << "\n" << endl;
-    if (result == 7) {
-        for (auto player : players) {
-            player.second->seven_rolled();
-        }
-
-        robber_movement_prompt(board, current_player, true);
-
-    } else {
-        board.generate_resources(result);
-    }
-}
-
-void player_board_setup(Board &board, const map<int, shared_ptr<Player>> &players) {
-
-    vector<shared_ptr<Player>> all_players;
-    // Put players into a vector for easy forward and reverse iteration. I know there are other ways to do this, just don't know how
-    for (auto &it : players) {
-        all_players.push_back(it.second);
-    }
-
-    // First round of player placements
-    for (int i = 0; i < all_players.size(); i++) {
-        initial_player_setup(board, all_players[i], false);
-    }
-    // Second round of player placements
-    for (int i = all_players.size() - 1; i >= 0; i--) {
-        initial_player_setup(board, all_players[i], true);
-    }
-}
\ No newline at end of file